@@ -21,8 +21,9 @@ void InMemParallelComputeTask::run() {
     }
 }
 
-void InMemGDSUtils::runParallelCompute(InMemParallelCompute& vc, common::offset_t maxOffset,
-    ExecutionContext* context, std::optional<common::table_id_t> tableId) {
+static void runTask(InMemParallelCompute& vc, common::offset_t maxOffset,
+    ExecutionContext* context, std::optional<common::table_id_t> tableId,
+    std::optional<uint64_t> morselSize) {
     auto clientContext = context->clientContext;
     if (clientContext->interrupted()) {
         throw common::InterruptException();
@@ -31,9 +32,23 @@ void InMemGDSUtils::runParallelCompute(InMemParallelCompute& vc, common::offset_
     auto sharedState = std::make_shared<VertexComputeTaskSharedState>(maxThreads);
     const auto task =
         std::make_shared<InMemParallelComputeTask>(maxThreads, vc, sharedState, tableId);
-    sharedState->morselDispatcher.init(maxOffset);
+    if (morselSize.has_value()) {
+        sharedState->morselDispatcher.init(maxOffset, *morselSize);
+    } else {
+        sharedState->morselDispatcher.init(maxOffset);
+    }
     common::TaskScheduler::Get(*clientContext)
         ->scheduleTaskAndWaitOrError(task, context, true /* launchNewWorkerThread */);
 }
+
+void InMemGDSUtils::runParallelCompute(InMemParallelCompute& vc, common::offset_t maxOffset,
+    ExecutionContext* context, std::optional<common::table_id_t> tableId) {
+    runTask(vc, maxOffset, context, tableId, std::nullopt /* morselSize */);
+}
+
+void InMemGDSUtils::runParallelComputePerOffset(InMemParallelCompute& vc,
+    common::offset_t maxOffset, ExecutionContext* context) {
+    runTask(vc, maxOffset, context, std::nullopt /* tableId */, 1 /* morselSize */);
+}
 } // namespace algo_extension
 } // namespace lbug
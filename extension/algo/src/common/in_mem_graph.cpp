@@ -10,19 +10,18 @@ InMemGraph::InMemGraph(const common::offset_t numNodes, storage::MemoryManager*
 
 void InMemGraph::reinit(const common::offset_t numNodes) {
     this->numNodes = numNodes;
-    csrOffsets.reserve(numNodes);
-    csrOffsets.clear();
+    csrOffsets.resize(numNodes + 1);
+    csrOffsets[0] = 0;
     csrEdges.clear();
     numEdges = 0;
 }
 
-void InMemGraph::initNextNode() {
-    csrOffsets.push_back(csrEdges.size());
-}
-
-void InMemGraph::insertNbr(const common::offset_t to, const weight_t weight) {
-    csrEdges.emplace_back(to, weight);
-    numEdges++;
+void InMemGraph::initEdges() {
+    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
+        csrOffsets[nodeId + 1] += csrOffsets[nodeId];
+    }
+    numEdges = csrOffsets[numNodes];
+    csrEdges.resize(numEdges);
 }
 
 } // namespace algo_extension
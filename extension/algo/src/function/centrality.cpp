@@ -0,0 +1,494 @@
+#include <algorithm>
+#include <random>
+
+#include "binder/binder.h"
+#include "common/exception/binder.h"
+#include "common/in_mem_gds_utils.h"
+#include "common/string_utils.h"
+#include "common/task_system/progress_bar.h"
+#include "common/undirected_nbr_scanner.h"
+#include "function/algo_function.h"
+#include "function/config/centrality_config.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds/gds_vertex_compute.h"
+#include "function/table/bind_input.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+
+using namespace lbug::binder;
+using namespace lbug::common;
+using namespace lbug::processor;
+using namespace lbug::storage;
+using namespace lbug::graph;
+using namespace lbug::function;
+
+// Betweenness, closeness and harmonic centrality. Edges are treated as undirected and unweighted,
+// and self-loops and parallel edges are ignored.
+//
+// Each centrality runs one BFS per source node: Brandes' algorithm for betweenness, and plain BFS
+// distances for closeness and harmonic centrality. With the `samples` parameter, only k sources
+// (pivots) are sampled uniformly at random, so the runtime is O(k * #edges) instead of
+// O(#nodes * #edges). The BFSs of different sources run in parallel, each thread keeping its own
+// BFS state over an in-memory CSR copy of the graph.
+//
+// - Betweenness of v: sum over pairs {s, t} of the fraction of shortest s-t paths through v. With
+//   sampling, the sum of the dependencies on v of the k sources is scaled by #nodes / k.
+// - Closeness of v: (r - 1) / (sum of distances from v to the r - 1 other nodes it reaches). With
+//   sampling, only distances to the sampled sources are averaged.
+// - Harmonic centrality of v: sum of 1 / distance(v, u) over u != v. With sampling, the sum over
+//   the sampled sources is scaled by #nodes / k.
+
+namespace lbug {
+namespace algo_extension {
+
+struct CentralityOptionalParams final : public OptionalParams {
+    OptionalParam<Samples> samples;
+    OptionalParam<Seed> seed;
+    OptionalParam<Harmonic> harmonic;
+
+    CentralityOptionalParams(const expression_vector& optionalParams, bool isCloseness);
+
+    // For copy only
+    CentralityOptionalParams(OptionalParam<Samples> samples, OptionalParam<Seed> seed,
+        OptionalParam<Harmonic> harmonic)
+        : samples{std::move(samples)}, seed{std::move(seed)}, harmonic{std::move(harmonic)} {}
+
+    void evaluateParams(main::ClientContext* context) override {
+        samples.evaluateParam(context);
+        seed.evaluateParam(context);
+        harmonic.evaluateParam(context);
+    }
+
+    std::unique_ptr<OptionalParams> copy() override {
+        return std::make_unique<CentralityOptionalParams>(samples, seed, harmonic);
+    }
+};
+
+CentralityOptionalParams::CentralityOptionalParams(const expression_vector& optionalParams,
+    bool isCloseness) {
+    for (auto& optionalParam : optionalParams) {
+        auto paramName = StringUtils::getLower(optionalParam->getAlias());
+        if (paramName == Samples::NAME) {
+            samples = OptionalParam<Samples>(optionalParam);
+        } else if (paramName == Seed::NAME) {
+            seed = OptionalParam<Seed>(optionalParam);
+        } else if (isCloseness && paramName == Harmonic::NAME) {
+            harmonic = OptionalParam<Harmonic>(optionalParam);
+        } else {
+            throw BinderException{"Unknown optional parameter: " + optionalParam->getAlias()};
+        }
+    }
+}
+
+struct CentralityBindData final : public GDSBindData {
+    CentralityBindData(expression_vector columns, NativeGraphEntry graphEntry,
+        std::shared_ptr<Expression> nodeOutput,
+        std::unique_ptr<CentralityOptionalParams> optionalParams)
+        : GDSBindData{std::move(columns), std::move(graphEntry), expression_vector{nodeOutput}} {
+        this->optionalParams = std::move(optionalParams);
+    }
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<CentralityBindData>(*this);
+    }
+};
+
+// Undirected graph over all node tables of the projected graph. The nodes of table t get the IDs
+// [tableStartIDs[t], tableStartIDs[t] + maxOffset(t)).
+struct CentralityState {
+    table_id_map_t<offset_t> tableStartIDs;
+    offset_t numNodes = 0;
+    NodeOffsetMaskMap* nodeMask;
+    // The neighbors of node u are nbrs[csrOffsets[u], csrOffsets[u] + degrees[u]).
+    ku_vector_t<offset_t> csrOffsets;
+    ku_vector_t<offset_t> nbrs;
+    ku_vector_t<offset_t> degrees;
+    // The source nodes of the BFSs.
+    std::vector<offset_t> sources;
+    // Betweenness: sum of dependencies. Closeness: sum of distances. Harmonic: sum of inverse
+    // distances.
+    AtomicObjectArray<double> sums;
+    // Closeness: number of sources that reach each node, excluding the node itself.
+    AtomicObjectArray<uint64_t> numReachingSources;
+
+    CentralityState(const table_id_map_t<offset_t>& maxOffsetMap, NodeOffsetMaskMap* nodeMask,
+        MemoryManager* mm)
+        : nodeMask{nodeMask}, csrOffsets(mm), nbrs(mm), degrees(mm) {
+        for (const auto& [tableID, maxOffset] : maxOffsetMap) {
+            tableStartIDs.emplace(tableID, numNodes);
+            numNodes += maxOffset;
+        }
+        csrOffsets.resize(numNodes + 1);
+        degrees.resize(numNodes);
+        sums = AtomicObjectArray<double>(numNodes, mm, true /* initializeToZero */);
+        numReachingSources =
+            AtomicObjectArray<uint64_t>(numNodes, mm, true /* initializeToZero */);
+    }
+
+    bool isValid(nodeID_t nodeID) const {
+        return nodeMask == nullptr || !nodeMask->containsTableID(nodeID.tableID) ||
+               nodeMask->valid(nodeID);
+    }
+
+    offset_t getID(nodeID_t nodeID) const {
+        return tableStartIDs.at(nodeID.tableID) + nodeID.offset;
+    }
+
+    const offset_t* getNbrs(offset_t id) const {
+        return degrees[id] == 0 ? nullptr : &nbrs[csrOffsets[id]];
+    }
+};
+
+// Copies the neighbors of the nodes of a table into the CSR. Runs once to count the neighbors of
+// each node, including duplicates, and once to insert, sort and deduplicate them.
+class CopyNbrsVC final : public InMemParallelCompute {
+public:
+    CopyNbrsVC(Graph* graph, CentralityState& state, const bool countOnly)
+        : graph{graph}, state{state}, countOnly{countOnly} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>& tableID) override {
+        KU_ASSERT(tableID.has_value());
+        if (scanner == nullptr) {
+            scanner = std::make_unique<UndirectedNbrScanner>(graph);
+        }
+        for (auto offset = startOffset; offset < endOffset; ++offset) {
+            const auto nodeID = nodeID_t{offset, *tableID};
+            const auto id = state.getID(nodeID);
+            const auto startCSROffset = countOnly ? 0 : state.csrOffsets[id];
+            offset_t numNbrs = 0;
+            if (state.isValid(nodeID)) {
+                scanner->forEachNbr(nodeID, [&](nodeID_t nbrNodeID) {
+                    if (nbrNodeID == nodeID || !state.isValid(nbrNodeID)) {
+                        return;
+                    }
+                    if (!countOnly) {
+                        state.nbrs[startCSROffset + numNbrs] = state.getID(nbrNodeID);
+                    }
+                    numNbrs++;
+                });
+            }
+            if (countOnly) {
+                state.csrOffsets[id + 1] = numNbrs;
+                continue;
+            }
+            auto begin = state.nbrs.begin() + startCSROffset;
+            std::sort(begin, begin + numNbrs);
+            state.degrees[id] = std::unique(begin, begin + numNbrs) - begin;
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<CopyNbrsVC>(graph, state, countOnly);
+    }
+
+private:
+    Graph* graph;
+    CentralityState& state;
+    bool countOnly;
+    std::unique_ptr<UndirectedNbrScanner> scanner;
+};
+
+static void copyGraph(ExecutionContext* context, Graph* graph, CentralityState& state) {
+    auto transaction = transaction::Transaction::Get(*context->clientContext);
+    CopyNbrsVC countNbrsVC(graph, state, true /* countOnly */);
+    for (auto& [tableID, startID] : state.tableStartIDs) {
+        InMemGDSUtils::runParallelCompute(countNbrsVC, graph->getMaxOffset(transaction, tableID),
+            context, tableID);
+    }
+    for (auto id = 0u; id < state.numNodes; ++id) {
+        state.csrOffsets[id + 1] += state.csrOffsets[id];
+    }
+    state.nbrs.resize(state.csrOffsets[state.numNodes]);
+    CopyNbrsVC insertNbrsVC(graph, state, false /* countOnly */);
+    for (auto& [tableID, startID] : state.tableStartIDs) {
+        InMemGDSUtils::runParallelCompute(insertNbrsVC, graph->getMaxOffset(transaction, tableID),
+            context, tableID);
+    }
+}
+
+// Samples `numSamples` valid nodes without replacement as sources, or uses all valid nodes if
+// `numSamples` is 0 or at least the number of valid nodes. Returns the number of valid nodes.
+static offset_t sampleSources(CentralityState& state,
+    const table_id_map_t<offset_t>& maxOffsetMap, uint64_t numSamples, uint64_t seed) {
+    std::vector<offset_t> validIDs;
+    for (auto& [tableID, startID] : state.tableStartIDs) {
+        for (auto offset = 0u; offset < maxOffsetMap.at(tableID); ++offset) {
+            if (state.isValid(nodeID_t{offset, tableID})) {
+                validIDs.push_back(startID + offset);
+            }
+        }
+    }
+    const auto numValidNodes = validIDs.size();
+    if (numSamples == 0 || numSamples >= numValidNodes) {
+        state.sources = std::move(validIDs);
+    } else {
+        std::mt19937_64 rng(seed);
+        std::sample(validIDs.begin(), validIDs.end(), std::back_inserter(state.sources),
+            numSamples, rng);
+    }
+    return numValidNodes;
+}
+
+// BFS from one source. Each thread reuses one instance, and only resets the entries of the nodes
+// reached by the previous BFS.
+class SourceBFS {
+public:
+    static constexpr offset_t UNREACHED = INVALID_OFFSET;
+
+    explicit SourceBFS(offset_t numNodes) : dists(numNodes, UNREACHED), numPaths(numNodes, 0) {}
+
+    // Computes the distances from `source`, and the number of shortest paths if `countPaths`.
+    // Reached nodes are stored in `order` by ascending distance, starting with the source.
+    void run(const CentralityState& state, offset_t source, bool countPaths) {
+        for (auto id : order) {
+            dists[id] = UNREACHED;
+            numPaths[id] = 0;
+        }
+        order.clear();
+        dists[source] = 0;
+        numPaths[source] = 1;
+        order.push_back(source);
+        for (auto i = 0u; i < order.size(); ++i) {
+            const auto id = order[i];
+            const auto nbrs = state.getNbrs(id);
+            for (auto j = 0u; j < state.degrees[id]; ++j) {
+                const auto nbrID = nbrs[j];
+                if (dists[nbrID] == UNREACHED) {
+                    dists[nbrID] = dists[id] + 1;
+                    order.push_back(nbrID);
+                }
+                if (countPaths && dists[nbrID] == dists[id] + 1) {
+                    numPaths[nbrID] += numPaths[id];
+                }
+            }
+        }
+    }
+
+    std::vector<offset_t> dists;
+    // Numbers of shortest paths are kept as doubles because they grow exponentially with the
+    // distance in some graphs.
+    std::vector<double> numPaths;
+    std::vector<offset_t> order;
+};
+
+// Runs Brandes' algorithm from each source of a range: a BFS counts the shortest paths from the
+// source, then the dependencies of the source on each node are accumulated by decreasing distance.
+class BetweennessVC final : public InMemParallelCompute {
+public:
+    explicit BetweennessVC(CentralityState& state) : state{state} {}
+
+    void parallelCompute(const offset_t startIdx, const offset_t endIdx,
+        const std::optional<table_id_t>&) override {
+        if (bfs == nullptr) {
+            bfs = std::make_unique<SourceBFS>(state.numNodes);
+            dependencies.resize(state.numNodes, 0);
+        }
+        for (auto i = startIdx; i < endIdx; ++i) {
+            bfs->run(state, state.sources[i], true /* countPaths */);
+            for (auto j = bfs->order.size(); j-- > 1;) {
+                const auto id = bfs->order[j];
+                const auto nbrs = state.getNbrs(id);
+                const auto dependency = (1 + dependencies[id]) / bfs->numPaths[id];
+                for (auto k = 0u; k < state.degrees[id]; ++k) {
+                    const auto nbrID = nbrs[k];
+                    if (bfs->dists[nbrID] + 1 == bfs->dists[id]) {
+                        dependencies[nbrID] += bfs->numPaths[nbrID] * dependency;
+                    }
+                }
+                if (dependencies[id] != 0) {
+                    state.sums.fetchAdd(id, dependencies[id], std::memory_order_relaxed);
+                }
+            }
+            for (auto id : bfs->order) {
+                dependencies[id] = 0;
+            }
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<BetweennessVC>(state);
+    }
+
+private:
+    CentralityState& state;
+    std::unique_ptr<SourceBFS> bfs;
+    std::vector<double> dependencies;
+};
+
+class ClosenessVC final : public InMemParallelCompute {
+public:
+    ClosenessVC(CentralityState& state, bool harmonic) : state{state}, harmonic{harmonic} {}
+
+    void parallelCompute(const offset_t startIdx, const offset_t endIdx,
+        const std::optional<table_id_t>&) override {
+        if (bfs == nullptr) {
+            bfs = std::make_unique<SourceBFS>(state.numNodes);
+        }
+        for (auto i = startIdx; i < endIdx; ++i) {
+            bfs->run(state, state.sources[i], false /* countPaths */);
+            for (auto j = 1u; j < bfs->order.size(); ++j) {
+                const auto id = bfs->order[j];
+                const auto dist = static_cast<double>(bfs->dists[id]);
+                state.sums.fetchAdd(id, harmonic ? 1 / dist : dist, std::memory_order_relaxed);
+                if (!harmonic) {
+                    state.numReachingSources.fetchAdd(id, 1, std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<ClosenessVC>(state, harmonic);
+    }
+
+private:
+    CentralityState& state;
+    bool harmonic;
+    std::unique_ptr<SourceBFS> bfs;
+};
+
+enum class CentralityType : uint8_t { BETWEENNESS = 0, CLOSENESS = 1 };
+
+class CentralityResultVertexCompute : public GDSResultVertexCompute {
+public:
+    CentralityResultVertexCompute(MemoryManager* mm, GDSFuncSharedState* sharedState,
+        CentralityState& state, CentralityType type, bool harmonic, double scale)
+        : GDSResultVertexCompute{mm, sharedState}, state{state}, type{type}, harmonic{harmonic},
+          scale{scale} {
+        nodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        valueVector = createVector(LogicalType::DOUBLE());
+    }
+
+    void beginOnTableInternal(table_id_t tableID) override {
+        startID = state.tableStartIDs.at(tableID);
+    }
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t tableID) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            if (skip(i)) {
+                continue;
+            }
+            nodeIDVector->setValue<nodeID_t>(0, nodeID_t{i, tableID});
+            valueVector->setValue<double>(0, getValue(startID + i));
+            localFT->append(vectors);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<CentralityResultVertexCompute>(mm, sharedState, state, type,
+            harmonic, scale);
+    }
+
+private:
+    double getValue(offset_t id) {
+        const auto sum = state.sums.get(id, std::memory_order_relaxed);
+        switch (type) {
+        case CentralityType::BETWEENNESS:
+            // Brandes' algorithm counts each pair {s, t} once from s and once from t.
+            return sum * scale / 2;
+        case CentralityType::CLOSENESS: {
+            if (harmonic) {
+                return sum * scale;
+            }
+            const auto numReachingSources =
+                state.numReachingSources.get(id, std::memory_order_relaxed);
+            return sum == 0 ? 0 : numReachingSources / sum;
+        }
+        default:
+            KU_UNREACHABLE;
+        }
+    }
+
+private:
+    CentralityState& state;
+    CentralityType type;
+    bool harmonic;
+    double scale;
+    offset_t startID = 0;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> valueVector;
+};
+
+template<CentralityType TYPE>
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto clientContext = input.context->clientContext;
+    auto transaction = transaction::Transaction::Get(*clientContext);
+    auto mm = MemoryManager::Get(*clientContext);
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto graph = sharedState->graph.get();
+    auto& config = input.bindData->optionalParams->constCast<CentralityOptionalParams>();
+    const auto harmonic = config.harmonic.getParamVal();
+    auto maxOffsetMap = graph->getMaxOffsetMap(transaction);
+    auto state = CentralityState(maxOffsetMap, sharedState->getGraphNodeMaskMap(), mm);
+    copyGraph(input.context, graph, state);
+    const auto numValidNodes = sampleSources(state, maxOffsetMap, config.samples.getParamVal(),
+        config.seed.getParamVal());
+    if constexpr (TYPE == CentralityType::BETWEENNESS) {
+        BetweennessVC betweennessVC(state);
+        InMemGDSUtils::runParallelComputePerOffset(betweennessVC, state.sources.size(),
+            input.context);
+    } else {
+        ClosenessVC closenessVC(state, harmonic);
+        InMemGDSUtils::runParallelComputePerOffset(closenessVC, state.sources.size(),
+            input.context);
+    }
+    ProgressBar::Get(*clientContext)->updateProgress(input.context->queryID, 1);
+    // Sums over the sampled sources estimate the sums over all nodes.
+    const auto scale = state.sources.empty() ?
+                           0 :
+                           static_cast<double>(numValidNodes) / state.sources.size();
+    auto vertexCompute =
+        CentralityResultVertexCompute(mm, sharedState, state, TYPE, harmonic, scale);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, vertexCompute);
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static constexpr char BETWEENNESS_COLUMN_NAME[] = "betweenness";
+static constexpr char CLOSENESS_COLUMN_NAME[] = "closeness";
+
+template<CentralityType TYPE>
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    auto graphName = input->getLiteralVal<std::string>(0);
+    auto graphEntry = GDSFunction::bindGraphEntry(*context, graphName);
+    auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
+    expression_vector columns;
+    columns.push_back(nodeOutput->constCast<NodeExpression>().getInternalID());
+    const auto isCloseness = TYPE == CentralityType::CLOSENESS;
+    columns.push_back(input->binder->createVariable(
+        isCloseness ? CLOSENESS_COLUMN_NAME : BETWEENNESS_COLUMN_NAME, LogicalType::DOUBLE()));
+    return std::make_unique<CentralityBindData>(std::move(columns), std::move(graphEntry),
+        nodeOutput,
+        std::make_unique<CentralityOptionalParams>(input->optionalParamsLegacy, isCloseness));
+}
+
+template<CentralityType TYPE>
+static function_set getFunctionSet(const char* name) {
+    function_set result;
+    auto func =
+        std::make_unique<TableFunction>(name, std::vector<LogicalTypeID>{LogicalTypeID::ANY});
+    func->bindFunc = bindFunc<TYPE>;
+    func->tableFunc = tableFunc<TYPE>;
+    func->initSharedStateFunc = GDSFunction::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->getLogicalPlanFunc = GDSFunction::getLogicalPlan;
+    func->getPhysicalPlanFunc = GDSFunction::getPhysicalPlan;
+    result.push_back(std::move(func));
+    return result;
+}
+
+function_set BetweennessCentralityFunction::getFunctionSet() {
+    return algo_extension::getFunctionSet<CentralityType::BETWEENNESS>(
+        BetweennessCentralityFunction::name);
+}
+
+function_set ClosenessCentralityFunction::getFunctionSet() {
+    return algo_extension::getFunctionSet<CentralityType::CLOSENESS>(
+        ClosenessCentralityFunction::name);
+}
+
+} // namespace algo_extension
+} // namespace lbug
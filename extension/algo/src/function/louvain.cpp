@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "binder/binder.h"
 #include "common/exception/runtime.h"
 #include "common/in_mem_gds_utils.h"
@@ -33,6 +35,8 @@ using namespace lbug::function;
 //   weightedDegree(n) = sum of the weight of all edges attached to node n
 
 // The parallel Louvain implementation here follows https://hpc.pnl.gov/people/hala/grappolo.html.
+// Besides the local moving of nodes, the in-memory graph of each phase is built in parallel: the
+// neighbors of each (super)node are first counted to compute the CSR offsets and then inserted.
 
 namespace lbug {
 namespace algo_extension {
@@ -106,7 +110,9 @@ struct CommInfo {
 };
 
 struct PhaseState {
-    InMemGraph graph;
+    std::unique_ptr<InMemGraph> graph;
+    // The graph of the next phase, in which the communities of `graph` are merged into supernodes.
+    std::unique_ptr<InMemGraph> nextGraph;
     // Latest community assignments that improve the modularity.
     AtomicObjectArray<offset_t> acceptedComm;
     // New community assignments that have not yet been tested for modularity.
@@ -126,61 +132,53 @@ struct PhaseState {
     // 1/2m.
     double modularityConstant = 0.0;
 
-    PhaseState(const offset_t numNodes, MemoryManager* mm, ExecutionContext* context)
-        : graph{InMemGraph(numNodes, mm)} {
-        reinit(numNodes, mm, context);
-    }
+    PhaseState(const offset_t numNodes, MemoryManager* mm)
+        : graph{std::make_unique<InMemGraph>(numNodes, mm)},
+          nextGraph{std::make_unique<InMemGraph>(0, mm)} {}
     DELETE_BOTH_COPY(PhaseState);
 
-    void reinit(offset_t numNodes, MemoryManager* mm, ExecutionContext* context);
+    // Initializes the state of the nodes of `graph`, which must be fully built.
+    void reinit(MemoryManager* mm, ExecutionContext* context);
 
     void startNewIter(MemoryManager* mm, ExecutionContext* context);
-
-    // Initializes the next node in the sequence before inserting edges for the node.
-    void initNextNode(const offset_t nodeId) {
-        graph.initNextNode();
-        // Each community starts with one node.
-        currCommInfos.getUnsafe(nodeId).size.store(1, memory_order_relaxed);
-        currCommInfos.getUnsafe(nodeId).degree.store(0, memory_order_relaxed);
-        // Each node starts in its own community.
-        acceptedComm.set(nodeId, nodeId, memory_order_relaxed);
-        currComm.set(nodeId, nodeId, memory_order_relaxed);
-    }
-
-    // Inserts a neighbor of the last initialized node.
-    void insertNbr(const offset_t from, const offset_t to, const weight_t weight = DEFAULT_WEIGHT) {
-        graph.insertNbr(to, weight);
-        nodeWeightedDegrees.fetchAdd(from, weight, memory_order_relaxed);
-        // The weightedDegree of each community is the weightedDegree of its single node.
-        currCommInfos.getUnsafe(from).degree.fetch_add(weight, memory_order_relaxed);
-        totalWeight += weight;
-    }
-
-    void finalize() { graph.initNextNode(); }
 };
 
-class ResetPhaseStateVC final : public InMemParallelCompute {
+class InitPhaseStateVC final : public InMemParallelCompute {
 public:
-    explicit ResetPhaseStateVC(PhaseState& state) : state{state} {}
-    ~ResetPhaseStateVC() override = default;
+    InitPhaseStateVC(PhaseState& state, std::atomic<weight_t>& totalWeight)
+        : state{state}, totalWeight{totalWeight} {}
+    ~InitPhaseStateVC() override = default;
 
     void parallelCompute(const offset_t startOffset, const offset_t endOffset,
         const std::optional<table_id_t>&) override {
+        weight_t totalWeightLocal = 0;
         for (auto nodeId = startOffset; nodeId < endOffset; ++nodeId) {
-            state.nodeWeightedDegrees.set(nodeId, 0, memory_order_relaxed);
+            weight_t weightedDegree = 0;
+            const auto endCSROffset = state.graph->csrOffsets[nodeId + 1];
+            for (auto offset = state.graph->csrOffsets[nodeId]; offset < endCSROffset; ++offset) {
+                weightedDegree += state.graph->csrEdges[offset].weight;
+            }
+            state.nodeWeightedDegrees.set(nodeId, weightedDegree, memory_order_relaxed);
+            // Each node starts in its own community, whose weightedDegree is that of the node.
             state.currCommInfos.set(nodeId, CommInfo());
-            state.acceptedComm.set(nodeId, UNASSIGNED_COMM, memory_order_relaxed);
-            state.currComm.set(nodeId, UNASSIGNED_COMM, memory_order_relaxed);
+            state.currCommInfos.getUnsafe(nodeId).size.store(1, memory_order_relaxed);
+            state.currCommInfos.getUnsafe(nodeId).degree.store(weightedDegree,
+                memory_order_relaxed);
+            state.acceptedComm.set(nodeId, nodeId, memory_order_relaxed);
+            state.currComm.set(nodeId, nodeId, memory_order_relaxed);
             state.nextComm.set(nodeId, UNASSIGNED_COMM, memory_order_relaxed);
+            totalWeightLocal += weightedDegree;
         }
+        totalWeight.fetch_add(totalWeightLocal);
     }
 
     std::unique_ptr<InMemParallelCompute> copy() override {
-        return std::make_unique<ResetPhaseStateVC>(state);
+        return std::make_unique<InitPhaseStateVC>(state, totalWeight);
     }
 
 private:
     PhaseState& state;
+    std::atomic<weight_t>& totalWeight;
 };
 
 class StartNewIterVC final : public InMemParallelCompute {
@@ -204,26 +202,27 @@ private:
     PhaseState& state;
 };
 
-void PhaseState::reinit(const offset_t numNodes, MemoryManager* mm, ExecutionContext* context) {
+void PhaseState::reinit(MemoryManager* mm, ExecutionContext* context) {
     // All objects reuse allocations because `numNodes` monotonically decreases over phases.
-    totalWeight = 0;
-    graph.reinit(numNodes);
+    const auto numNodes = graph->numNodes;
     nodeWeightedDegrees.reallocate(numNodes, mm);
     currCommInfos.reallocate(numNodes, mm);
     acceptedComm.reallocate(numNodes, mm);
     currComm.reallocate(numNodes, mm);
     nextComm.reallocate(numNodes, mm);
 
-    ResetPhaseStateVC resetPhaseStateVC(*this);
-    InMemGDSUtils::runParallelCompute(resetPhaseStateVC, numNodes, context);
+    std::atomic<weight_t> sumWeightedDegrees{0};
+    InitPhaseStateVC initPhaseStateVC(*this, sumWeightedDegrees);
+    InMemGDSUtils::runParallelCompute(initPhaseStateVC, numNodes, context);
+    totalWeight = sumWeightedDegrees.load();
 }
 
 void PhaseState::startNewIter(MemoryManager* mm, ExecutionContext* context) {
-    selfCommWeights.reallocate(graph.numNodes, mm);
-    nextCommInfos.reallocate(graph.numNodes, mm);
+    selfCommWeights.reallocate(graph->numNodes, mm);
+    nextCommInfos.reallocate(graph->numNodes, mm);
 
     StartNewIterVC startNewIterVC(*this);
-    InMemGDSUtils::runParallelCompute(startNewIterVC, graph.numNodes, context);
+    InMemGDSUtils::runParallelCompute(startNewIterVC, graph->numNodes, context);
 
     modularityConstant = 1.0 / totalWeight;
 }
@@ -285,8 +284,8 @@ public:
         // Stores the mapping from communities to an index in `intraCommWeights`.
         unordered_map<offset_t, offset_t> commToWeightsIndex;
         for (auto nodeId = startOffset; nodeId < endOffset; ++nodeId) {
-            const auto startCSROffset = state.graph.csrOffsets[nodeId];
-            const auto endCSROffset = state.graph.csrOffsets[nodeId + 1];
+            const auto startCSROffset = state.graph->csrOffsets[nodeId];
+            const auto endCSROffset = state.graph->csrOffsets[nodeId + 1];
             offset_t targetCommId = UNASSIGNED_COMM;
             if (startCSROffset != endCSROffset) {
                 commToWeightsIndex.clear();
@@ -325,7 +324,7 @@ public:
         intraCommWeights.push_back(0);
         offset_t nextIndex = 1;
         for (auto offset = startCSROffset; offset < endCSROffset; offset++) {
-            auto nbrEntry = state.graph.csrEdges[offset];
+            auto nbrEntry = state.graph->csrEdges[offset];
             if (nbrEntry.neighbor == nodeId) {
                 selfLoopWeight += nbrEntry.weight;
             }
@@ -491,84 +490,197 @@ private:
     unique_ptr<ValueVector> componentIDVector;
 };
 
-void initInMemoryGraph(const table_id_t tableId, const offset_t numNodes, Graph* graph,
-    PhaseState& state) {
-    const auto nbrTables = graph->getRelInfos(tableId);
-    const auto nbrInfo = nbrTables[0];
-    KU_ASSERT(nbrInfo.srcTableID == nbrInfo.dstTableID);
-    // Set randomLookup to false to enable caching during graph materialization.
-    const auto scanState = graph->prepareRelScan(*nbrInfo.relGroupEntry, nbrInfo.relTableID,
-        nbrInfo.dstTableID, {}, false /*randomLookup*/);
-
-    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
-        state.initNextNode(nodeId);
-        const nodeID_t nextNodeId = {nodeId, tableId};
-        for (auto chunk : graph->scanFwd(nextNodeId, *scanState)) {
-            chunk.forEach([&](auto neighbors, auto, auto i) {
-                auto nbrId = neighbors[i].offset;
-                state.insertNbr(nodeId, nbrId);
-            });
+// Materializes the projected graph as an undirected in-memory graph. Edges are inserted in both
+// directions, except for self-loops. Runs once to count the neighbors of each node and once to
+// insert them.
+class InitInMemGraphVC final : public InMemParallelCompute {
+public:
+    InitInMemGraphVC(Graph* graph, GraphRelInfo relInfo, const table_id_t tableId,
+        InMemGraph& inMemGraph, const bool countOnly)
+        : graph{graph}, relInfo{std::move(relInfo)}, tableId{tableId}, inMemGraph{inMemGraph},
+          countOnly{countOnly} {}
+    ~InitInMemGraphVC() override = default;
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        if (scanState == nullptr) {
+            // Set randomLookup to false to enable caching during graph materialization.
+            scanState = graph->prepareRelScan(*relInfo.relGroupEntry, relInfo.relTableID,
+                relInfo.dstTableID, {}, false /*randomLookup*/);
         }
-        for (auto chunk : graph->scanBwd(nextNodeId, *scanState)) {
-            chunk.forEach([&](auto neighbors, auto, auto i) {
-                auto nbrId = neighbors[i].offset;
-                if (nbrId != nodeId) {
-                    state.insertNbr(nodeId, nbrId);
+        for (auto nodeId = startOffset; nodeId < endOffset; ++nodeId) {
+            const auto startCSROffset = countOnly ? 0 : inMemGraph.csrOffsets[nodeId];
+            offset_t numNbrs = 0;
+            auto insertNbr = [&](offset_t nbrId) {
+                if (!countOnly) {
+                    inMemGraph.setNbr(startCSROffset + numNbrs, nbrId);
                 }
-            });
+                numNbrs++;
+            };
+            const nodeID_t nextNodeId = {nodeId, tableId};
+            for (auto chunk : graph->scanFwd(nextNodeId, *scanState)) {
+                chunk.forEach(
+                    [&](auto neighbors, auto, auto i) { insertNbr(neighbors[i].offset); });
+            }
+            for (auto chunk : graph->scanBwd(nextNodeId, *scanState)) {
+                chunk.forEach([&](auto neighbors, auto, auto i) {
+                    auto nbrId = neighbors[i].offset;
+                    if (nbrId != nodeId) {
+                        insertNbr(nbrId);
+                    }
+                });
+            }
+            if (countOnly) {
+                inMemGraph.setNumNbrs(nodeId, numNbrs);
+            }
         }
     }
-    state.finalize();
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<InitInMemGraphVC>(graph, relInfo, tableId, inMemGraph, countOnly);
+    }
+
+private:
+    Graph* graph;
+    GraphRelInfo relInfo;
+    table_id_t tableId;
+    InMemGraph& inMemGraph;
+    bool countOnly;
+    std::unique_ptr<NbrScanState> scanState;
+};
+
+void initInMemoryGraph(const table_id_t tableId, Graph* graph, InMemGraph& inMemGraph,
+    ExecutionContext* context) {
+    const auto nbrTables = graph->getRelInfos(tableId);
+    const auto nbrInfo = nbrTables[0];
+    KU_ASSERT(nbrInfo.srcTableID == nbrInfo.dstTableID);
+    InitInMemGraphVC countNbrsVC(graph, nbrInfo, tableId, inMemGraph, true /* countOnly */);
+    InMemGDSUtils::runParallelCompute(countNbrsVC, inMemGraph.numNodes, context);
+    inMemGraph.initEdges();
+    InitInMemGraphVC insertNbrsVC(graph, nbrInfo, tableId, inMemGraph, false /* countOnly */);
+    InMemGDSUtils::runParallelCompute(insertNbrsVC, inMemGraph.numNodes, context);
 }
 
 // Sequentially renumber the communities, each of which becomes a new node in the next phase.
-offset_t renumberCommunities(PhaseState& state) {
-    unordered_map<offset_t, offset_t> map;
+offset_t renumberCommunities(PhaseState& state, MemoryManager* mm) {
+    ku_vector_t<offset_t> newCommIds(mm, state.graph->numNodes);
+    std::fill(newCommIds.begin(), newCommIds.end(), UNASSIGNED_COMM);
     offset_t nextCommId = 0;
-    for (auto nodeId = 0LU; nodeId < state.graph.numNodes; ++nodeId) {
+    for (auto nodeId = 0LU; nodeId < state.graph->numNodes; ++nodeId) {
         auto commId = state.acceptedComm.get(nodeId, memory_order_relaxed);
         if (commId == UNASSIGNED_COMM) {
             // Skip creating communities for isolated nodes.
             continue;
         }
-        if (!map.contains(commId)) {
-            map.insert(make_pair(commId, nextCommId));
+        if (newCommIds[commId] == UNASSIGNED_COMM) {
+            newCommIds[commId] = nextCommId;
             nextCommId++;
         }
-        state.acceptedComm.set(nodeId, map.at(commId), memory_order_relaxed);
+        state.acceptedComm.set(nodeId, newCommIds[commId], memory_order_relaxed);
     }
     return nextCommId;
 }
 
-void aggregateCommunities(const offset_t newCommCount, PhaseState& state, MemoryManager* mm,
-    ExecutionContext* context) {
-    ku_vector_t<unordered_map<offset_t, weight_t>> commWeights(mm);
-    commWeights.resize(newCommCount);
-    for (auto nodeId = 0u; nodeId < state.graph.numNodes; nodeId++) {
-        const auto beginCSROffset = state.graph.csrOffsets[nodeId];
-        const auto endCSROffset = state.graph.csrOffsets[nodeId + 1];
-        auto commId = state.acceptedComm.get(nodeId, memory_order_relaxed);
-        for (auto offset = beginCSROffset; offset < endCSROffset; ++offset) {
-            const auto nbr = state.graph.csrEdges[offset];
-            auto nbrCommId = state.acceptedComm.get(nbr.neighbor, memory_order_relaxed);
-            if (commId >= nbrCommId) {
-                // New forward edge.
-                commWeights[commId][nbrCommId] += nbr.weight;
-                if (commId != nbrCommId) {
-                    // New backward edge, skipping self-loops.
-                    commWeights[nbrCommId][commId] += nbr.weight;
-                }
+// The nodes of each community in CSR format: community c consists of nodes
+// [offsets[c], offsets[c + 1]).
+struct CommMembers {
+    ku_vector_t<offset_t> offsets;
+    ku_vector_t<offset_t> nodes;
+
+    CommMembers(PhaseState& state, const offset_t numComms, MemoryManager* mm)
+        : offsets(mm, numComms + 1), nodes(mm) {
+        const auto numNodes = state.graph->numNodes;
+        for (auto nodeId = 0LU; nodeId < numNodes; ++nodeId) {
+            const auto commId = state.acceptedComm.get(nodeId, memory_order_relaxed);
+            if (commId != UNASSIGNED_COMM) {
+                offsets[commId + 1]++;
             }
         }
+        for (auto commId = 0LU; commId < numComms; ++commId) {
+            offsets[commId + 1] += offsets[commId];
+        }
+        nodes.resize(offsets[numComms]);
+        // Use offsets[c] as the next insert position of community c, then shift the offsets back.
+        for (auto nodeId = 0LU; nodeId < numNodes; ++nodeId) {
+            const auto commId = state.acceptedComm.get(nodeId, memory_order_relaxed);
+            if (commId != UNASSIGNED_COMM) {
+                nodes[offsets[commId]++] = nodeId;
+            }
+        }
+        for (auto commId = numComms; commId > 0; --commId) {
+            offsets[commId] = offsets[commId - 1];
+        }
+        offsets[0] = 0;
     }
-    state.reinit(newCommCount, mm, context);
-    for (auto nodeId = 0u; nodeId < newCommCount; nodeId++) {
-        state.initNextNode(nodeId);
-        for (auto [nbrId, weight] : commWeights[nodeId]) {
-            state.insertNbr(nodeId, nbrId, weight);
+};
+
+// Builds the next phase's graph in which every community is a supernode. The edge weight between
+// two supernodes is the sum of the weights of the edges across the two communities, and the weight
+// of the self-loop of a supernode is the sum of the weights of the edges within the community,
+// counted in both directions. Runs once to count the neighbors of each supernode and once to
+// insert them.
+class AggregateCommunitiesVC final : public InMemParallelCompute {
+public:
+    AggregateCommunitiesVC(PhaseState& state, const CommMembers& members, const bool countOnly)
+        : state{state}, members{members}, countOnly{countOnly} {}
+    ~AggregateCommunitiesVC() override = default;
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        unordered_map<offset_t, weight_t> nbrCommWeights;
+        vector<Neighbor> nbrs;
+        for (auto commId = startOffset; commId < endOffset; ++commId) {
+            nbrCommWeights.clear();
+            const auto endMemberOffset = members.offsets[commId + 1];
+            for (auto i = members.offsets[commId]; i < endMemberOffset; ++i) {
+                const auto nodeId = members.nodes[i];
+                const auto endCSROffset = state.graph->csrOffsets[nodeId + 1];
+                for (auto offset = state.graph->csrOffsets[nodeId]; offset < endCSROffset;
+                     ++offset) {
+                    const auto nbr = state.graph->csrEdges[offset];
+                    auto nbrCommId = state.acceptedComm.get(nbr.neighbor, memory_order_relaxed);
+                    nbrCommWeights[nbrCommId] += nbr.weight;
+                }
+            }
+            if (countOnly) {
+                state.nextGraph->setNumNbrs(commId, nbrCommWeights.size());
+                continue;
+            }
+            nbrs.clear();
+            for (auto [nbrCommId, weight] : nbrCommWeights) {
+                nbrs.emplace_back(nbrCommId, weight);
+            }
+            // Keep the supernode's neighbors independent of the hash map's iteration order.
+            std::sort(nbrs.begin(), nbrs.end(),
+                [](const Neighbor& a, const Neighbor& b) { return a.neighbor < b.neighbor; });
+            auto csrOffset = state.nextGraph->csrOffsets[commId];
+            for (auto& nbr : nbrs) {
+                state.nextGraph->setNbr(csrOffset++, nbr.neighbor, nbr.weight);
+            }
         }
     }
-    state.finalize();
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<AggregateCommunitiesVC>(state, members, countOnly);
+    }
+
+private:
+    PhaseState& state;
+    const CommMembers& members;
+    bool countOnly;
+};
+
+void aggregateCommunities(const offset_t newCommCount, PhaseState& state, MemoryManager* mm,
+    ExecutionContext* context) {
+    const CommMembers members(state, newCommCount, mm);
+    state.nextGraph->reinit(newCommCount);
+    AggregateCommunitiesVC countNbrsVC(state, members, true /* countOnly */);
+    InMemGDSUtils::runParallelCompute(countNbrsVC, newCommCount, context);
+    state.nextGraph->initEdges();
+    AggregateCommunitiesVC insertNbrsVC(state, members, false /* countOnly */);
+    InMemGDSUtils::runParallelCompute(insertNbrsVC, newCommCount, context);
+    std::swap(state.graph, state.nextGraph);
+    state.reinit(mm, context);
 }
 
 static common::offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
@@ -589,10 +701,11 @@ static common::offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&)
     const auto steps = config.maxPhases.getParamVal() * config.maxIterations.getParamVal();
 
     FinalResults finalResults(origNumNodes);
-    PhaseState state(origNumNodes, mm, input.context);
+    PhaseState state(origNumNodes, mm);
 
     // Create the initial in-memory graph.
-    initInMemoryGraph(tableID, origNumNodes, graph, state);
+    initInMemoryGraph(tableID, graph, *state.graph, input.context);
+    state.reinit(mm, input.context);
 
     // Each phases attempts to decrease the number of communities by merging nodes into supernodes.
     for (auto phase = 0u; phase < config.maxPhases.getParamVal(); ++phase) {
@@ -609,7 +722,7 @@ static common::offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&)
             // community increases the graph modularity. Note that the new community assignments are
             // sensitive to the order in which the nodes are processed.
             RunIterationVC runIteration(state);
-            InMemGDSUtils::runParallelCompute(runIteration, state.graph.numNodes, input.context);
+            InMemGDSUtils::runParallelCompute(runIteration, state.graph->numNodes, input.context);
 
             progressBar->updateProgress(input.context->queryID, progress * 0.5);
 
@@ -618,7 +731,8 @@ static common::offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&)
             std::atomic<weight_t> sumIntraWeights{0};
             std::atomic<weight_t> sumWeightedDegrees{0};
             ComputeModularityVC newModularityVC(state, sumIntraWeights, sumWeightedDegrees);
-            InMemGDSUtils::runParallelCompute(newModularityVC, state.graph.numNodes, input.context);
+            InMemGDSUtils::runParallelCompute(newModularityVC, state.graph->numNodes,
+                input.context);
             const double currMod =
                 sumIntraWeights.load() * state.modularityConstant -
                 (sumWeightedDegrees.load() * state.modularityConstant * state.modularityConstant);
@@ -632,7 +746,7 @@ static common::offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&)
             oldMod = currMod;
             // nextCommInfo -> currCommInfo.
             UpdateCommInfosVC updateCommInfosVC(state);
-            InMemGDSUtils::runParallelCompute(updateCommInfosVC, state.graph.numNodes,
+            InMemGDSUtils::runParallelCompute(updateCommInfosVC, state.graph->numNodes,
                 input.context);
 
             // Save `currComm` to `acceptedComm`.
@@ -642,8 +756,8 @@ static common::offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&)
 
             progressBar->updateProgress(input.context->queryID, progress);
         }
-        const auto oldCommCount = state.graph.numNodes;
-        const auto newCommCount = renumberCommunities(state);
+        const auto oldCommCount = state.graph->numNodes;
+        const auto newCommCount = renumberCommunities(state, mm);
 
         // Save the renumbered communities as output.
         SaveCommAssignmentsVC setFinalComms(phase, finalResults, state);
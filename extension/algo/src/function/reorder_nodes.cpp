@@ -0,0 +1,268 @@
+#include <algorithm>
+#include <deque>
+
+#include "binder/binder.h"
+#include "common/exception/binder.h"
+#include "common/string_utils.h"
+#include "common/undirected_nbr_scanner.h"
+#include "common/task_system/progress_bar.h"
+#include "function/algo_function.h"
+#include "function/config/reorder_nodes_config.h"
+#include "function/degrees.h"
+#include "function/gds/gds_vertex_compute.h"
+#include "function/table/bind_input.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+
+using namespace lbug::processor;
+using namespace lbug::common;
+using namespace lbug::binder;
+using namespace lbug::storage;
+using namespace lbug::graph;
+using namespace lbug::function;
+
+namespace lbug {
+namespace algo_extension {
+
+// Computes a locality-improving order of the nodes of a projected graph. For each node, the output
+// is its offset in its table if the table is copied again in this order, e.g.
+//   COPY person FROM (CALL reorder_nodes('G') WITH node, new_offset ORDER BY new_offset ...)
+// Neighbours that get close offsets land in the same node groups and CSR pages, so recursive
+// joins and graph algorithms touch fewer pages per frontier.
+//
+// RCM (reverse Cuthill-McKee): starting from an unvisited node of minimum degree, run a BFS that
+// visits the neighbours of each node by ascending degree, number the nodes in BFS order, and
+// reverse the numbering at the end. Edges are treated as undirected.
+// Degree: nodes are numbered by descending degree.
+// Ties are broken by the original node ID so that the order is deterministic.
+
+struct ReorderNodesOptionalParams final : public OptionalParams {
+    OptionalParam<ReorderStrategy> strategy;
+
+    explicit ReorderNodesOptionalParams(const expression_vector& optionalParams);
+
+    // For copy only
+    explicit ReorderNodesOptionalParams(OptionalParam<ReorderStrategy> strategy)
+        : strategy{std::move(strategy)} {}
+
+    void evaluateParams(main::ClientContext* context) override { strategy.evaluateParam(context); }
+
+    std::unique_ptr<OptionalParams> copy() override {
+        return std::make_unique<ReorderNodesOptionalParams>(strategy);
+    }
+};
+
+ReorderNodesOptionalParams::ReorderNodesOptionalParams(const expression_vector& optionalParams) {
+    for (auto& optionalParam : optionalParams) {
+        auto paramName = StringUtils::getLower(optionalParam->getAlias());
+        if (paramName == ReorderStrategy::NAME) {
+            strategy = OptionalParam<ReorderStrategy>(optionalParam);
+        } else {
+            throw BinderException{"Unknown optional parameter: " + optionalParam->getAlias()};
+        }
+    }
+}
+
+struct ReorderNodesBindData final : public GDSBindData {
+    ReorderNodesBindData(expression_vector columns, NativeGraphEntry graphEntry,
+        std::shared_ptr<Expression> nodeOutput,
+        std::unique_ptr<ReorderNodesOptionalParams> optionalParams)
+        : GDSBindData{std::move(columns), std::move(graphEntry), expression_vector{nodeOutput}} {
+        this->optionalParams = std::move(optionalParams);
+    }
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<ReorderNodesBindData>(*this);
+    }
+};
+
+class NewOffsets {
+public:
+    NewOffsets(const table_id_map_t<offset_t>& maxOffsetMap, MemoryManager* mm) {
+        for (const auto& [tableID, maxOffset] : maxOffsetMap) {
+            newOffsetsMap.allocate(tableID, maxOffset, mm);
+        }
+    }
+
+    void pinTable(table_id_t tableID) { newOffsets = newOffsetsMap.getData(tableID); }
+
+    offset_t getValue(offset_t offset) const { return newOffsets[offset]; }
+
+    void setValue(nodeID_t nodeID, offset_t newOffset) {
+        newOffsetsMap.getData(nodeID.tableID)[nodeID.offset] = newOffset;
+    }
+
+private:
+    offset_t* newOffsets = nullptr;
+    GDSDenseObjectManager<offset_t> newOffsetsMap;
+};
+
+class RCMOrder {
+public:
+    RCMOrder(Graph* graph, const table_id_map_t<offset_t>& maxOffsetMap, Degrees& degrees)
+        : scanner{graph}, degrees{degrees} {
+        for (const auto& [tableID, maxOffset] : maxOffsetMap) {
+            visited[tableID].resize(maxOffset, false);
+        }
+    }
+
+    // Returns the nodes in RCM order. Nodes are visited starting from the given nodes in order.
+    std::vector<nodeID_t> compute(const std::vector<nodeID_t>& nodeIDs) {
+        std::vector<nodeID_t> result;
+        result.reserve(nodeIDs.size());
+        std::deque<nodeID_t> queue;
+        std::vector<nodeID_t> nbrNodeIDs;
+        for (auto& startNodeID : nodeIDs) {
+            if (visited.at(startNodeID.tableID)[startNodeID.offset]) {
+                continue;
+            }
+            visited.at(startNodeID.tableID)[startNodeID.offset] = true;
+            queue.push_back(startNodeID);
+            while (!queue.empty()) {
+                auto nodeID = queue.front();
+                queue.pop_front();
+                result.push_back(nodeID);
+                nbrNodeIDs.clear();
+                scanner.forEachNbr(nodeID, [&](nodeID_t nbrNodeID) {
+                    if (!visited.at(nbrNodeID.tableID)[nbrNodeID.offset]) {
+                        visited.at(nbrNodeID.tableID)[nbrNodeID.offset] = true;
+                        nbrNodeIDs.push_back(nbrNodeID);
+                    }
+                });
+                sortByDegree(nbrNodeIDs, true /* ascending */);
+                queue.insert(queue.end(), nbrNodeIDs.begin(), nbrNodeIDs.end());
+            }
+        }
+        std::reverse(result.begin(), result.end());
+        return result;
+    }
+
+    void sortByDegree(std::vector<nodeID_t>& nodeIDs, bool ascending) {
+        std::vector<std::pair<degree_t, nodeID_t>> entries;
+        entries.reserve(nodeIDs.size());
+        for (auto& nodeID : nodeIDs) {
+            degrees.pinTable(nodeID.tableID);
+            entries.emplace_back(degrees.getValue(nodeID.offset), nodeID);
+        }
+        std::sort(entries.begin(), entries.end(), [&](const auto& a, const auto& b) {
+            if (a.first != b.first) {
+                return ascending ? a.first < b.first : a.first > b.first;
+            }
+            return a.second < b.second;
+        });
+        for (auto i = 0u; i < entries.size(); ++i) {
+            nodeIDs[i] = entries[i].second;
+        }
+    }
+
+private:
+    UndirectedNbrScanner scanner;
+    Degrees& degrees;
+    table_id_map_t<std::vector<bool>> visited;
+};
+
+class ReorderNodesResultVertexCompute : public GDSResultVertexCompute {
+public:
+    ReorderNodesResultVertexCompute(MemoryManager* mm, GDSFuncSharedState* sharedState,
+        NewOffsets& newOffsets)
+        : GDSResultVertexCompute{mm, sharedState}, newOffsets{newOffsets} {
+        nodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        newOffsetVector = createVector(LogicalType::UINT64());
+    }
+
+    void beginOnTableInternal(table_id_t tableID) override { newOffsets.pinTable(tableID); }
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t tableID) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            if (skip(i)) {
+                continue;
+            }
+            nodeIDVector->setValue<nodeID_t>(0, nodeID_t{i, tableID});
+            newOffsetVector->setValue<uint64_t>(0, newOffsets.getValue(i));
+            localFT->append(vectors);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<ReorderNodesResultVertexCompute>(mm, sharedState, newOffsets);
+    }
+
+private:
+    NewOffsets& newOffsets;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> newOffsetVector;
+};
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto clientContext = input.context->clientContext;
+    auto transaction = transaction::Transaction::Get(*clientContext);
+    auto mm = MemoryManager::Get(*clientContext);
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto graph = sharedState->graph.get();
+    auto nodeMask = sharedState->getGraphNodeMaskMap();
+    auto& config = input.bindData->optionalParams->constCast<ReorderNodesOptionalParams>();
+    auto maxOffsetMap = graph->getMaxOffsetMap(transaction);
+    auto degrees = Degrees(maxOffsetMap, mm);
+    DegreesUtils::computeDegree(input.context, graph, nodeMask, &degrees, ExtendDirection::BOTH);
+    std::vector<nodeID_t> nodeIDs;
+    for (auto tableID : graph->getNodeTableIDs()) {
+        auto hasMask = nodeMask != nullptr && nodeMask->containsTableID(tableID);
+        for (auto offset = 0u; offset < maxOffsetMap.at(tableID); ++offset) {
+            auto nodeID = nodeID_t{offset, tableID};
+            if (hasMask && !nodeMask->valid(nodeID)) {
+                continue;
+            }
+            nodeIDs.push_back(nodeID);
+        }
+    }
+    auto rcmOrder = RCMOrder(graph, maxOffsetMap, degrees);
+    if (config.strategy.getParamVal() == ReorderStrategy::RCM) {
+        rcmOrder.sortByDegree(nodeIDs, true /* ascending */);
+        nodeIDs = rcmOrder.compute(nodeIDs);
+    } else {
+        rcmOrder.sortByDegree(nodeIDs, false /* ascending */);
+    }
+    ProgressBar::Get(*clientContext)->updateProgress(input.context->queryID, 1);
+    auto newOffsets = NewOffsets(maxOffsetMap, mm);
+    table_id_map_t<offset_t> numNodesPerTable;
+    for (auto& nodeID : nodeIDs) {
+        newOffsets.setValue(nodeID, numNodesPerTable[nodeID.tableID]++);
+    }
+    auto vertexCompute = ReorderNodesResultVertexCompute(mm, sharedState, newOffsets);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, vertexCompute);
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static constexpr char NEW_OFFSET_COLUMN_NAME[] = "new_offset";
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    auto graphName = input->getLiteralVal<std::string>(0);
+    auto graphEntry = GDSFunction::bindGraphEntry(*context, graphName);
+    auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
+    expression_vector columns;
+    columns.push_back(nodeOutput->constCast<NodeExpression>().getInternalID());
+    columns.push_back(
+        input->binder->createVariable(NEW_OFFSET_COLUMN_NAME, LogicalType::UINT64()));
+    return std::make_unique<ReorderNodesBindData>(std::move(columns), std::move(graphEntry),
+        nodeOutput, std::make_unique<ReorderNodesOptionalParams>(input->optionalParamsLegacy));
+}
+
+function_set ReorderNodesFunction::getFunctionSet() {
+    function_set result;
+    auto func = std::make_unique<TableFunction>(ReorderNodesFunction::name,
+        std::vector<LogicalTypeID>{LogicalTypeID::ANY});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = GDSFunction::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->getLogicalPlanFunc = GDSFunction::getLogicalPlan;
+    func->getPhysicalPlanFunc = GDSFunction::getPhysicalPlan;
+    result.push_back(std::move(func));
+    return result;
+}
+
+} // namespace algo_extension
+} // namespace lbug
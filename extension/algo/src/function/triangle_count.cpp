@@ -0,0 +1,330 @@
+#include <algorithm>
+
+#include "binder/binder.h"
+#include "common/in_mem_gds_utils.h"
+#include "common/sorted_set_intersection.h"
+#include "common/task_system/progress_bar.h"
+#include "common/undirected_nbr_scanner.h"
+#include "function/algo_function.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds/gds_vertex_compute.h"
+#include "function/table/bind_input.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+
+using namespace lbug::binder;
+using namespace lbug::common;
+using namespace lbug::processor;
+using namespace lbug::storage;
+using namespace lbug::graph;
+using namespace lbug::function;
+
+// Triangle counting and local clustering coefficient. Edges are treated as undirected, and
+// self-loops and parallel edges are ignored.
+//
+// The projected graph is copied into a CSR in which each node's neighbors are sorted by node ID,
+// and each edge is oriented from the endpoint of lower rank (degree, then node ID) to the one of
+// higher rank. Every triangle is then found exactly once as the intersection of the higher-rank
+// neighbors of the two endpoints of its lowest-rank edge, and the number of higher-rank neighbors
+// of any node is O(sqrt(#edges)), which bounds the cost of intersecting lists around hubs.
+//
+// The local clustering coefficient of a node with degree d and t triangles is 2t / (d * (d - 1)).
+
+namespace lbug {
+namespace algo_extension {
+
+// Undirected graph over all node tables of the projected graph. The nodes of table t get the IDs
+// [tableStartIDs[t], tableStartIDs[t] + maxOffset(t)).
+struct TriangleCountState {
+    table_id_map_t<offset_t> tableStartIDs;
+    offset_t numNodes = 0;
+    NodeOffsetMaskMap* nodeMask;
+    // The neighbors of node u are nbrs[csrOffsets[u], csrOffsets[u] + degrees[u]), with the
+    // numHigherRankNbrs[u] neighbors of higher rank first. Both parts are sorted by node ID.
+    ku_vector_t<offset_t> csrOffsets;
+    ku_vector_t<offset_t> nbrs;
+    ku_vector_t<offset_t> degrees;
+    ku_vector_t<offset_t> numHigherRankNbrs;
+    AtomicObjectArray<uint64_t> numTriangles;
+
+    TriangleCountState(const table_id_map_t<offset_t>& maxOffsetMap, NodeOffsetMaskMap* nodeMask,
+        MemoryManager* mm)
+        : nodeMask{nodeMask}, csrOffsets(mm), nbrs(mm), degrees(mm), numHigherRankNbrs(mm) {
+        for (const auto& [tableID, maxOffset] : maxOffsetMap) {
+            tableStartIDs.emplace(tableID, numNodes);
+            numNodes += maxOffset;
+        }
+        csrOffsets.resize(numNodes + 1);
+        degrees.resize(numNodes);
+        numHigherRankNbrs.resize(numNodes);
+        numTriangles = AtomicObjectArray<uint64_t>(numNodes, mm, true /* initializeToZero */);
+    }
+
+    bool isValid(nodeID_t nodeID) const {
+        return nodeMask == nullptr || !nodeMask->containsTableID(nodeID.tableID) ||
+               nodeMask->valid(nodeID);
+    }
+
+    offset_t getID(nodeID_t nodeID) const {
+        return tableStartIDs.at(nodeID.tableID) + nodeID.offset;
+    }
+
+    bool hasHigherRank(offset_t u, offset_t v) const {
+        return degrees[u] > degrees[v] || (degrees[u] == degrees[v] && u > v);
+    }
+};
+
+// Copies the neighbors of the nodes of a table into the CSR. Runs once to count the neighbors of
+// each node, including duplicates, and once to insert, sort and deduplicate them.
+class CopyNbrsVC final : public InMemParallelCompute {
+public:
+    CopyNbrsVC(Graph* graph, TriangleCountState& state, const bool countOnly)
+        : graph{graph}, state{state}, countOnly{countOnly} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>& tableID) override {
+        KU_ASSERT(tableID.has_value());
+        if (scanner == nullptr) {
+            scanner = std::make_unique<UndirectedNbrScanner>(graph);
+        }
+        for (auto offset = startOffset; offset < endOffset; ++offset) {
+            const auto nodeID = nodeID_t{offset, *tableID};
+            const auto id = state.getID(nodeID);
+            const auto startCSROffset = countOnly ? 0 : state.csrOffsets[id];
+            offset_t numNbrs = 0;
+            if (state.isValid(nodeID)) {
+                scanner->forEachNbr(nodeID, [&](nodeID_t nbrNodeID) {
+                    if (nbrNodeID == nodeID || !state.isValid(nbrNodeID)) {
+                        return;
+                    }
+                    if (!countOnly) {
+                        state.nbrs[startCSROffset + numNbrs] = state.getID(nbrNodeID);
+                    }
+                    numNbrs++;
+                });
+            }
+            if (countOnly) {
+                state.csrOffsets[id + 1] = numNbrs;
+                continue;
+            }
+            auto begin = state.nbrs.begin() + startCSROffset;
+            std::sort(begin, begin + numNbrs);
+            state.degrees[id] = std::unique(begin, begin + numNbrs) - begin;
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<CopyNbrsVC>(graph, state, countOnly);
+    }
+
+private:
+    Graph* graph;
+    TriangleCountState& state;
+    bool countOnly;
+    std::unique_ptr<UndirectedNbrScanner> scanner;
+};
+
+// Moves the neighbors of higher rank of each node to the front, keeping both parts sorted.
+class OrientEdgesVC final : public InMemParallelCompute {
+public:
+    explicit OrientEdgesVC(TriangleCountState& state) : state{state} {}
+
+    void parallelCompute(const offset_t startID, const offset_t endID,
+        const std::optional<table_id_t>&) override {
+        for (auto id = startID; id < endID; ++id) {
+            auto begin = state.nbrs.begin() + state.csrOffsets[id];
+            auto mid = std::stable_partition(begin, begin + state.degrees[id],
+                [&](offset_t nbrID) { return state.hasHigherRank(nbrID, id); });
+            state.numHigherRankNbrs[id] = mid - begin;
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<OrientEdgesVC>(state);
+    }
+
+private:
+    TriangleCountState& state;
+};
+
+class CountTrianglesVC final : public InMemParallelCompute {
+public:
+    explicit CountTrianglesVC(TriangleCountState& state) : state{state} {}
+
+    void parallelCompute(const offset_t startID, const offset_t endID,
+        const std::optional<table_id_t>&) override {
+        for (auto id = startID; id < endID; ++id) {
+            const auto numNbrs = state.numHigherRankNbrs[id];
+            if (numNbrs == 0) {
+                continue;
+            }
+            const offset_t* allNbrs = &state.nbrs[0];
+            const auto nbrs = allNbrs + state.csrOffsets[id];
+            uint64_t numTriangles = 0;
+            for (auto i = 0u; i < numNbrs; ++i) {
+                const auto nbrID = nbrs[i];
+                const auto nbrNbrs = allNbrs + state.csrOffsets[nbrID];
+                const auto numNbrNbrs = state.numHigherRankNbrs[nbrID];
+                const auto maxNumCommonNbrs = std::min(numNbrs, numNbrNbrs);
+                if (positions.size() < maxNumCommonNbrs) {
+                    positions.resize(maxNumCommonNbrs);
+                    nbrPositions.resize(maxNumCommonNbrs);
+                }
+                const auto numCommonNbrs = SortedSetIntersection::intersect(nbrs, numNbrs, nbrNbrs,
+                    numNbrNbrs, positions.data(), nbrPositions.data());
+                for (auto j = 0u; j < numCommonNbrs; ++j) {
+                    state.numTriangles.fetchAdd(nbrs[positions[j]], 1, std::memory_order_relaxed);
+                }
+                if (numCommonNbrs > 0) {
+                    state.numTriangles.fetchAdd(nbrID, numCommonNbrs, std::memory_order_relaxed);
+                }
+                numTriangles += numCommonNbrs;
+            }
+            if (numTriangles > 0) {
+                state.numTriangles.fetchAdd(id, numTriangles, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<CountTrianglesVC>(state);
+    }
+
+private:
+    TriangleCountState& state;
+    std::vector<sel_t> positions;
+    std::vector<sel_t> nbrPositions;
+};
+
+static void countTriangles(ExecutionContext* context, Graph* graph, TriangleCountState& state) {
+    auto transaction = transaction::Transaction::Get(*context->clientContext);
+    CopyNbrsVC countNbrsVC(graph, state, true /* countOnly */);
+    for (auto& [tableID, startID] : state.tableStartIDs) {
+        InMemGDSUtils::runParallelCompute(countNbrsVC, graph->getMaxOffset(transaction, tableID),
+            context, tableID);
+    }
+    for (auto id = 0u; id < state.numNodes; ++id) {
+        state.csrOffsets[id + 1] += state.csrOffsets[id];
+    }
+    state.nbrs.resize(state.csrOffsets[state.numNodes]);
+    CopyNbrsVC insertNbrsVC(graph, state, false /* countOnly */);
+    for (auto& [tableID, startID] : state.tableStartIDs) {
+        InMemGDSUtils::runParallelCompute(insertNbrsVC, graph->getMaxOffset(transaction, tableID),
+            context, tableID);
+    }
+    OrientEdgesVC orientEdgesVC(state);
+    InMemGDSUtils::runParallelCompute(orientEdgesVC, state.numNodes, context);
+    CountTrianglesVC countTrianglesVC(state);
+    InMemGDSUtils::runParallelCompute(countTrianglesVC, state.numNodes, context);
+}
+
+class TriangleCountResultVertexCompute : public GDSResultVertexCompute {
+public:
+    TriangleCountResultVertexCompute(MemoryManager* mm, GDSFuncSharedState* sharedState,
+        TriangleCountState& state, bool computeLCC)
+        : GDSResultVertexCompute{mm, sharedState}, state{state}, computeLCC{computeLCC} {
+        nodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        valueVector = createVector(computeLCC ? LogicalType::DOUBLE() : LogicalType::INT64());
+    }
+
+    void beginOnTableInternal(table_id_t tableID) override {
+        startID = state.tableStartIDs.at(tableID);
+    }
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t tableID) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            if (skip(i)) {
+                continue;
+            }
+            const auto id = startID + i;
+            const auto numTriangles = state.numTriangles.get(id, std::memory_order_relaxed);
+            nodeIDVector->setValue<nodeID_t>(0, nodeID_t{i, tableID});
+            if (computeLCC) {
+                const auto degree = static_cast<double>(state.degrees[id]);
+                valueVector->setValue<double>(0,
+                    degree < 2 ? 0 : 2.0 * numTriangles / (degree * (degree - 1)));
+            } else {
+                valueVector->setValue<int64_t>(0, numTriangles);
+            }
+            localFT->append(vectors);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<TriangleCountResultVertexCompute>(mm, sharedState, state,
+            computeLCC);
+    }
+
+private:
+    TriangleCountState& state;
+    bool computeLCC;
+    offset_t startID = 0;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> valueVector;
+};
+
+template<bool COMPUTE_LCC>
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto clientContext = input.context->clientContext;
+    auto transaction = transaction::Transaction::Get(*clientContext);
+    auto mm = MemoryManager::Get(*clientContext);
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto graph = sharedState->graph.get();
+    auto state = TriangleCountState(graph->getMaxOffsetMap(transaction),
+        sharedState->getGraphNodeMaskMap(), mm);
+    countTriangles(input.context, graph, state);
+    ProgressBar::Get(*clientContext)->updateProgress(input.context->queryID, 1);
+    auto vertexCompute = TriangleCountResultVertexCompute(mm, sharedState, state, COMPUTE_LCC);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, vertexCompute);
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static constexpr char TRIANGLE_COUNT_COLUMN_NAME[] = "triangle_count";
+static constexpr char LCC_COLUMN_NAME[] = "clustering_coefficient";
+
+template<bool COMPUTE_LCC>
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    auto graphName = input->getLiteralVal<std::string>(0);
+    auto graphEntry = GDSFunction::bindGraphEntry(*context, graphName);
+    auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
+    expression_vector columns;
+    columns.push_back(nodeOutput->constCast<NodeExpression>().getInternalID());
+    if constexpr (COMPUTE_LCC) {
+        columns.push_back(input->binder->createVariable(LCC_COLUMN_NAME, LogicalType::DOUBLE()));
+    } else {
+        columns.push_back(
+            input->binder->createVariable(TRIANGLE_COUNT_COLUMN_NAME, LogicalType::INT64()));
+    }
+    return std::make_unique<GDSBindData>(std::move(columns), std::move(graphEntry),
+        expression_vector{nodeOutput});
+}
+
+template<bool COMPUTE_LCC>
+static function_set getFunctionSet(const char* name) {
+    function_set result;
+    auto func =
+        std::make_unique<TableFunction>(name, std::vector<LogicalTypeID>{LogicalTypeID::ANY});
+    func->bindFunc = bindFunc<COMPUTE_LCC>;
+    func->tableFunc = tableFunc<COMPUTE_LCC>;
+    func->initSharedStateFunc = GDSFunction::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->getLogicalPlanFunc = GDSFunction::getLogicalPlan;
+    func->getPhysicalPlanFunc = GDSFunction::getPhysicalPlan;
+    result.push_back(std::move(func));
+    return result;
+}
+
+function_set TriangleCountFunction::getFunctionSet() {
+    return algo_extension::getFunctionSet<false /* COMPUTE_LCC */>(TriangleCountFunction::name);
+}
+
+function_set LocalClusteringCoefficientFunction::getFunctionSet() {
+    return algo_extension::getFunctionSet<true /* COMPUTE_LCC */>(
+        LocalClusteringCoefficientFunction::name);
+}
+
+} // namespace algo_extension
+} // namespace lbug
@@ -63,6 +63,10 @@ public:
     static void runParallelCompute(InMemParallelCompute& vc, common::offset_t maxOffset,
         processor::ExecutionContext* context,
         std::optional<common::table_id_t> tableId = std::nullopt);
+    // Same as above, but dispatches one offset at a time. Use when each offset is an expensive
+    // unit of work, e.g. the BFS from one source, so that a few of them still spread over threads.
+    static void runParallelComputePerOffset(InMemParallelCompute& vc, common::offset_t maxOffset,
+        processor::ExecutionContext* context);
 };
 
 } // namespace algo_extension
@@ -14,14 +14,17 @@ struct Neighbor {
     common::offset_t neighbor;
     weight_t weight;
 
+    Neighbor() = default;
     Neighbor(const common::offset_t neighbor, const weight_t weight)
         : neighbor{neighbor}, weight{weight} {}
 };
 
-// CSR-like in-memory representation of an undirected weighted graph. Insert nodes in sequence
-// by first calling `initNextNode()` and then insert all its neighbors using `insertNbr()`.
+// CSR-like in-memory representation of an undirected weighted graph. The graph is built in two
+// passes that can each run in parallel over disjoint ranges of nodes: first set the number of
+// neighbors of every node using `setNumNbrs()`, then call `initEdges()` to compute the CSR offsets,
+// and finally insert the neighbors of each node using `setNbr()` at positions
+// [csrOffsets[nodeId], csrOffsets[nodeId + 1]).
 // Undirected edges should be explicitly inserted twice.
-// Note: modifying the in-memory graph is NOT thread-safe.
 struct InMemGraph {
     function::ku_vector_t<common::offset_t> csrOffsets;
     function::ku_vector_t<Neighbor> csrEdges;
@@ -32,14 +35,21 @@ struct InMemGraph {
     DELETE_BOTH_COPY(InMemGraph);
     ~InMemGraph() = default;
 
-    // Re-initializes to an empty graph. Reuses allocations if `numNodes` <= `this->numNodes`.
+    // Re-initializes to a graph without edges. Reuses allocations if `numNodes` <=
+    // `this->numNodes`.
     void reinit(const common::offset_t numNodes);
 
-    // Initializes the next node in the sequence to prepare for edges insertions for the node.
-    void initNextNode();
+    void setNumNbrs(const common::offset_t nodeId, const common::offset_t numNbrs) {
+        csrOffsets[nodeId + 1] = numNbrs;
+    }
 
-    // Inserts a neighbor of the last initialized node.
-    void insertNbr(const common::offset_t to, const weight_t weight = DEFAULT_WEIGHT);
+    // Computes the CSR offsets from the number of neighbors of each node and allocates the edges.
+    void initEdges();
+
+    void setNbr(const common::offset_t pos, const common::offset_t to,
+        const weight_t weight = DEFAULT_WEIGHT) {
+        csrEdges[pos] = Neighbor(to, weight);
+    }
 };
 
 } // namespace algo_extension
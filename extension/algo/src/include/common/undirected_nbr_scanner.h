@@ -0,0 +1,52 @@
+#pragma once
+
+#include "graph/graph.h"
+
+namespace lbug {
+namespace algo_extension {
+
+// Scans the neighbours of a node in both directions of all rel tables of the graph. Each thread
+// needs its own scanner.
+class UndirectedNbrScanner {
+    struct ScanInfo {
+        std::unique_ptr<graph::NbrScanState> scanState;
+        bool isFwd;
+    };
+
+public:
+    explicit UndirectedNbrScanner(graph::Graph* graph) : graph{graph} {
+        for (auto tableID : graph->getNodeTableIDs()) {
+            for (auto& relInfo : graph->getRelInfos(tableID)) {
+                scanInfos[relInfo.srcTableID].push_back(
+                    ScanInfo{graph->prepareRelScan(*relInfo.relGroupEntry, relInfo.relTableID,
+                                 relInfo.dstTableID, {}),
+                        true /* isFwd */});
+                scanInfos[relInfo.dstTableID].push_back(
+                    ScanInfo{graph->prepareRelScan(*relInfo.relGroupEntry, relInfo.relTableID,
+                                 relInfo.srcTableID, {}),
+                        false /* isFwd */});
+            }
+        }
+    }
+
+    template<typename Func>
+    void forEachNbr(common::nodeID_t nodeID, Func&& func) {
+        if (!scanInfos.contains(nodeID.tableID)) {
+            return;
+        }
+        for (auto& scanInfo : scanInfos.at(nodeID.tableID)) {
+            auto iterator = scanInfo.isFwd ? graph->scanFwd(nodeID, *scanInfo.scanState) :
+                                             graph->scanBwd(nodeID, *scanInfo.scanState);
+            for (auto chunk : iterator) {
+                chunk.forEach([&](auto nbrNodeIDs, auto, auto i) { func(nbrNodeIDs[i]); });
+            }
+        }
+    }
+
+private:
+    graph::Graph* graph;
+    common::table_id_map_t<std::vector<ScanInfo>> scanInfos;
+};
+
+} // namespace algo_extension
+} // namespace lbug
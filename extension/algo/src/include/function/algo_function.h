@@ -71,6 +71,36 @@ struct LouvainFunction {
     static function::function_set getFunctionSet();
 };
 
+struct ReorderNodesFunction {
+    static constexpr const char* name = "REORDER_NODES";
+
+    static function::function_set getFunctionSet();
+};
+
+struct TriangleCountFunction {
+    static constexpr const char* name = "TRIANGLE_COUNT";
+
+    static function::function_set getFunctionSet();
+};
+
+struct LocalClusteringCoefficientFunction {
+    static constexpr const char* name = "LOCAL_CLUSTERING_COEFFICIENT";
+
+    static function::function_set getFunctionSet();
+};
+
+struct BetweennessCentralityFunction {
+    static constexpr const char* name = "BETWEENNESS_CENTRALITY";
+
+    static function::function_set getFunctionSet();
+};
+
+struct ClosenessCentralityFunction {
+    static constexpr const char* name = "CLOSENESS_CENTRALITY";
+
+    static function::function_set getFunctionSet();
+};
+
 struct SpanningForest {
     static constexpr const char* name = "SPANNING_FOREST";
 
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "common/exception/binder.h"
+#include "common/types/types.h"
+
+namespace lbug {
+namespace algo_extension {
+
+struct Samples {
+    // The number of source nodes (pivots) sampled uniformly at random. The runtime is
+    // proportional to the number of samples. 0 uses every node as a source, i.e. computes exact
+    // values.
+    static constexpr const char* NAME = "samples";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    static constexpr int64_t DEFAULT_VALUE = 0;
+
+    static void validate(int64_t samples) {
+        if (samples < 0) {
+            throw common::BinderException{"samples must be a non-negative integer."};
+        }
+    }
+};
+
+struct Seed {
+    // The seed of the random sampling of source nodes.
+    static constexpr const char* NAME = "seed";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    static constexpr int64_t DEFAULT_VALUE = 0;
+};
+
+struct Harmonic {
+    // If true, computes the harmonic centrality (sum of inverse distances) instead of the
+    // closeness centrality (inverse of the mean distance).
+    static constexpr const char* NAME = "harmonic";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::BOOL;
+    static constexpr bool DEFAULT_VALUE = false;
+};
+
+} // namespace algo_extension
+} // namespace lbug
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string>
+
+#include "common/exception/binder.h"
+#include "common/types/types.h"
+#include "function/table/optional_params.h"
+#include <format>
+
+namespace lbug {
+namespace algo_extension {
+
+// The order in which nodes are relabeled.
+struct ReorderStrategy {
+    static constexpr const char* NAME = "strategy";
+    // Reverse Cuthill-McKee: nodes of a BFS are numbered consecutively, so neighbours get close
+    // offsets.
+    static constexpr const char* RCM = "rcm";
+    // Nodes are numbered by descending degree, so hubs share node groups.
+    static constexpr const char* DEGREE = "degree";
+    static constexpr const char* DEFAULT_VALUE = RCM;
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::STRING;
+
+    static void validate(std::string strategy) {
+        if (strategy != RCM && strategy != DEGREE) {
+            throw common::BinderException(std::format("Strategy argument expects {} or {}. Got: {}",
+                RCM, DEGREE, strategy));
+        }
+    }
+};
+
+} // namespace algo_extension
+} // namespace lbug
@@ -82,6 +82,28 @@ lbug_state lbug_connection_query(lbug_connection* connection, const char* query,
     }
 }
 
+lbug_state lbug_connection_query_as_stream(lbug_connection* connection, const char* query,
+    lbug_query_result* out_query_result) {
+    if (connection == nullptr || connection->_connection == nullptr) {
+        return LbugError;
+    }
+    try {
+        auto query_result =
+            static_cast<Connection*>(connection->_connection)->queryAsStream(query).release();
+        if (query_result == nullptr) {
+            return LbugError;
+        }
+        out_query_result->_query_result = query_result;
+        out_query_result->_is_owned_by_cpp = false;
+        if (!query_result->isSuccess()) {
+            return LbugError;
+        }
+        return LbugSuccess;
+    } catch (Exception& e) {
+        return LbugError;
+    }
+}
+
 lbug_state lbug_connection_prepare(lbug_connection* connection, const char* query,
     lbug_prepared_statement* out_prepared_statement) {
     if (connection == nullptr || connection->_connection == nullptr) {
@@ -71,7 +71,13 @@ lbug_state lbug_query_result_get_query_summary(lbug_query_result* query_result,
 }
 
 bool lbug_query_result_has_next(lbug_query_result* query_result) {
-    return static_cast<QueryResult*>(query_result->_query_result)->hasNext();
+    try {
+        return static_cast<QueryResult*>(query_result->_query_result)->hasNext();
+    } catch (Exception& e) {
+        // A streaming query can fail after it returned its result. The error is reported by
+        // lbug_query_result_is_success and lbug_query_result_get_error_message.
+        return false;
+    }
 }
 
 bool lbug_query_result_has_next_query_result(lbug_query_result* query_result) {
@@ -134,3 +140,14 @@ lbug_state lbug_query_result_get_next_arrow_chunk(lbug_query_result* query_resul
         return LbugError;
     }
 }
+
+lbug_state lbug_query_result_get_arrow_stream(lbug_query_result* query_result, int64_t chunk_size,
+    ArrowArrayStream* out_stream) {
+    try {
+        *out_stream =
+            *static_cast<QueryResult*>(query_result->_query_result)->getArrowArrayStream(chunk_size);
+        return LbugSuccess;
+    } catch (Exception& e) {
+        return LbugError;
+    }
+}
@@ -18,6 +18,14 @@ double lbug_query_summary_get_compiling_time(lbug_query_summary* query_summary)
     return static_cast<QuerySummary*>(query_summary->_query_summary)->getCompilingTime();
 }
 
+double lbug_query_summary_get_planning_time(lbug_query_summary* query_summary) {
+    return static_cast<QuerySummary*>(query_summary->_query_summary)->getPlanningTime();
+}
+
 double lbug_query_summary_get_execution_time(lbug_query_summary* query_summary) {
     return static_cast<QuerySummary*>(query_summary->_query_summary)->getExecutionTime();
 }
+
+uint64_t lbug_query_summary_get_peak_memory_usage(lbug_query_summary* query_summary) {
+    return static_cast<QuerySummary*>(query_summary->_query_summary)->getPeakMemoryUsage();
+}
@@ -3,6 +3,7 @@
 #include <cstring>
 
 #include "common/exception/runtime.h"
+#include "common/vector/value_vector.h"
 #include "common/types/value/node.h"
 #include "common/types/value/rel.h"
 #include "common/types/value/value.h"
@@ -1019,5 +1020,98 @@ void ArrowRowBatch::append(const processor::FlatTuple& tuple) {
     numTuples++;
 }
 
+// Returns the number of bytes per value if the ValueVector and the arrow layout of the type are
+// identical, 0 otherwise.
+static uint32_t getNumBytesIfSameLayout(const LogicalType& type) {
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::UINT64:
+    case LogicalTypeID::TIMESTAMP:
+    case LogicalTypeID::TIMESTAMP_SEC:
+    case LogicalTypeID::TIMESTAMP_MS:
+    case LogicalTypeID::TIMESTAMP_NS:
+    case LogicalTypeID::TIMESTAMP_TZ:
+    case LogicalTypeID::DOUBLE:
+        return sizeof(int64_t);
+    case LogicalTypeID::DATE:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::FLOAT:
+        return sizeof(int32_t);
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::UINT16:
+        return sizeof(int16_t);
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::UINT8:
+        return sizeof(int8_t);
+    case LogicalTypeID::INT128:
+        return sizeof(int128_t);
+    default:
+        return 0;
+    }
+}
+
+void ArrowRowBatch::appendVector(ArrowVector* arrowVector, ValueVector& vector, sel_t startIdx,
+    sel_t numTuples, bool fallbackExtensionTypes) {
+    auto& selVector = vector.state->getSelVector();
+    auto isFlat = vector.state->isFlat();
+    auto getPos = [&](sel_t i) { return isFlat ? selVector[0] : selVector[startIdx + i]; };
+    auto numBytes = getNumBytesIfSameLayout(vector.dataType);
+    auto logicalTypeID = vector.dataType.getLogicalTypeID();
+    if (numBytes > 0 || logicalTypeID == LogicalTypeID::BOOL) {
+        KU_ASSERT(arrowVector->numValues + numTuples <= arrowVector->capacity);
+        if (logicalTypeID == LogicalTypeID::BOOL) {
+            for (auto i = 0u; i < numTuples; i++) {
+                if (vector.getValue<bool>(getPos(i))) {
+                    setBitToOne(arrowVector->data.data(), arrowVector->numValues + i);
+                } else {
+                    setBitToZero(arrowVector->data.data(), arrowVector->numValues + i);
+                }
+            }
+        } else {
+            auto dst = arrowVector->data.data() + arrowVector->numValues * numBytes;
+            if (!isFlat && selVector.isStatic()) {
+                std::memcpy(dst, vector.getData() + selVector[startIdx] * numBytes,
+                    numTuples * numBytes);
+            } else {
+                for (auto i = 0u; i < numTuples; i++) {
+                    std::memcpy(dst + i * numBytes, vector.getData() + getPos(i) * numBytes,
+                        numBytes);
+                }
+            }
+        }
+        if (!vector.hasNoNullsGuarantee()) {
+            for (auto i = 0u; i < numTuples; i++) {
+                if (vector.isNull(getPos(i))) {
+                    setBitToZero(arrowVector->validity.data(), arrowVector->numValues + i);
+                    arrowVector->numNulls++;
+                }
+            }
+        }
+        arrowVector->numValues += numTuples;
+        return;
+    }
+    auto value = Value::createDefaultValue(vector.dataType);
+    for (auto i = 0u; i < numTuples; i++) {
+        auto pos = getPos(i);
+        value.setNull(vector.isNull(pos));
+        if (!value.isNull()) {
+            value.copyFromColLayout(vector.getData() + pos * vector.getNumBytesPerValue(), &vector);
+        }
+        appendValue(arrowVector, value, fallbackExtensionTypes);
+    }
+}
+
+void ArrowRowBatch::append(const std::vector<ValueVector*>& vectors, sel_t startIdx,
+    sel_t numTuples) {
+    KU_ASSERT(vectors.size() == this->vectors.size());
+    for (auto i = 0u; i < vectors.size(); i++) {
+        appendVector(this->vectors[i].get(), *vectors[i], startIdx, numTuples,
+            fallbackExtensionTypes);
+    }
+    this->numTuples += numTuples;
+}
+
 } // namespace common
 } // namespace lbug
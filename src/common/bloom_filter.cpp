@@ -0,0 +1,27 @@
+#include "common/bloom_filter.h"
+
+#include "common/utils.h"
+
+namespace lbug {
+namespace common {
+
+void BloomFilter::init(uint64_t numEntries) {
+    // The word index is taken from the upper half of the hash.
+    static constexpr uint64_t MAX_NUM_WORDS = static_cast<uint64_t>(1) << 32;
+    auto numWords = std::max<uint64_t>(numEntries * NUM_BITS_PER_ENTRY / 64, 1);
+    numWords = std::min(nextPowerOfTwo(numWords), MAX_NUM_WORDS);
+    words.assign(numWords, 0);
+    wordIdxMask = numWords - 1;
+}
+
+uint64_t BloomFilter::getBitMask(hash_t hash) {
+    // Each bit position takes 6 bits of the lower half of the hash.
+    uint64_t mask = 0;
+    for (auto i = 0u; i < NUM_BITS_PER_HASH; i++) {
+        mask |= static_cast<uint64_t>(1) << ((hash >> (i * 6)) & 63);
+    }
+    return mask;
+}
+
+} // namespace common
+} // namespace lbug
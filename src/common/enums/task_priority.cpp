@@ -0,0 +1,40 @@
+#include "common/enums/task_priority.h"
+
+#include "common/assert.h"
+#include "common/exception/binder.h"
+#include "common/string_utils.h"
+#include <format>
+
+namespace lbug {
+namespace common {
+
+TaskPriority TaskPriorityUtils::fromString(const std::string& str) {
+    auto normalizedStr = StringUtils::getUpper(str);
+    if (normalizedStr == "HIGH") {
+        return TaskPriority::HIGH;
+    }
+    if (normalizedStr == "NORMAL") {
+        return TaskPriority::NORMAL;
+    }
+    if (normalizedStr == "LOW") {
+        return TaskPriority::LOW;
+    }
+    throw BinderException(std::format(
+        "Cannot parse {} as a query priority. Supported inputs are [HIGH, NORMAL, LOW]", str));
+}
+
+std::string TaskPriorityUtils::toString(TaskPriority priority) {
+    switch (priority) {
+    case TaskPriority::HIGH:
+        return "HIGH";
+    case TaskPriority::NORMAL:
+        return "NORMAL";
+    case TaskPriority::LOW:
+        return "LOW";
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+} // namespace common
+} // namespace lbug
@@ -54,12 +54,12 @@ void InMemOverflowBuffer::allocateNewBlock(uint64_t size) {
     std::unique_ptr<BufferBlock> newBlock;
     if (blocks.empty()) {
         newBlock = make_unique<BufferBlock>(
-            memoryManager->allocateBuffer(false /* do not initialize to zero */, size));
+            memoryManager->allocateIntermediateBuffer(false /* do not initialize to zero */, size));
     } else {
         // Use the doubling strategy so that the initial allocations are small, but if we need many
         // allocations they approach the TEMP_PAGE_SIZE quickly
         auto min = std::min(TEMP_PAGE_SIZE, std::bit_ceil(currentBlock()->size() * 2));
-        newBlock = make_unique<BufferBlock>(memoryManager->allocateBuffer(
+        newBlock = make_unique<BufferBlock>(memoryManager->allocateIntermediateBuffer(
             false /* do not initialize to zero */, std::max(min, size)));
     }
     blocks.push_back(std::move(newBlock));
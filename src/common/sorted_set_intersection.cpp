@@ -0,0 +1,291 @@
+#include "common/sorted_set_intersection.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <type_traits>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define LBUG_SET_INTERSECTION_X86
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define LBUG_SET_INTERSECTION_NEON
+#include <arm_neon.h>
+#endif
+
+namespace lbug {
+namespace common {
+
+struct PositionsOutput {
+    sel_t* aPositions;
+    sel_t* bPositions;
+    uint64_t numValues = 0;
+
+    PositionsOutput(sel_t* aPositions, sel_t* bPositions)
+        : aPositions{aPositions}, bPositions{bPositions} {}
+
+    void append(sel_t aPos, sel_t bPos) {
+        aPositions[numValues] = aPos;
+        bPositions[numValues] = bPos;
+        numValues++;
+    }
+};
+
+struct CountOutput {
+    uint64_t numValues = 0;
+
+    void append(sel_t, sel_t) { numValues++; }
+};
+
+// Lists are read with a stride of STRIDE 64-bit words per value, so that the offsets of an array
+// of nodeIDs can be intersected in place.
+template<uint64_t STRIDE, typename Output>
+static void mergeScalar(const uint64_t* a, uint64_t aSize, const uint64_t* b, uint64_t bSize,
+    uint64_t i, uint64_t j, Output& output) {
+    while (i < aSize && j < bSize) {
+        if (a[i * STRIDE] < b[j * STRIDE]) {
+            i++;
+        } else if (a[i * STRIDE] > b[j * STRIDE]) {
+            j++;
+        } else {
+            output.append(i, j);
+            i++;
+            j++;
+        }
+    }
+}
+
+// Returns the first position in [begin, end) whose value is >= `value`.
+template<uint64_t STRIDE>
+static uint64_t lowerBound(const uint64_t* values, uint64_t begin, uint64_t end, uint64_t value) {
+    while (begin < end) {
+        const auto mid = begin + (end - begin) / 2;
+        if (values[mid * STRIDE] < value) {
+            begin = mid + 1;
+        } else {
+            end = mid;
+        }
+    }
+    return begin;
+}
+
+// Looks up each value of the small list in the large list with an exponential search starting
+// after the previous match, i.e. O(smallSize * log(largeSize / smallSize)) comparisons.
+template<uint64_t STRIDE, bool SMALL_IS_A, typename Output>
+static void gallop(const uint64_t* small, uint64_t smallSize, const uint64_t* large,
+    uint64_t largeSize, Output& output) {
+    uint64_t j = 0;
+    for (auto i = 0u; i < smallSize && j < largeSize; ++i) {
+        const auto value = small[i * STRIDE];
+        if (large[j * STRIDE] < value) {
+            // large[j + step / 2] < value, so the first value >= `value` is in
+            // (j + step / 2, j + step].
+            uint64_t step = 1;
+            while (j + step < largeSize && large[(j + step) * STRIDE] < value) {
+                step *= 2;
+            }
+            j = lowerBound<STRIDE>(large, j + step / 2 + 1, std::min(j + step + 1, largeSize),
+                value);
+            if (j == largeSize) {
+                break;
+            }
+        }
+        if (large[j * STRIDE] == value) {
+            if constexpr (SMALL_IS_A) {
+                output.append(i, j);
+            } else {
+                output.append(j, i);
+            }
+            j++;
+        }
+    }
+}
+
+// masks[r] has bit k set if a[i + k] == b[j + (k + r) % NUM_LANES]. Each value of a block matches
+// at most one value of the other block because the values of a list are distinct.
+template<uint64_t NUM_LANES, typename Output>
+static inline void appendBlockMatches(const uint32_t* masks, uint64_t i, uint64_t j,
+    Output& output) {
+    if constexpr (std::is_same_v<Output, CountOutput>) {
+        uint32_t mask = 0;
+        for (auto r = 0u; r < NUM_LANES; ++r) {
+            mask |= masks[r];
+        }
+        output.numValues += std::popcount(mask);
+    } else {
+        for (auto k = 0u; k < NUM_LANES; ++k) {
+            for (auto r = 0u; r < NUM_LANES; ++r) {
+                if ((masks[r] >> k) & 1) {
+                    output.append(i + k, j + (k + r) % NUM_LANES);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+#ifdef LBUG_SET_INTERSECTION_X86
+
+#ifdef __clang__
+#pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+namespace avx2 {
+
+static inline uint32_t eqMask(__m256i a, __m256i b) {
+    return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b)));
+}
+
+template<uint64_t STRIDE>
+static inline __m256i load(const uint64_t* values) {
+    if constexpr (STRIDE == 1) {
+        return _mm256_loadu_si256((const __m256i*)values);
+    } else {
+        static_assert(STRIDE == 2);
+        // [v0, x0, v1, x1] and [v2, x2, v3, x3] -> [v0, v2, v1, v3] -> [v0, v1, v2, v3].
+        const auto lo = _mm256_loadu_si256((const __m256i*)values);
+        const auto hi = _mm256_loadu_si256((const __m256i*)(values + 4));
+        return _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(lo, hi), 0xD8);
+    }
+}
+
+// Compares blocks of 4 values of both lists against each other with the block of b rotated by
+// 0-3 lanes, and advances the block whose last value is smaller.
+template<uint64_t STRIDE, typename Output>
+static void merge(const uint64_t* a, uint64_t aSize, const uint64_t* b, uint64_t bSize,
+    Output& output) {
+    uint64_t i = 0, j = 0;
+    while (i + 4 <= aSize && j + 4 <= bSize) {
+        const auto va = load<STRIDE>(a + i * STRIDE);
+        const auto vb = load<STRIDE>(b + j * STRIDE);
+        uint32_t masks[4];
+        masks[0] = eqMask(va, vb);
+        masks[1] = eqMask(va, _mm256_permute4x64_epi64(vb, 0x39));
+        masks[2] = eqMask(va, _mm256_permute4x64_epi64(vb, 0x4E));
+        masks[3] = eqMask(va, _mm256_permute4x64_epi64(vb, 0x93));
+        appendBlockMatches<4>(masks, i, j, output);
+        const auto aMax = a[(i + 3) * STRIDE];
+        const auto bMax = b[(j + 3) * STRIDE];
+        i += aMax <= bMax ? 4 : 0;
+        j += bMax <= aMax ? 4 : 0;
+    }
+    mergeScalar<STRIDE>(a, aSize, b, bSize, i, j, output);
+}
+
+} // namespace avx2
+
+#ifdef __clang__
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#endif // LBUG_SET_INTERSECTION_X86
+
+#ifdef LBUG_SET_INTERSECTION_NEON
+
+namespace neon {
+
+static inline uint32_t eqMask(uint64x2_t a, uint64x2_t b) {
+    const auto eq = vceqq_u64(a, b);
+    return (vgetq_lane_u64(eq, 0) & 1) | (vgetq_lane_u64(eq, 1) & 2);
+}
+
+template<uint64_t STRIDE>
+static inline uint64x2_t load(const uint64_t* values) {
+    if constexpr (STRIDE == 1) {
+        return vld1q_u64(values);
+    } else {
+        static_assert(STRIDE == 2);
+        return vld2q_u64(values).val[0];
+    }
+}
+
+// Same as avx2::merge with blocks of 2 values.
+template<uint64_t STRIDE, typename Output>
+static void merge(const uint64_t* a, uint64_t aSize, const uint64_t* b, uint64_t bSize,
+    Output& output) {
+    uint64_t i = 0, j = 0;
+    while (i + 2 <= aSize && j + 2 <= bSize) {
+        const auto va = load<STRIDE>(a + i * STRIDE);
+        const auto vb = load<STRIDE>(b + j * STRIDE);
+        uint32_t masks[2];
+        masks[0] = eqMask(va, vb);
+        masks[1] = eqMask(va, vextq_u64(vb, vb, 1));
+        appendBlockMatches<2>(masks, i, j, output);
+        const auto aMax = a[(i + 1) * STRIDE];
+        const auto bMax = b[(j + 1) * STRIDE];
+        i += aMax <= bMax ? 2 : 0;
+        j += bMax <= aMax ? 2 : 0;
+    }
+    mergeScalar<STRIDE>(a, aSize, b, bSize, i, j, output);
+}
+
+} // namespace neon
+
+#endif // LBUG_SET_INTERSECTION_NEON
+
+#ifdef LBUG_SET_INTERSECTION_X86
+static bool hasAVX2() {
+    static const auto result = [] {
+        __builtin_cpu_init();
+        return static_cast<bool>(__builtin_cpu_supports("avx2"));
+    }();
+    return result;
+}
+#endif
+
+template<uint64_t STRIDE, typename Output>
+static void intersectInternal(const uint64_t* a, uint64_t aSize, const uint64_t* b,
+    uint64_t bSize, Output& output) {
+    if (aSize == 0 || bSize == 0) {
+        return;
+    }
+    if (aSize * SortedSetIntersection::GALLOPING_SIZE_RATIO <= bSize) {
+        gallop<STRIDE, true /* SMALL_IS_A */>(a, aSize, b, bSize, output);
+        return;
+    }
+    if (bSize * SortedSetIntersection::GALLOPING_SIZE_RATIO <= aSize) {
+        gallop<STRIDE, false /* SMALL_IS_A */>(b, bSize, a, aSize, output);
+        return;
+    }
+#if defined(LBUG_SET_INTERSECTION_X86)
+    if (hasAVX2()) {
+        avx2::merge<STRIDE>(a, aSize, b, bSize, output);
+        return;
+    }
+#elif defined(LBUG_SET_INTERSECTION_NEON)
+    neon::merge<STRIDE>(a, aSize, b, bSize, output);
+    return;
+#endif
+    mergeScalar<STRIDE>(a, aSize, b, bSize, 0 /* i */, 0 /* j */, output);
+}
+
+uint64_t SortedSetIntersection::intersect(const uint64_t* a, uint64_t aSize, const uint64_t* b,
+    uint64_t bSize, sel_t* aPositions, sel_t* bPositions) {
+    PositionsOutput output{aPositions, bPositions};
+    intersectInternal<1 /* STRIDE */>(a, aSize, b, bSize, output);
+    return output.numValues;
+}
+
+uint64_t SortedSetIntersection::intersect(const nodeID_t* a, uint64_t aSize, const nodeID_t* b,
+    uint64_t bSize, sel_t* aPositions, sel_t* bPositions) {
+    static_assert(sizeof(nodeID_t) == 2 * sizeof(uint64_t) && offsetof(nodeID_t, offset) == 0);
+    PositionsOutput output{aPositions, bPositions};
+    intersectInternal<2 /* STRIDE */>(reinterpret_cast<const uint64_t*>(a), aSize,
+        reinterpret_cast<const uint64_t*>(b), bSize, output);
+    return output.numValues;
+}
+
+uint64_t SortedSetIntersection::count(const uint64_t* a, uint64_t aSize, const uint64_t* b,
+    uint64_t bSize) {
+    CountOutput output;
+    intersectInternal<1 /* STRIDE */>(a, aSize, b, bSize, output);
+    return output.numValues;
+}
+
+} // namespace common
+} // namespace lbug
@@ -3,6 +3,15 @@
 namespace lbug {
 namespace common {
 
+bool Task::canRegister(uint64_t& numRegistered) {
+    lock_t lck{taskMtx};
+    if (!hasExceptionNoLock() && canRegisterNoLock()) {
+        numRegistered = numThreadsRegistered;
+        return true;
+    }
+    return false;
+}
+
 bool Task::registerThread() {
     lock_t lck{taskMtx};
     if (!hasExceptionNoLock() && canRegisterNoLock()) {
@@ -3,6 +3,7 @@
 #include "main/client_context.h"
 #include "main/database.h"
 #include "processor/processor.h"
+#include "storage/buffer_manager/query_memory_tracker.h"
 
 #if defined(__APPLE__)
 #include <pthread.h>
@@ -41,6 +42,7 @@ TaskScheduler::~TaskScheduler() {
 
 void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task,
     processor::ExecutionContext* context, bool launchNewWorkerThread) {
+    task->setPriority(context->clientContext->getClientConfig()->queryPriority);
     for (auto& dependency : task->children) {
         scheduleTaskAndWaitOrError(dependency, context);
         if (dependency->terminate()) {
@@ -48,6 +50,7 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
         }
     }
     std::thread newWorkerThread;
+    auto& memoryTracker = context->clientContext->getQueryMemoryTracker();
     if (launchNewWorkerThread) {
         // Note that newWorkerThread is not executing yet. However, we still call
         // task->registerThread() function because the call in the next line will guarantee
@@ -55,9 +58,9 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
         // numThreadsRegistered field of the task, tt does not keep track of the thread ids or
         // anything specific to the thread.
         task->registerThread();
-        newWorkerThread = std::thread(runTask, task.get());
+        newWorkerThread = std::thread(runTask, task.get(), memoryTracker);
     }
-    auto scheduledTask = pushTaskIntoQueue(task);
+    auto scheduledTask = pushTaskIntoQueue(task, memoryTracker);
     cv.notify_all();
     std::unique_lock<std::mutex> taskLck{task->taskMtx, std::defer_lock};
     while (true) {
@@ -137,6 +140,8 @@ void TaskScheduler::runWorkerThread() {
             return;
         }
         try {
+            auto memoryTrackerScope =
+                storage::QueryMemoryTrackerScope(scheduledTask->memoryTracker);
             scheduledTask->task->run();
         } catch (std::exception& e) {
             exceptionPtr = std::current_exception();
@@ -161,7 +166,7 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
     }
     task->registerThread();
     // runTask deregisters, so we don't need to deregister explicitly here
-    runTask(task.get());
+    runTask(task.get(), context->clientContext->getQueryMemoryTracker());
     if (task->hasException()) {
         removeErroringTask(task->ID);
         std::rethrow_exception(task->getExceptionPtr());
@@ -169,50 +174,94 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
 }
 #endif
 
-std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueue(const std::shared_ptr<Task>& task) {
+std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueue(const std::shared_ptr<Task>& task,
+    std::shared_ptr<storage::QueryMemoryTracker> memoryTracker) {
     lock_t lck{taskSchedulerMtx};
-    auto scheduledTask = std::make_shared<ScheduledTask>(task, nextScheduledTaskID++);
-    taskQueue.push_back(scheduledTask);
+    auto scheduledTask =
+        std::make_shared<ScheduledTask>(task, nextScheduledTaskID++, std::move(memoryTracker));
+    taskQueues[static_cast<uint8_t>(task->getPriority())].push_back(scheduledTask);
     return scheduledTask;
 }
 
 std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister() {
-    if (taskQueue.empty()) {
-        return nullptr;
-    }
-    auto it = taskQueue.begin();
-    while (it != taskQueue.end()) {
-        auto task = (*it)->task;
-        if (!task->registerThread()) {
-            // If we cannot register for a thread it is because of three possibilities:
-            // (i) maximum number of threads have registered for task and the task is completed
-            // without an exception; or (ii) same as (i) but the task has not yet successfully
-            // completed; or (iii) task has an exception; Only in (i) we remove the task from the
-            // queue. For (ii) and (iii) we keep the task in queue. Recall erroring tasks need to be
-            // manually removed.
-            if (task->isCompletedSuccessfully()) { // option (i)
-                it = taskQueue.erase(it);
-            } else { // option (ii) or (iii): keep the task in the queue.
+    // Queues are ordered from the highest to the lowest priority.
+    for (auto priority = 0u; priority < taskQueues.size(); ++priority) {
+        auto& taskQueue = taskQueues[priority];
+        while (!taskQueue.empty()) {
+            std::shared_ptr<ScheduledTask> candidate = nullptr;
+            auto minNumRegistered = UINT64_MAX;
+            auto it = taskQueue.begin();
+            while (it != taskQueue.end()) {
+                auto task = (*it)->task;
+                uint64_t numRegistered = 0;
+                if (!task->canRegister(numRegistered)) {
+                    // If we cannot register for a thread it is because of three possibilities:
+                    // (i) maximum number of threads have registered for task and the task is
+                    // completed without an exception; or (ii) same as (i) but the task has not yet
+                    // successfully completed; or (iii) task has an exception; Only in (i) we remove
+                    // the task from the queue. For (ii) and (iii) we keep the task in queue. Recall
+                    // erroring tasks need to be manually removed.
+                    if (task->isCompletedSuccessfully()) { // option (i)
+                        it = taskQueue.erase(it);
+                    } else { // option (ii) or (iii): keep the task in the queue.
+                        ++it;
+                    }
+                    continue;
+                }
+                // Strict comparison keeps FIFO order among tasks with the same number of workers.
+                if (numRegistered < minNumRegistered) {
+                    candidate = *it;
+                    minNumRegistered = numRegistered;
+                }
                 ++it;
             }
-        } else {
-            return *it;
+            if (candidate == nullptr) {
+                break;
+            }
+            // The candidate may have errored or stopped accepting workers since we inspected it. In
+            // that case, scan the queue again.
+            if (candidate->task->registerThread()) {
+                ageWaitingTasks(priority);
+                return candidate;
+            }
         }
     }
     return nullptr;
 }
 
+void TaskScheduler::ageWaitingTasks(uint8_t servedPriority) {
+    for (auto priority = servedPriority + 1u; priority < taskQueues.size(); ++priority) {
+        auto& taskQueue = taskQueues[priority];
+        auto it = taskQueue.begin();
+        while (it != taskQueue.end()) {
+            uint64_t numRegistered = 0;
+            if (!(*it)->task->canRegister(numRegistered) ||
+                ++(*it)->numSkips < ScheduledTask::NUM_SKIPS_BEFORE_PROMOTION) {
+                ++it;
+                continue;
+            }
+            (*it)->numSkips = 0;
+            taskQueues[priority - 1].push_back(*it);
+            it = taskQueue.erase(it);
+        }
+    }
+}
+
 void TaskScheduler::removeErroringTask(uint64_t scheduledTaskID) {
     lock_t lck{taskSchedulerMtx};
-    for (auto it = taskQueue.begin(); it != taskQueue.end(); ++it) {
-        if (scheduledTaskID == (*it)->ID) {
-            taskQueue.erase(it);
-            return;
+    for (auto& taskQueue : taskQueues) {
+        for (auto it = taskQueue.begin(); it != taskQueue.end(); ++it) {
+            if (scheduledTaskID == (*it)->ID) {
+                taskQueue.erase(it);
+                return;
+            }
         }
     }
 }
 
-void TaskScheduler::runTask(Task* task) {
+void TaskScheduler::runTask(Task* task,
+    std::shared_ptr<storage::QueryMemoryTracker> memoryTracker) {
+    auto memoryTrackerScope = storage::QueryMemoryTrackerScope(std::move(memoryTracker));
     try {
         task->run();
         task->deRegisterThreadAndFinalizeTask();
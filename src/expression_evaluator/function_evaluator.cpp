@@ -1,6 +1,9 @@
 #include "expression_evaluator/function_evaluator.h"
 
 #include "binder/expression/scalar_function_expression.h"
+#include "binder/expression_visitor.h"
+#include "common/type_utils.h"
+#include "function/list/vector_list_functions.h"
 #include "function/sequence/sequence_functions.h"
 
 using namespace lbug::common;
@@ -22,6 +25,9 @@ FunctionExpressionEvaluator::FunctionExpressionEvaluator(std::shared_ptr<Express
 }
 
 void FunctionExpressionEvaluator::evaluate() {
+    if (hasConstantResult) {
+        return;
+    }
     auto ctx = localState.clientContext;
     for (auto& child : children) {
         child->evaluate();
@@ -30,6 +36,7 @@ void FunctionExpressionEvaluator::evaluate() {
         bindData->clientContext = ctx;
         runExecFunc(bindData.get());
     }
+    hasConstantResult = isConstant;
 }
 
 void FunctionExpressionEvaluator::evaluate(common::sel_t count) {
@@ -44,6 +51,12 @@ void FunctionExpressionEvaluator::evaluate(common::sel_t count) {
 }
 
 bool FunctionExpressionEvaluator::selectInternal(SelectionVector& selVector) {
+    if (selectKernelInfo != nullptr) {
+        bool hasSelectedValues = false;
+        if (trySelectWithKernel(selVector, hasSelectedValues)) {
+            return hasSelectedValues;
+        }
+    }
     for (auto& child : children) {
         child->evaluate();
     }
@@ -75,6 +88,208 @@ void FunctionExpressionEvaluator::resolveResultVector(const ResultSet& /*resultS
     if (function->compileFunc != nullptr) {
         function->compileFunc(bindData.get(), parameters, resultVector);
     }
+    resolveSelectKernel();
+    resolveConstant();
+}
+
+// Literal-only expressions are folded by the binder, but expressions over parameters are not, as
+// parameter values can change between executions of a prepared statement.
+void FunctionExpressionEvaluator::resolveConstant() {
+    isConstant = false;
+    hasConstantResult = false;
+    if (function->name == NextValFunction::name || ExpressionVisitor::isRandom(*expression)) {
+        return;
+    }
+    for (auto& child : children) {
+        switch (child->getEvaluatorType()) {
+        case EvaluatorType::LITERAL:
+            continue;
+        case EvaluatorType::FUNCTION:
+            if (child->constCast<FunctionExpressionEvaluator>().isConstant) {
+                continue;
+            }
+            return;
+        default:
+            return;
+        }
+    }
+    isConstant = true;
+}
+
+static bool hasSelectKernel(const LogicalType& type) {
+    switch (type.getPhysicalType()) {
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::FLOAT:
+    case PhysicalTypeID::DOUBLE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static std::optional<SelectKernelOp> getSelectKernelOp(ExpressionType type) {
+    switch (type) {
+    case ExpressionType::EQUALS:
+        return SelectKernelOp::EQUALS;
+    case ExpressionType::NOT_EQUALS:
+        return SelectKernelOp::NOT_EQUALS;
+    case ExpressionType::GREATER_THAN:
+        return SelectKernelOp::GREATER_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return SelectKernelOp::GREATER_THAN_EQUALS;
+    case ExpressionType::LESS_THAN:
+        return SelectKernelOp::LESS_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return SelectKernelOp::LESS_THAN_EQUALS;
+    default:
+        return std::nullopt;
+    }
+}
+
+// Kernels only read plain columns, whose evaluation has no side effects. This allows falling back
+// to the function after the column has been evaluated.
+static bool isColumnAndConstant(const ExpressionEvaluator& column,
+    const ExpressionEvaluator& constant) {
+    return column.getEvaluatorType() == EvaluatorType::REFERENCE &&
+           constant.getEvaluatorType() == EvaluatorType::LITERAL;
+}
+
+static const SelectKernelInfo* getCompareKernelInfo(const ExpressionEvaluator& evaluator) {
+    if (evaluator.getEvaluatorType() != EvaluatorType::FUNCTION) {
+        return nullptr;
+    }
+    auto info = evaluator.constCast<FunctionExpressionEvaluator>().getSelectKernelInfo();
+    if (info == nullptr || info->kind != SelectKernelInfo::Kind::COMPARE) {
+        return nullptr;
+    }
+    return info;
+}
+
+void FunctionExpressionEvaluator::resolveSelectKernel() {
+    if (auto op = getSelectKernelOp(expression->expressionType)) {
+        KU_ASSERT(children.size() == 2);
+        auto& left = *children[0];
+        auto& right = *children[1];
+        if (!hasSelectKernel(left.resultVector->dataType) ||
+            left.resultVector->dataType.getPhysicalType() !=
+                right.resultVector->dataType.getPhysicalType()) {
+            return;
+        }
+        if (isColumnAndConstant(left, right)) {
+            selectKernelInfo = std::make_unique<SelectKernelInfo>(SelectKernelInfo::Kind::COMPARE,
+                &left, right.resultVector.get(), *op);
+        } else if (isColumnAndConstant(right, left)) {
+            selectKernelInfo = std::make_unique<SelectKernelInfo>(SelectKernelInfo::Kind::COMPARE,
+                &right, left.resultVector.get(), SelectKernelOpUtil::flip(*op));
+        }
+    } else if (expression->expressionType == ExpressionType::AND) {
+        // x >= lower AND x <= upper.
+        auto lower = getCompareKernelInfo(*children[0]);
+        auto upper = getCompareKernelInfo(*children[1]);
+        if (lower == nullptr || upper == nullptr ||
+            lower->columnEvaluator->getExpression()->getUniqueName() !=
+                upper->columnEvaluator->getExpression()->getUniqueName()) {
+            return;
+        }
+        if (SelectKernelOpUtil::isUpperBound(lower->op)) {
+            std::swap(lower, upper);
+        }
+        if (!SelectKernelOpUtil::isLowerBound(lower->op) ||
+            !SelectKernelOpUtil::isUpperBound(upper->op)) {
+            return;
+        }
+        selectKernelInfo = std::make_unique<SelectKernelInfo>(SelectKernelInfo::Kind::BETWEEN,
+            lower->columnEvaluator, lower->constant, lower->op);
+        selectKernelInfo->upperConstant = upper->constant;
+        selectKernelInfo->upperOp = upper->op;
+    } else if (expression->expressionType == ExpressionType::FUNCTION &&
+               function->name == ListContainsFunction::name) {
+        // x IN [c1, c2, ...] is bound to list_contains([c1, c2, ...], x).
+        auto& list = *children[0];
+        auto& element = *children[1];
+        if (isColumnAndConstant(element, list) && hasSelectKernel(element.resultVector->dataType) &&
+            ListType::getChildType(list.resultVector->dataType).getPhysicalType() ==
+                element.resultVector->dataType.getPhysicalType()) {
+            selectKernelInfo = std::make_unique<SelectKernelInfo>(SelectKernelInfo::Kind::IN,
+                &element, list.resultVector.get(), SelectKernelOp::EQUALS);
+        }
+    }
+}
+
+bool FunctionExpressionEvaluator::trySelectWithKernel(SelectionVector& selVector,
+    bool& hasSelectedValues) {
+    auto& info = *selectKernelInfo;
+    info.columnEvaluator->evaluate();
+    auto& column = *info.columnEvaluator->resultVector;
+    if (column.state->isFlat()) {
+        return false;
+    }
+    auto constantPos = info.constant->state->getSelVector()[0];
+    if (info.constant->isNull(constantPos)) {
+        return false;
+    }
+    if (info.kind == SelectKernelInfo::Kind::BETWEEN &&
+        info.upperConstant->isNull(info.upperConstant->state->getSelVector()[0])) {
+        return false;
+    }
+    const list_entry_t* listEntry = nullptr;
+    if (info.kind == SelectKernelInfo::Kind::IN) {
+        listEntry = &info.constant->getValue<list_entry_t>(constantPos);
+        auto listDataVector = ListVector::getDataVector(info.constant);
+        for (auto i = 0u; i < listEntry->size; i++) {
+            if (listDataVector->isNull(listEntry->offset + i)) {
+                return false;
+            }
+        }
+    }
+    auto& input = column.state->getSelVector();
+    auto output = selVector.getMutableBuffer().data();
+    auto numSelected = TypeUtils::visit(column.dataType.getPhysicalType(), [&]<typename T>(T) {
+        if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+            auto values = reinterpret_cast<const T*>(column.getData());
+            auto constant = info.constant->getValue<T>(constantPos);
+            switch (info.kind) {
+            case SelectKernelInfo::Kind::COMPARE:
+                return ComparisonSelectKernels::compare<T>(values, input, info.op, constant,
+                    output);
+            case SelectKernelInfo::Kind::BETWEEN: {
+                auto upper = info.upperConstant->getValue<T>(
+                    info.upperConstant->state->getSelVector()[0]);
+                return ComparisonSelectKernels::between<T>(values, input, info.op, constant,
+                    info.upperOp, upper, output);
+            }
+            case SelectKernelInfo::Kind::IN: {
+                auto constants = reinterpret_cast<const T*>(
+                    ListVector::getListValues(info.constant, *listEntry));
+                return ComparisonSelectKernels::in<T>(values, input,
+                    std::span<const T>(constants, listEntry->size), output);
+            }
+            default:
+                KU_UNREACHABLE;
+            }
+        } else {
+            KU_UNREACHABLE;
+            return uint64_t{0};
+        }
+    });
+    if (!column.hasNoNullsGuarantee()) {
+        uint64_t numNonNullSelected = 0;
+        for (auto i = 0u; i < numSelected; i++) {
+            output[numNonNullSelected] = output[i];
+            numNonNullSelected += !column.isNull(output[i]);
+        }
+        numSelected = numNonNullSelected;
+    }
+    selVector.setSelSize(numSelected);
+    hasSelectedValues = numSelected > 0;
+    return true;
 }
 
 } // namespace evaluator
@@ -22,10 +22,21 @@ void CountStarFunction::updatePos(uint8_t* state_, ValueVector* input, uint64_t
     state->count += multiplicity;
 }
 
+void CountStarFunction::updateBatch(uint8_t** entries, uint32_t stateOffset, ValueVector* input,
+    const SelectionVector& selVector, uint64_t multiplicity,
+    InMemOverflowBuffer* /*overflowBuffer*/) {
+    KU_ASSERT(input == nullptr);
+    (void)input;
+    selVector.forEach([&](auto pos) {
+        reinterpret_cast<CountState*>(entries[pos] + stateOffset)->count += multiplicity;
+    });
+}
+
 function_set CountStarFunction::getFunctionSet() {
     function_set result;
     auto aggFunc = std::make_unique<AggregateFunction>(name, std::vector<LogicalTypeID>{},
         LogicalTypeID::INT64, initialize, updateAll, updatePos, combine, finalize, false);
+    aggFunc->updateBatchFunc = updateBatch;
     aggFunc->needToHandleNulls = true;
     result.push_back(std::move(aggFunc));
     return result;
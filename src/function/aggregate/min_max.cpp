@@ -22,6 +22,7 @@ static void getMinMaxFunction(std::string name, function_set& set) {
                         MinMaxFunction<T>::template updatePos<FUNC>,
                         MinMaxFunction<T>::template combine<FUNC>, MinMaxFunction<T>::finalize,
                         isDistinct);
+                    func->updateBatchFunc = MinMaxFunction<T>::template updateBatch<FUNC>;
                 },
                 [](auto) { KU_UNREACHABLE; });
             set.push_back(std::move(func));
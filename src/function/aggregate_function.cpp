@@ -18,6 +18,7 @@ AggregateFunction::AggregateFunction(const AggregateFunction& other)
     initializeFunc = other.initializeFunc;
     updateAllFunc = other.updateAllFunc;
     updatePosFunc = other.updatePosFunc;
+    updateBatchFunc = other.updateBatchFunc;
     combineFunc = other.combineFunc;
     finalizeFunc = other.finalizeFunc;
     paramRewriteFunc = other.paramRewriteFunc;
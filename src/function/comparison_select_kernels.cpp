@@ -0,0 +1,732 @@
+#include "function/comparison/comparison_select_kernels.h"
+
+#include <bit>
+#include <type_traits>
+
+#include "common/assert.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define LBUG_SELECT_KERNELS_X86
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define LBUG_SELECT_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+using namespace lbug::common;
+
+namespace lbug {
+namespace function {
+
+SelectKernelOp SelectKernelOpUtil::flip(SelectKernelOp op) {
+    switch (op) {
+    case SelectKernelOp::EQUALS:
+    case SelectKernelOp::NOT_EQUALS:
+        return op;
+    case SelectKernelOp::GREATER_THAN:
+        return SelectKernelOp::LESS_THAN;
+    case SelectKernelOp::GREATER_THAN_EQUALS:
+        return SelectKernelOp::LESS_THAN_EQUALS;
+    case SelectKernelOp::LESS_THAN:
+        return SelectKernelOp::GREATER_THAN;
+    case SelectKernelOp::LESS_THAN_EQUALS:
+        return SelectKernelOp::GREATER_THAN_EQUALS;
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+// All operators are derived from == and > the same way as in comparison_functions.h, so that the
+// kernels agree with the scalar functions on NaN.
+static inline uint32_t combineMasks(SelectKernelOp op, uint32_t eq, uint32_t gt,
+    uint32_t allLanes) {
+    switch (op) {
+    case SelectKernelOp::EQUALS:
+        return eq;
+    case SelectKernelOp::NOT_EQUALS:
+        return ~eq & allLanes;
+    case SelectKernelOp::GREATER_THAN:
+        return gt;
+    case SelectKernelOp::GREATER_THAN_EQUALS:
+        return gt | eq;
+    case SelectKernelOp::LESS_THAN:
+        return ~(gt | eq) & allLanes;
+    case SelectKernelOp::LESS_THAN_EQUALS:
+        return ~gt & allLanes;
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+template<typename T>
+static inline bool compareValue(T value, SelectKernelOp op, T constant) {
+    return combineMasks(op, value == constant, value > constant, 1 /* allLanes */);
+}
+
+template<typename T>
+struct ComparePredicate {
+    SelectKernelOp op;
+    T constant;
+
+    bool operator()(T value) const { return compareValue(value, op, constant); }
+};
+
+template<typename T>
+struct BetweenPredicate {
+    SelectKernelOp lowerOp;
+    T lower;
+    SelectKernelOp upperOp;
+    T upper;
+
+    bool operator()(T value) const {
+        return compareValue(value, lowerOp, lower) & compareValue(value, upperOp, upper);
+    }
+};
+
+template<typename T>
+struct InPredicate {
+    std::span<const T> constants;
+
+    bool operator()(T value) const {
+        bool result = false;
+        for (auto constant : constants) {
+            result |= value == constant;
+        }
+        return result;
+    }
+};
+
+// Writes every position and only advances the output for qualifying values, so that the loop has
+// no data-dependent branches and can run in place on the input positions.
+template<typename T, typename PRED>
+static uint64_t selectScalar(const T* values, const SelectionView& input, const PRED& pred,
+    sel_t* output) {
+    uint64_t numSelected = 0;
+    input.forEach([&](auto pos) {
+        output[numSelected] = pos;
+        numSelected += pred(values[pos]);
+    });
+    return numSelected;
+}
+
+static inline uint64_t appendPositions(uint32_t mask, sel_t basePos, sel_t* output,
+    uint64_t numSelected) {
+    while (mask != 0) {
+        output[numSelected++] = basePos + std::countr_zero(mask);
+        mask &= mask - 1;
+    }
+    return numSelected;
+}
+
+template<typename T>
+static constexpr bool hasSIMDKernel =
+    std::is_same_v<T, int32_t> || std::is_same_v<T, uint32_t> || std::is_same_v<T, int64_t> ||
+    std::is_same_v<T, uint64_t> || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+#ifdef LBUG_SELECT_KERNELS_X86
+
+#ifdef __clang__
+#pragma clang attribute push(__attribute__((target("avx2,bmi"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2,bmi")
+#endif
+
+namespace avx2 {
+
+template<typename T>
+struct Lanes;
+
+template<>
+struct Lanes<int32_t> {
+    using vec_t = __m256i;
+    static constexpr uint32_t NUM_LANES = 8;
+    static vec_t set1(int32_t value) { return _mm256_set1_epi32(value); }
+    static vec_t load(const int32_t* values) { return _mm256_loadu_si256((const vec_t*)values); }
+    static uint32_t eq(vec_t a, vec_t b) {
+        return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)));
+    }
+    static uint32_t gt(vec_t a, vec_t b) {
+        return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(a, b)));
+    }
+};
+
+template<>
+struct Lanes<uint32_t> {
+    using vec_t = __m256i;
+    static constexpr uint32_t NUM_LANES = 8;
+    static vec_t set1(uint32_t value) { return _mm256_set1_epi32((int32_t)value); }
+    static vec_t load(const uint32_t* values) { return _mm256_loadu_si256((const vec_t*)values); }
+    static uint32_t eq(vec_t a, vec_t b) { return Lanes<int32_t>::eq(a, b); }
+    // AVX2 only compares signed integers. Flipping the sign bit preserves the unsigned order.
+    static uint32_t gt(vec_t a, vec_t b) {
+        auto signBit = _mm256_set1_epi32(INT32_MIN);
+        return Lanes<int32_t>::gt(_mm256_xor_si256(a, signBit), _mm256_xor_si256(b, signBit));
+    }
+};
+
+template<>
+struct Lanes<int64_t> {
+    using vec_t = __m256i;
+    static constexpr uint32_t NUM_LANES = 4;
+    static vec_t set1(int64_t value) { return _mm256_set1_epi64x(value); }
+    static vec_t load(const int64_t* values) { return _mm256_loadu_si256((const vec_t*)values); }
+    static uint32_t eq(vec_t a, vec_t b) {
+        return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b)));
+    }
+    static uint32_t gt(vec_t a, vec_t b) {
+        return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(a, b)));
+    }
+};
+
+template<>
+struct Lanes<uint64_t> {
+    using vec_t = __m256i;
+    static constexpr uint32_t NUM_LANES = 4;
+    static vec_t set1(uint64_t value) { return _mm256_set1_epi64x((int64_t)value); }
+    static vec_t load(const uint64_t* values) { return _mm256_loadu_si256((const vec_t*)values); }
+    static uint32_t eq(vec_t a, vec_t b) { return Lanes<int64_t>::eq(a, b); }
+    static uint32_t gt(vec_t a, vec_t b) {
+        auto signBit = _mm256_set1_epi64x(INT64_MIN);
+        return Lanes<int64_t>::gt(_mm256_xor_si256(a, signBit), _mm256_xor_si256(b, signBit));
+    }
+};
+
+template<>
+struct Lanes<float> {
+    using vec_t = __m256;
+    static constexpr uint32_t NUM_LANES = 8;
+    static vec_t set1(float value) { return _mm256_set1_ps(value); }
+    static vec_t load(const float* values) { return _mm256_loadu_ps(values); }
+    static uint32_t eq(vec_t a, vec_t b) {
+        return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+    }
+    static uint32_t gt(vec_t a, vec_t b) {
+        return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GT_OQ));
+    }
+};
+
+template<>
+struct Lanes<double> {
+    using vec_t = __m256d;
+    static constexpr uint32_t NUM_LANES = 4;
+    static vec_t set1(double value) { return _mm256_set1_pd(value); }
+    static vec_t load(const double* values) { return _mm256_loadu_pd(values); }
+    static uint32_t eq(vec_t a, vec_t b) {
+        return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ));
+    }
+    static uint32_t gt(vec_t a, vec_t b) {
+        return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GT_OQ));
+    }
+};
+
+template<typename T>
+struct CompareMask {
+    using L = Lanes<T>;
+    SelectKernelOp op;
+    typename L::vec_t constant;
+
+    uint32_t operator()(typename L::vec_t values) const {
+        return combineMasks(op, L::eq(values, constant), L::gt(values, constant),
+            (1u << L::NUM_LANES) - 1);
+    }
+};
+
+template<typename T>
+struct BetweenMask {
+    CompareMask<T> lower;
+    CompareMask<T> upper;
+
+    uint32_t operator()(typename Lanes<T>::vec_t values) const {
+        return lower(values) & upper(values);
+    }
+};
+
+template<typename T>
+struct InMask {
+    std::span<const T> constants;
+
+    uint32_t operator()(typename Lanes<T>::vec_t values) const {
+        uint32_t mask = 0;
+        for (auto constant : constants) {
+            mask |= Lanes<T>::eq(values, Lanes<T>::set1(constant));
+        }
+        return mask;
+    }
+};
+
+template<typename T, typename MASK, typename PRED>
+static uint64_t selectContiguous(const T* values, sel_t startPos, sel_t numValues,
+    const MASK& mask, const PRED& pred, sel_t* output) {
+    using L = Lanes<T>;
+    uint64_t numSelected = 0;
+    auto pos = startPos;
+    const auto endPos = startPos + numValues;
+    for (; pos + L::NUM_LANES <= endPos; pos += L::NUM_LANES) {
+        numSelected = appendPositions(mask(L::load(values + pos)), pos, output, numSelected);
+    }
+    for (; pos < endPos; pos++) {
+        output[numSelected] = pos;
+        numSelected += pred(values[pos]);
+    }
+    return numSelected;
+}
+
+template<typename T>
+static uint64_t compare(const T* values, sel_t startPos, sel_t numValues, SelectKernelOp op,
+    T constant, sel_t* output) {
+    return selectContiguous(values, startPos, numValues,
+        CompareMask<T>{op, Lanes<T>::set1(constant)}, ComparePredicate<T>{op, constant}, output);
+}
+
+template<typename T>
+static uint64_t between(const T* values, sel_t startPos, sel_t numValues, SelectKernelOp lowerOp,
+    T lower, SelectKernelOp upperOp, T upper, sel_t* output) {
+    auto mask = BetweenMask<T>{CompareMask<T>{lowerOp, Lanes<T>::set1(lower)},
+        CompareMask<T>{upperOp, Lanes<T>::set1(upper)}};
+    return selectContiguous(values, startPos, numValues, mask,
+        BetweenPredicate<T>{lowerOp, lower, upperOp, upper}, output);
+}
+
+template<typename T>
+static uint64_t in(const T* values, sel_t startPos, sel_t numValues, std::span<const T> constants,
+    sel_t* output) {
+    return selectContiguous(values, startPos, numValues, InMask<T>{constants},
+        InPredicate<T>{constants}, output);
+}
+
+} // namespace avx2
+
+#ifdef __clang__
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#ifdef __clang__
+#pragma clang attribute push(__attribute__((target("avx512f,bmi"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx512f,bmi")
+#endif
+
+namespace avx512 {
+
+template<typename T>
+struct Lanes;
+
+template<>
+struct Lanes<int32_t> {
+    using vec_t = __m512i;
+    static constexpr uint32_t NUM_LANES = 16;
+    static vec_t set1(int32_t value) { return _mm512_set1_epi32(value); }
+    static vec_t load(const int32_t* values) { return _mm512_loadu_si512(values); }
+    static uint32_t eq(vec_t a, vec_t b) { return _mm512_cmpeq_epi32_mask(a, b); }
+    static uint32_t gt(vec_t a, vec_t b) { return _mm512_cmpgt_epi32_mask(a, b); }
+};
+
+template<>
+struct Lanes<uint32_t> {
+    using vec_t = __m512i;
+    static constexpr uint32_t NUM_LANES = 16;
+    static vec_t set1(uint32_t value) { return _mm512_set1_epi32((int32_t)value); }
+    static vec_t load(const uint32_t* values) { return _mm512_loadu_si512(values); }
+    static uint32_t eq(vec_t a, vec_t b) { return _mm512_cmpeq_epu32_mask(a, b); }
+    static uint32_t gt(vec_t a, vec_t b) { return _mm512_cmpgt_epu32_mask(a, b); }
+};
+
+template<>
+struct Lanes<int64_t> {
+    using vec_t = __m512i;
+    static constexpr uint32_t NUM_LANES = 8;
+    static vec_t set1(int64_t value) { return _mm512_set1_epi64(value); }
+    static vec_t load(const int64_t* values) { return _mm512_loadu_si512(values); }
+    static uint32_t eq(vec_t a, vec_t b) { return _mm512_cmpeq_epi64_mask(a, b); }
+    static uint32_t gt(vec_t a, vec_t b) { return _mm512_cmpgt_epi64_mask(a, b); }
+};
+
+template<>
+struct Lanes<uint64_t> {
+    using vec_t = __m512i;
+    static constexpr uint32_t NUM_LANES = 8;
+    static vec_t set1(uint64_t value) { return _mm512_set1_epi64((int64_t)value); }
+    static vec_t load(const uint64_t* values) { return _mm512_loadu_si512(values); }
+    static uint32_t eq(vec_t a, vec_t b) { return _mm512_cmpeq_epu64_mask(a, b); }
+    static uint32_t gt(vec_t a, vec_t b) { return _mm512_cmpgt_epu64_mask(a, b); }
+};
+
+template<>
+struct Lanes<float> {
+    using vec_t = __m512;
+    static constexpr uint32_t NUM_LANES = 16;
+    static vec_t set1(float value) { return _mm512_set1_ps(value); }
+    static vec_t load(const float* values) { return _mm512_loadu_ps(values); }
+    static uint32_t eq(vec_t a, vec_t b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+    static uint32_t gt(vec_t a, vec_t b) { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+};
+
+template<>
+struct Lanes<double> {
+    using vec_t = __m512d;
+    static constexpr uint32_t NUM_LANES = 8;
+    static vec_t set1(double value) { return _mm512_set1_pd(value); }
+    static vec_t load(const double* values) { return _mm512_loadu_pd(values); }
+    static uint32_t eq(vec_t a, vec_t b) { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+    static uint32_t gt(vec_t a, vec_t b) { return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ); }
+};
+
+// Writes the positions of 8 lanes at a time with a compress store instead of iterating over the
+// bits of the mask.
+static inline uint64_t compressPositions(uint32_t mask, sel_t basePos, sel_t* output,
+    uint64_t numSelected) {
+    const auto laneOffsets = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+    for (; mask != 0; mask >>= 8, basePos += 8) {
+        auto laneMask = (__mmask8)(mask & 0xFF);
+        auto positions = _mm512_add_epi64(_mm512_set1_epi64((int64_t)basePos), laneOffsets);
+        _mm512_mask_compressstoreu_epi64(output + numSelected, laneMask, positions);
+        numSelected += std::popcount((uint32_t)laneMask);
+    }
+    return numSelected;
+}
+
+template<typename T>
+struct CompareMask {
+    using L = Lanes<T>;
+    SelectKernelOp op;
+    typename L::vec_t constant;
+
+    uint32_t operator()(typename L::vec_t values) const {
+        return combineMasks(op, L::eq(values, constant), L::gt(values, constant),
+            (1u << L::NUM_LANES) - 1);
+    }
+};
+
+template<typename T>
+struct BetweenMask {
+    CompareMask<T> lower;
+    CompareMask<T> upper;
+
+    uint32_t operator()(typename Lanes<T>::vec_t values) const {
+        return lower(values) & upper(values);
+    }
+};
+
+template<typename T>
+struct InMask {
+    std::span<const T> constants;
+
+    uint32_t operator()(typename Lanes<T>::vec_t values) const {
+        uint32_t mask = 0;
+        for (auto constant : constants) {
+            mask |= Lanes<T>::eq(values, Lanes<T>::set1(constant));
+        }
+        return mask;
+    }
+};
+
+template<typename T, typename MASK, typename PRED>
+static uint64_t selectContiguous(const T* values, sel_t startPos, sel_t numValues,
+    const MASK& mask, const PRED& pred, sel_t* output) {
+    using L = Lanes<T>;
+    uint64_t numSelected = 0;
+    auto pos = startPos;
+    const auto endPos = startPos + numValues;
+    for (; pos + L::NUM_LANES <= endPos; pos += L::NUM_LANES) {
+        numSelected = compressPositions(mask(L::load(values + pos)), pos, output, numSelected);
+    }
+    for (; pos < endPos; pos++) {
+        output[numSelected] = pos;
+        numSelected += pred(values[pos]);
+    }
+    return numSelected;
+}
+
+template<typename T>
+static uint64_t compare(const T* values, sel_t startPos, sel_t numValues, SelectKernelOp op,
+    T constant, sel_t* output) {
+    return selectContiguous(values, startPos, numValues,
+        CompareMask<T>{op, Lanes<T>::set1(constant)}, ComparePredicate<T>{op, constant}, output);
+}
+
+template<typename T>
+static uint64_t between(const T* values, sel_t startPos, sel_t numValues, SelectKernelOp lowerOp,
+    T lower, SelectKernelOp upperOp, T upper, sel_t* output) {
+    auto mask = BetweenMask<T>{CompareMask<T>{lowerOp, Lanes<T>::set1(lower)},
+        CompareMask<T>{upperOp, Lanes<T>::set1(upper)}};
+    return selectContiguous(values, startPos, numValues, mask,
+        BetweenPredicate<T>{lowerOp, lower, upperOp, upper}, output);
+}
+
+template<typename T>
+static uint64_t in(const T* values, sel_t startPos, sel_t numValues, std::span<const T> constants,
+    sel_t* output) {
+    return selectContiguous(values, startPos, numValues, InMask<T>{constants},
+        InPredicate<T>{constants}, output);
+}
+
+} // namespace avx512
+
+#ifdef __clang__
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#endif // LBUG_SELECT_KERNELS_X86
+
+#ifdef LBUG_SELECT_KERNELS_NEON
+
+namespace neon {
+
+static inline uint32_t toMask(uint32x4_t lanes) {
+    static constexpr uint32_t laneBits[4] = {1, 2, 4, 8};
+    return vaddvq_u32(vandq_u32(lanes, vld1q_u32(laneBits)));
+}
+
+static inline uint32_t toMask(uint64x2_t lanes) {
+    static constexpr uint64_t laneBits[2] = {1, 2};
+    return vaddvq_u64(vandq_u64(lanes, vld1q_u64(laneBits)));
+}
+
+template<typename T>
+struct Lanes;
+
+template<>
+struct Lanes<int32_t> {
+    using vec_t = int32x4_t;
+    static constexpr uint32_t NUM_LANES = 4;
+    static vec_t set1(int32_t value) { return vdupq_n_s32(value); }
+    static vec_t load(const int32_t* values) { return vld1q_s32(values); }
+    static uint32_t eq(vec_t a, vec_t b) { return toMask(vceqq_s32(a, b)); }
+    static uint32_t gt(vec_t a, vec_t b) { return toMask(vcgtq_s32(a, b)); }
+};
+
+template<>
+struct Lanes<uint32_t> {
+    using vec_t = uint32x4_t;
+    static constexpr uint32_t NUM_LANES = 4;
+    static vec_t set1(uint32_t value) { return vdupq_n_u32(value); }
+    static vec_t load(const uint32_t* values) { return vld1q_u32(values); }
+    static uint32_t eq(vec_t a, vec_t b) { return toMask(vceqq_u32(a, b)); }
+    static uint32_t gt(vec_t a, vec_t b) { return toMask(vcgtq_u32(a, b)); }
+};
+
+template<>
+struct Lanes<int64_t> {
+    using vec_t = int64x2_t;
+    static constexpr uint32_t NUM_LANES = 2;
+    static vec_t set1(int64_t value) { return vdupq_n_s64(value); }
+    static vec_t load(const int64_t* values) { return vld1q_s64(values); }
+    static uint32_t eq(vec_t a, vec_t b) { return toMask(vceqq_s64(a, b)); }
+    static uint32_t gt(vec_t a, vec_t b) { return toMask(vcgtq_s64(a, b)); }
+};
+
+template<>
+struct Lanes<uint64_t> {
+    using vec_t = uint64x2_t;
+    static constexpr uint32_t NUM_LANES = 2;
+    static vec_t set1(uint64_t value) { return vdupq_n_u64(value); }
+    static vec_t load(const uint64_t* values) { return vld1q_u64(values); }
+    static uint32_t eq(vec_t a, vec_t b) { return toMask(vceqq_u64(a, b)); }
+    static uint32_t gt(vec_t a, vec_t b) { return toMask(vcgtq_u64(a, b)); }
+};
+
+template<>
+struct Lanes<float> {
+    using vec_t = float32x4_t;
+    static constexpr uint32_t NUM_LANES = 4;
+    static vec_t set1(float value) { return vdupq_n_f32(value); }
+    static vec_t load(const float* values) { return vld1q_f32(values); }
+    static uint32_t eq(vec_t a, vec_t b) { return toMask(vceqq_f32(a, b)); }
+    static uint32_t gt(vec_t a, vec_t b) { return toMask(vcgtq_f32(a, b)); }
+};
+
+template<>
+struct Lanes<double> {
+    using vec_t = float64x2_t;
+    static constexpr uint32_t NUM_LANES = 2;
+    static vec_t set1(double value) { return vdupq_n_f64(value); }
+    static vec_t load(const double* values) { return vld1q_f64(values); }
+    static uint32_t eq(vec_t a, vec_t b) { return toMask(vceqq_f64(a, b)); }
+    static uint32_t gt(vec_t a, vec_t b) { return toMask(vcgtq_f64(a, b)); }
+};
+
+template<typename T>
+struct CompareMask {
+    using L = Lanes<T>;
+    SelectKernelOp op;
+    typename L::vec_t constant;
+
+    uint32_t operator()(typename L::vec_t values) const {
+        return combineMasks(op, L::eq(values, constant), L::gt(values, constant),
+            (1u << L::NUM_LANES) - 1);
+    }
+};
+
+template<typename T>
+struct BetweenMask {
+    CompareMask<T> lower;
+    CompareMask<T> upper;
+
+    uint32_t operator()(typename Lanes<T>::vec_t values) const {
+        return lower(values) & upper(values);
+    }
+};
+
+template<typename T>
+struct InMask {
+    std::span<const T> constants;
+
+    uint32_t operator()(typename Lanes<T>::vec_t values) const {
+        uint32_t mask = 0;
+        for (auto constant : constants) {
+            mask |= Lanes<T>::eq(values, Lanes<T>::set1(constant));
+        }
+        return mask;
+    }
+};
+
+template<typename T, typename MASK, typename PRED>
+static uint64_t selectContiguous(const T* values, sel_t startPos, sel_t numValues,
+    const MASK& mask, const PRED& pred, sel_t* output) {
+    using L = Lanes<T>;
+    uint64_t numSelected = 0;
+    auto pos = startPos;
+    const auto endPos = startPos + numValues;
+    for (; pos + L::NUM_LANES <= endPos; pos += L::NUM_LANES) {
+        numSelected = appendPositions(mask(L::load(values + pos)), pos, output, numSelected);
+    }
+    for (; pos < endPos; pos++) {
+        output[numSelected] = pos;
+        numSelected += pred(values[pos]);
+    }
+    return numSelected;
+}
+
+template<typename T>
+static uint64_t compare(const T* values, sel_t startPos, sel_t numValues, SelectKernelOp op,
+    T constant, sel_t* output) {
+    return selectContiguous(values, startPos, numValues,
+        CompareMask<T>{op, Lanes<T>::set1(constant)}, ComparePredicate<T>{op, constant}, output);
+}
+
+template<typename T>
+static uint64_t between(const T* values, sel_t startPos, sel_t numValues, SelectKernelOp lowerOp,
+    T lower, SelectKernelOp upperOp, T upper, sel_t* output) {
+    auto mask = BetweenMask<T>{CompareMask<T>{lowerOp, Lanes<T>::set1(lower)},
+        CompareMask<T>{upperOp, Lanes<T>::set1(upper)}};
+    return selectContiguous(values, startPos, numValues, mask,
+        BetweenPredicate<T>{lowerOp, lower, upperOp, upper}, output);
+}
+
+template<typename T>
+static uint64_t in(const T* values, sel_t startPos, sel_t numValues, std::span<const T> constants,
+    sel_t* output) {
+    return selectContiguous(values, startPos, numValues, InMask<T>{constants},
+        InPredicate<T>{constants}, output);
+}
+
+} // namespace neon
+
+#endif // LBUG_SELECT_KERNELS_NEON
+
+enum class SelectKernelISA : uint8_t {
+    SCALAR = 0,
+    AVX2 = 1,
+    AVX512 = 2,
+    NEON = 3,
+};
+
+static SelectKernelISA getSelectKernelISA() {
+    static const auto isa = [] {
+#if defined(LBUG_SELECT_KERNELS_X86)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return SelectKernelISA::AVX512;
+        }
+        if (__builtin_cpu_supports("avx2")) {
+            return SelectKernelISA::AVX2;
+        }
+        return SelectKernelISA::SCALAR;
+#elif defined(LBUG_SELECT_KERNELS_NEON)
+        return SelectKernelISA::NEON;
+#else
+        return SelectKernelISA::SCALAR;
+#endif
+    }();
+    return isa;
+}
+
+// SIMD kernels only run over unfiltered input, i.e. consecutive positions.
+#if defined(LBUG_SELECT_KERNELS_X86)
+#define DISPATCH_SIMD_KERNEL(KERNEL, ...)                                                          \
+    switch (getSelectKernelISA()) {                                                                \
+    case SelectKernelISA::AVX512:                                                                  \
+        return avx512::KERNEL(values, input[0], input.getSelSize(), __VA_ARGS__, output);         \
+    case SelectKernelISA::AVX2:                                                                    \
+        return avx2::KERNEL(values, input[0], input.getSelSize(), __VA_ARGS__, output);           \
+    default:                                                                                       \
+        break;                                                                                     \
+    }
+#elif defined(LBUG_SELECT_KERNELS_NEON)
+#define DISPATCH_SIMD_KERNEL(KERNEL, ...)                                                          \
+    return neon::KERNEL(values, input[0], input.getSelSize(), __VA_ARGS__, output);
+#else
+#define DISPATCH_SIMD_KERNEL(KERNEL, ...)
+#endif
+
+template<typename T>
+uint64_t ComparisonSelectKernels::compare(const T* values, const SelectionView& input,
+    SelectKernelOp op, T constant, sel_t* output) {
+    if constexpr (hasSIMDKernel<T>) {
+        if (input.isStatic() && input.getSelSize() > 0) {
+            DISPATCH_SIMD_KERNEL(compare, op, constant)
+        }
+    }
+    return selectScalar(values, input, ComparePredicate<T>{op, constant}, output);
+}
+
+template<typename T>
+uint64_t ComparisonSelectKernels::between(const T* values, const SelectionView& input,
+    SelectKernelOp lowerOp, T lower, SelectKernelOp upperOp, T upper, sel_t* output) {
+    if constexpr (hasSIMDKernel<T>) {
+        if (input.isStatic() && input.getSelSize() > 0) {
+            DISPATCH_SIMD_KERNEL(between, lowerOp, lower, upperOp, upper)
+        }
+    }
+    return selectScalar(values, input, BetweenPredicate<T>{lowerOp, lower, upperOp, upper},
+        output);
+}
+
+template<typename T>
+uint64_t ComparisonSelectKernels::in(const T* values, const SelectionView& input,
+    std::span<const T> constants, sel_t* output) {
+    if constexpr (hasSIMDKernel<T>) {
+        if (input.isStatic() && input.getSelSize() > 0) {
+            DISPATCH_SIMD_KERNEL(in, constants)
+        }
+    }
+    return selectScalar(values, input, InPredicate<T>{constants}, output);
+}
+
+#define INSTANTIATE_SELECT_KERNELS(T)                                                              \
+    template uint64_t ComparisonSelectKernels::compare<T>(const T*, const SelectionView&,          \
+        SelectKernelOp, T, sel_t*);                                                                \
+    template uint64_t ComparisonSelectKernels::between<T>(const T*, const SelectionView&,          \
+        SelectKernelOp, T, SelectKernelOp, T, sel_t*);                                             \
+    template uint64_t ComparisonSelectKernels::in<T>(const T*, const SelectionView&,               \
+        std::span<const T>, sel_t*);
+
+INSTANTIATE_SELECT_KERNELS(int8_t)
+INSTANTIATE_SELECT_KERNELS(int16_t)
+INSTANTIATE_SELECT_KERNELS(int32_t)
+INSTANTIATE_SELECT_KERNELS(int64_t)
+INSTANTIATE_SELECT_KERNELS(uint8_t)
+INSTANTIATE_SELECT_KERNELS(uint16_t)
+INSTANTIATE_SELECT_KERNELS(uint32_t)
+INSTANTIATE_SELECT_KERNELS(uint64_t)
+INSTANTIATE_SELECT_KERNELS(float)
+INSTANTIATE_SELECT_KERNELS(double)
+
+} // namespace function
+} // namespace lbug
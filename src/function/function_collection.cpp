@@ -232,11 +232,12 @@ FunctionCollection* FunctionCollection::getFunctions() {
         TABLE_FUNCTION(ShowLoadedExtensionsFunction),
         TABLE_FUNCTION(ShowOfficialExtensionsFunction), TABLE_FUNCTION(ShowIndexesFunction),
         TABLE_FUNCTION(ShowProjectedGraphsFunction), TABLE_FUNCTION(ProjectedGraphInfoFunction),
-        TABLE_FUNCTION(ShowMacrosFunction),
+        TABLE_FUNCTION(ShowMacrosFunction), TABLE_FUNCTION(PlanCacheInfoFunction),
 
         // Standalone Table functions
         STANDALONE_TABLE_FUNCTION(LocalCacheArrayColumnFunction),
         STANDALONE_TABLE_FUNCTION(ClearWarningsFunction),
+        STANDALONE_TABLE_FUNCTION(AnalyzeFunction),
         STANDALONE_TABLE_FUNCTION(ProjectGraphNativeFunction),
         STANDALONE_TABLE_FUNCTION(ProjectGraphCypherFunction),
         STANDALONE_TABLE_FUNCTION(DropProjectedGraphFunction),
@@ -1,6 +1,7 @@
 #include "binder/expression/node_expression.h"
 #include "common/exception/interrupt.h"
 #include "function/gds/auxiliary_state/path_auxiliary_state.h"
+#include "function/gds/delta_stepping.h"
 #include "function/gds/gds_function_collection.h"
 #include "function/gds/rec_joins.h"
 #include "function/gds/weight_utils.h"
@@ -161,6 +162,10 @@ private:
                 gdsState = std::make_unique<GDSComputeState>(std::move(frontierPair),
                     std::move(edgeCompute), std::move(auxiliaryState));
             });
+        auto auxiliaryState = gdsState->auxiliaryState->ptrCast<WSPPathsAuxiliaryState>();
+        DeltaSteppingBuckets::tryEnable(clientContext, bindData.upperBound,
+            [auxiliaryState](offset_t offset) { return auxiliaryState->getCost(offset); },
+            *gdsState);
         return gdsState;
     }
 
@@ -14,7 +14,7 @@ static constexpr uint64_t BFS_GRAPH_BLOCK_SIZE = (std::uint64_t)1 << 19;
 
 ObjectBlock<ParentList>* BaseBFSGraph::addNewBlock() {
     std::unique_lock lck{mtx};
-    auto memBlock = mm->allocateBuffer(false /* init to 0 */, BFS_GRAPH_BLOCK_SIZE);
+    auto memBlock = mm->allocateIntermediateBuffer(false /* init to 0 */, BFS_GRAPH_BLOCK_SIZE);
     blocks.push_back(
         std::make_unique<ObjectBlock<ParentList>>(std::move(memBlock), BFS_GRAPH_BLOCK_SIZE));
     return blocks[blocks.size() - 1].get();
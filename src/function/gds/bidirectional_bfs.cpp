@@ -0,0 +1,189 @@
+#include "function/gds/bidirectional_bfs.h"
+
+#include <algorithm>
+
+#include "common/exception/interrupt.h"
+#include "function/gds/auxiliary_state/path_auxiliary_state.h"
+#include "graph/graph_entry.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+
+using namespace lbug::common;
+using namespace lbug::graph;
+
+namespace lbug {
+namespace function {
+
+BidirectionalBFS::Side::Side(ExtendDirection direction, nodeID_t root, bool isSrc)
+    : direction{direction}, root{root}, isSrc{isSrc} {
+    parents.insert({root, Parent{root, relID_t{}, true /* isFwdScan */, 0 /* depth */}});
+    frontier.push_back(root);
+}
+
+BidirectionalBFS::BidirectionalBFS(Graph* graph, std::vector<std::string> propertiesToScan,
+    const LandmarkIndex* landmarkIndex)
+    : graph{graph}, trackEdgeIDs{!propertiesToScan.empty()}, landmarkIndex{landmarkIndex} {
+    for (auto& nodeInfo : graph->getGraphEntry()->nodeInfos) {
+        for (auto& relInfo : graph->getRelInfos(nodeInfo.entry->getTableID())) {
+            fwdScans[relInfo.srcTableID].push_back(
+                ScanInfo{graph->prepareRelScan(*relInfo.relGroupEntry, relInfo.relTableID,
+                             relInfo.dstTableID, propertiesToScan),
+                    true /* isFwd */});
+            bwdScans[relInfo.dstTableID].push_back(
+                ScanInfo{graph->prepareRelScan(*relInfo.relGroupEntry, relInfo.relTableID,
+                             relInfo.srcTableID, propertiesToScan),
+                    false /* isFwd */});
+        }
+    }
+}
+
+static ExtendDirection reverse(ExtendDirection direction) {
+    switch (direction) {
+    case ExtendDirection::FWD:
+        return ExtendDirection::BWD;
+    case ExtendDirection::BWD:
+        return ExtendDirection::FWD;
+    default:
+        return direction;
+    }
+}
+
+std::optional<BFSPath> BidirectionalBFS::search(processor::ExecutionContext* context,
+    nodeID_t sourceNodeID, nodeID_t dstNodeID, ExtendDirection direction, uint16_t maxLength) {
+    KU_ASSERT(sourceNodeID != dstNodeID);
+    maxPathLength = maxLength;
+    if (landmarkIndex != nullptr) {
+        auto bounds = landmarkIndex->getBounds(sourceNodeID, dstNodeID);
+        if (bounds.lower > maxLength) {
+            return std::nullopt;
+        }
+        maxPathLength = std::min(maxPathLength, bounds.upper);
+    }
+    auto srcSide = Side(direction, sourceNodeID, true /* isSrc */);
+    auto dstSide = Side(reverse(direction), dstNodeID, false /* isSrc */);
+    // A path found while expanding is at most srcSide.depth + dstSide.depth + 1 long.
+    while (srcSide.depth + dstSide.depth < maxLength) {
+        if (srcSide.frontier.empty() || dstSide.frontier.empty()) {
+            return std::nullopt;
+        }
+        if (context->clientContext->interrupted()) {
+            throw InterruptException{};
+        }
+        auto expandSrcSide = srcSide.frontier.size() <= dstSide.frontier.size();
+        auto meetNodeID =
+            expandSrcSide ? expand(srcSide, dstSide) : expand(dstSide, srcSide);
+        if (meetNodeID.has_value()) {
+            return getPath(srcSide, dstSide, *meetNodeID);
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<nodeID_t> BidirectionalBFS::expand(Side& side, const Side& otherSide) {
+    std::vector<nodeID_t> nextFrontier;
+    std::optional<nodeID_t> meetNodeID;
+    uint16_t meetDepth = UINT16_MAX;
+    auto nbrDepth = static_cast<uint16_t>(side.depth + 1);
+    auto isPruned = [&](nodeID_t nodeID) {
+        if (landmarkIndex == nullptr) {
+            return false;
+        }
+        auto lowerBound = side.isSrc ? landmarkIndex->getLowerBound(nodeID, otherSide.root) :
+                                       landmarkIndex->getLowerBound(otherSide.root, nodeID);
+        return nbrDepth + lowerBound > maxPathLength;
+    };
+    auto scanNbrs = [&](nodeID_t nodeID, const table_id_map_t<std::vector<ScanInfo>>& scans) {
+        if (!scans.contains(nodeID.tableID)) {
+            return;
+        }
+        for (auto& scanInfo : scans.at(nodeID.tableID)) {
+            auto iterator = scanInfo.isFwd ? graph->scanFwd(nodeID, *scanInfo.scanState) :
+                                             graph->scanBwd(nodeID, *scanInfo.scanState);
+            for (auto chunk : iterator) {
+                chunk.forEach([&](auto nbrNodeIDs, auto propertyVectors, auto i) {
+                    auto nbrNodeID = nbrNodeIDs[i];
+                    if (side.parents.contains(nbrNodeID) || isPruned(nbrNodeID)) {
+                        return;
+                    }
+                    auto edgeID = trackEdgeIDs ?
+                                      propertyVectors[0]->template getValue<relID_t>(i) :
+                                      relID_t{};
+                    side.parents.insert(
+                        {nbrNodeID, Parent{nodeID, edgeID, scanInfo.isFwd, nbrDepth}});
+                    nextFrontier.push_back(nbrNodeID);
+                    auto otherParent = otherSide.parents.find(nbrNodeID);
+                    if (otherParent != otherSide.parents.end() &&
+                        otherParent->second.depth < meetDepth) {
+                        meetNodeID = nbrNodeID;
+                        meetDepth = otherParent->second.depth;
+                    }
+                });
+            }
+        }
+    };
+    for (auto nodeID : side.frontier) {
+        if (side.direction != ExtendDirection::BWD) {
+            scanNbrs(nodeID, fwdScans);
+        }
+        if (side.direction != ExtendDirection::FWD) {
+            scanNbrs(nodeID, bwdScans);
+        }
+    }
+    side.frontier = std::move(nextFrontier);
+    side.depth = nbrDepth;
+    // All nodes met on this level are at the same distance from the root of this side, so the
+    // shortest path goes through the one closest to the root of the other side.
+    return meetNodeID;
+}
+
+BFSPath BidirectionalBFS::getPath(const Side& srcSide, const Side& dstSide, nodeID_t meetNodeID) {
+    BFSPath path;
+    auto nodeID = meetNodeID;
+    while (srcSide.parents.at(nodeID).depth != 0) {
+        auto& parent = srcSide.parents.at(nodeID);
+        path.steps.push_back(BFSPath::Step{nodeID, parent.edgeID, parent.isFwdScan});
+        nodeID = parent.nodeID;
+    }
+    path.sourceNodeID = nodeID;
+    std::reverse(path.steps.begin(), path.steps.end());
+    // The destination side scans edges towards the source, so the path follows them reversed.
+    nodeID = meetNodeID;
+    while (dstSide.parents.at(nodeID).depth != 0) {
+        auto& parent = dstSide.parents.at(nodeID);
+        path.steps.push_back(BFSPath::Step{parent.nodeID, parent.edgeID, !parent.isFwdScan});
+        nodeID = parent.nodeID;
+    }
+    return path;
+}
+
+void BidirectionalBFS::populateComputeState(const BFSPath& path, GDSComputeState& computeState,
+    bool trackParents) {
+    auto frontier = computeState.frontierPair->ptrCast<SPFrontierPair>()->getFrontier();
+    BaseBFSGraph* bfsGraph = nullptr;
+    ObjectBlock<ParentList>* block = nullptr;
+    if (trackParents) {
+        bfsGraph = computeState.auxiliaryState->ptrCast<PathAuxiliaryState>()
+                       ->getBFSGraphManager()
+                       ->getCurrentGraph();
+        block = bfsGraph->addNewBlock();
+    }
+    auto prevNodeID = path.sourceNodeID;
+    for (auto i = 0u; i < path.steps.size(); ++i) {
+        auto& step = path.steps[i];
+        auto iter = static_cast<iteration_t>(i + 1);
+        frontier->pinTableID(step.nodeID.tableID);
+        frontier->addNode(step.nodeID, iter);
+        if (bfsGraph != nullptr) {
+            if (!block->hasSpace()) {
+                block = bfsGraph->addNewBlock();
+            }
+            bfsGraph->pinTableID(step.nodeID.tableID);
+            bfsGraph->addSingleParent(iter, prevNodeID, step.edgeID, step.nodeID, step.isFwdEdge,
+                block);
+        }
+        prevNodeID = step.nodeID;
+    }
+}
+
+} // namespace function
+} // namespace lbug
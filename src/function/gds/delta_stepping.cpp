@@ -0,0 +1,106 @@
+#include "function/gds/delta_stepping.h"
+
+#include <cmath>
+#include <limits>
+
+#include "main/client_context.h"
+
+using namespace lbug::common;
+
+namespace lbug {
+namespace function {
+
+std::vector<nodeID_t> DeltaSteppingBuckets::deferNodes(const std::vector<nodeID_t>& nodeIDs) {
+    if (nodeIDs.empty()) {
+        return {};
+    }
+    if (delta == 0) {
+        // First round, all nodes are relaxed in the next round.
+        auto sumCosts = 0.0;
+        for (auto& nodeID : nodeIDs) {
+            sumCosts += getCost(nodeID.offset);
+        }
+        std::unique_lock lck{mtx};
+        sumFirstRoundCosts += sumCosts;
+        numFirstRoundNodes += nodeIDs.size();
+        return nodeIDs;
+    }
+    std::vector<nodeID_t> result;
+    std::vector<std::pair<uint64_t, nodeID_t>> deferredNodes;
+    for (auto& nodeID : nodeIDs) {
+        auto bucketIdx = getBucketIdx(getCost(nodeID.offset));
+        if (bucketIdx <= curBucketIdx) {
+            result.push_back(nodeID);
+        } else {
+            deferredNodes.emplace_back(bucketIdx, nodeID);
+        }
+    }
+    if (!deferredNodes.empty()) {
+        std::unique_lock lck{mtx};
+        for (auto& [bucketIdx, nodeID] : deferredNodes) {
+            buckets[bucketIdx].push_back(nodeID);
+        }
+    }
+    return result;
+}
+
+void DeltaSteppingBuckets::finishRound() {
+    if (delta != 0) {
+        return;
+    }
+    delta = numFirstRoundNodes == 0 ? 0 : sumFirstRoundCosts / numFirstRoundNodes;
+    if (delta <= 0) {
+        // All weights of the first round are 0, so all nodes fall into a single bucket.
+        delta = std::numeric_limits<double>::max();
+    }
+}
+
+bool DeltaSteppingBuckets::moveToNextBucket(GDSComputeState& computeState) {
+    auto frontierPair = computeState.frontierPair.get();
+    while (!buckets.empty()) {
+        auto bucket = buckets.extract(buckets.begin());
+        curBucketIdx = bucket.key();
+        auto hasActiveNodes = false;
+        auto pinnedTableID = INVALID_TABLE_ID;
+        for (auto& nodeID : bucket.mapped()) {
+            if (nodeID.tableID != pinnedTableID) {
+                computeState.beginFrontierCompute(nodeID.tableID, nodeID.tableID);
+                pinnedTableID = nodeID.tableID;
+            }
+            // A node whose cost improved to an earlier bucket has been relaxed with that cost.
+            if (getBucketIdx(getCost(nodeID.offset)) != curBucketIdx) {
+                continue;
+            }
+            frontierPair->addNodeToNextFrontier(nodeID);
+            hasActiveNodes = true;
+        }
+        if (hasActiveNodes) {
+            frontierPair->setActiveNodesForNextIter();
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t DeltaSteppingBuckets::getBucketIdx(double cost) const {
+    auto bucketIdx = std::floor(cost / delta);
+    if (bucketIdx >= static_cast<double>(UINT64_MAX)) {
+        return UINT64_MAX;
+    }
+    return static_cast<uint64_t>(bucketIdx);
+}
+
+void DeltaSteppingBuckets::tryEnable(main::ClientContext* context, uint16_t upperBound,
+    node_cost_func_t getCost, GDSComputeState& computeState) {
+    auto config = context->getClientConfig();
+    if (config->wspDelta < 0 || upperBound < config->varLengthMaxDepth) {
+        return;
+    }
+    auto buckets = std::make_shared<DeltaSteppingBuckets>(config->wspDelta, std::move(getCost));
+    computeState.edgeCompute = std::make_unique<DeltaSteppingEdgeCompute>(
+        std::move(computeState.edgeCompute), buckets.get());
+    computeState.deltaSteppingBuckets = std::move(buckets);
+}
+
+} // namespace function
+} // namespace lbug
@@ -8,13 +8,16 @@
 #include "common/exception/binder.h"
 #include "function/table/bind_input.h"
 #include "graph/graph_entry_set.h"
+#include "graph/in_mem_graph.h"
 #include "graph/on_disk_graph.h"
+#include "main/client_context.h"
 #include "parser/parser.h"
 #include "planner/operator/logical_table_function_call.h"
 #include "planner/operator/sip/logical_semi_masker.h"
 #include "planner/planner.h"
 #include "processor/operator/table_function_call.h"
 #include "processor/plan_mapper.h"
+#include "transaction/transaction.h"
 #include <format>
 
 using namespace lbug::catalog;
@@ -71,7 +74,9 @@ NativeGraphEntry GDSFunction::bindGraphEntry(ClientContext& context, const std::
     if (entry->type != GraphEntryType::NATIVE) {
         throw BinderException("AA");
     }
-    return bindGraphEntry(context, entry->cast<ParsedNativeGraphEntry>());
+    auto result = bindGraphEntry(context, entry->cast<ParsedNativeGraphEntry>());
+    result.name = name;
+    return result;
 }
 
 static NativeGraphEntryTableInfo bindNodeEntry(ClientContext& context, const std::string& tableName,
@@ -184,11 +189,35 @@ std::string GDSFunction::bindColumnName(const parser::YieldVariable& yieldVariab
     return expressionName;
 }
 
+// The cached copy is only shared by read-only transactions, which see exactly the snapshot it was
+// built from. Node predicates are applied through semi masks at runtime, so they are not cached.
+static bool canUseCachedGraph(ClientContext& context, const NativeGraphEntry& graphEntry) {
+    if (!context.getClientConfig()->cacheProjectedGraphs || graphEntry.name.empty() ||
+        !transaction::Transaction::Get(context)->isReadOnly()) {
+        return false;
+    }
+    for (auto& nodeInfo : graphEntry.nodeInfos) {
+        if (nodeInfo.predicate != nullptr) {
+            return false;
+        }
+    }
+    return true;
+}
+
 std::unique_ptr<TableFuncSharedState> GDSFunction::initSharedState(
     const TableFuncInitSharedStateInput& input) {
     auto bindData = input.bindData->constPtrCast<GDSBindData>();
-    auto graph =
-        std::make_unique<OnDiskGraph>(input.context->clientContext, bindData->graphEntry.copy());
+    auto clientContext = input.context->clientContext;
+    std::unique_ptr<Graph> graph;
+    if (canUseCachedGraph(*clientContext, bindData->graphEntry)) {
+        auto startTS = transaction::Transaction::Get(*clientContext)->getStartTS();
+        auto data =
+            GraphEntrySet::Get(*clientContext)->getCachedGraph(bindData->graphEntry.name, startTS);
+        graph = std::make_unique<InMemGraph>(clientContext, bindData->graphEntry.copy(),
+            std::move(data));
+    } else {
+        graph = std::make_unique<OnDiskGraph>(clientContext, bindData->graphEntry.copy());
+    }
     return std::make_unique<GDSFuncSharedState>(bindData->getResultTable(), std::move(graph));
 }
 
@@ -4,6 +4,7 @@
 #include "catalog/catalog_entry/table_catalog_entry.h"
 #include "common/exception/interrupt.h"
 #include "common/task_system/task_scheduler.h"
+#include "function/gds/delta_stepping.h"
 #include "function/gds/gds_task.h"
 #include "graph/graph.h"
 #include "graph/graph_entry.h"
@@ -103,11 +104,43 @@ void GDSUtils::runFTSEdgeCompute(ExecutionContext* context, GDSComputeState& com
     runOneIteration(context, graph, extendDirection, compState, propertiesToScan);
 }
 
+void GDSUtils::runEdgeComputeIteration(ExecutionContext* context, GDSComputeState& compState,
+    Graph* graph, ExtendDirection extendDirection) {
+    compState.frontierPair->beginNewIteration();
+    runOneIteration(context, graph, extendDirection, compState, {});
+}
+
+static void runDeltaSteppingEdgeCompute(ExecutionContext* context, GDSComputeState& compState,
+    Graph* graph, ExtendDirection extendDirection,
+    const std::vector<std::string>& propertiesToScan) {
+    auto frontierPair = compState.frontierPair.get();
+    auto& buckets = *compState.deltaSteppingBuckets;
+    // Every round, including the ones starting a new bucket, takes an iteration number.
+    static constexpr uint16_t MAX_NUM_ROUNDS = FRONTIER_UNVISITED - 1;
+    while (frontierPair->getCurrentIter() < MAX_NUM_ROUNDS) {
+        if (!frontierPair->continueNextIter(MAX_NUM_ROUNDS) &&
+            !buckets.moveToNextBucket(compState)) {
+            break;
+        }
+        frontierPair->beginNewIteration();
+        runOneIteration(context, graph, extendDirection, compState, propertiesToScan);
+        buckets.finishRound();
+        if (frontierPair->needSwitchToDense(
+                context->clientContext->getClientConfig()->sparseFrontierThreshold)) {
+            compState.switchToDense(context, graph);
+        }
+    }
+}
+
 void GDSUtils::runRecursiveJoinEdgeCompute(ExecutionContext* context, GDSComputeState& compState,
     Graph* graph, ExtendDirection extendDirection, uint64_t maxIteration,
     NodeOffsetMaskMap* outputNodeMask, const std::vector<std::string>& propertiesToScan) {
     auto frontierPair = compState.frontierPair.get();
     compState.edgeCompute->resetSingleThreadState();
+    if (compState.deltaSteppingBuckets != nullptr) {
+        runDeltaSteppingEdgeCompute(context, compState, graph, extendDirection, propertiesToScan);
+        return;
+    }
     while (frontierPair->continueNextIter(maxIteration)) {
         frontierPair->beginNewIteration();
         if (outputNodeMask != nullptr && compState.edgeCompute->terminate(*outputNodeMask)) {
@@ -0,0 +1,160 @@
+#include "function/gds/multi_source_bfs.h"
+
+#include "function/gds/gds_utils.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+
+using namespace lbug::common;
+using namespace lbug::processor;
+using namespace lbug::graph;
+
+namespace lbug {
+namespace function {
+
+MultiSourceBFSState::MultiSourceBFSState(ExecutionContext* context, Graph* graph) {
+    auto mm = storage::MemoryManager::Get(*context->clientContext);
+    auto transaction = transaction::Transaction::Get(*context->clientContext);
+    for (auto& [tableID, maxOffset] : graph->getMaxOffsetMap(transaction)) {
+        seen.allocate(tableID, maxOffset, mm);
+        frontier.allocate(tableID, maxOffset, mm);
+        next.allocate(tableID, maxOffset, mm);
+    }
+}
+
+class MultiSourceBFSEdgeCompute : public EdgeCompute {
+public:
+    explicit MultiSourceBFSEdgeCompute(MultiSourceBFSState& state) : state{state} {}
+
+    std::vector<nodeID_t> edgeCompute(nodeID_t boundNodeID, NbrScanState::Chunk& chunk,
+        bool) override {
+        auto sourceMask = state.getFrontier(boundNodeID.offset);
+        chunk.forEach([&](auto nbrNodeIDs, auto, auto i) {
+            auto nbrOffset = nbrNodeIDs[i].offset;
+            auto newSourceMask = sourceMask & ~state.getSeen(nbrOffset);
+            if (newSourceMask != 0) {
+                state.addNext(nbrOffset, newSourceMask);
+            }
+        });
+        // Nodes are added to the next frontier once all rel tables are extended, see
+        // MultiSourceBFS::finishLevel.
+        return {};
+    }
+
+    std::unique_ptr<EdgeCompute> copy() override {
+        return std::make_unique<MultiSourceBFSEdgeCompute>(state);
+    }
+
+private:
+    MultiSourceBFSState& state;
+};
+
+class MultiSourceBFSResetVertexCompute : public VertexCompute {
+public:
+    explicit MultiSourceBFSResetVertexCompute(MultiSourceBFSState& state) : state{state} {}
+
+    bool beginOnTable(table_id_t tableID) override {
+        state.pinTableID(tableID);
+        return true;
+    }
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            state.resetNode(i);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<MultiSourceBFSResetVertexCompute>(state);
+    }
+
+private:
+    MultiSourceBFSState& state;
+};
+
+class MultiSourceBFSLevelVertexCompute : public VertexCompute {
+public:
+    MultiSourceBFSLevelVertexCompute(MultiSourceBFSState& state, FrontierPair& frontierPair,
+        std::unique_ptr<MultiSourceBFSOutputWriter> writer)
+        : state{state}, frontierPair{frontierPair}, writer{std::move(writer)} {}
+
+    bool beginOnTable(table_id_t tableID) override {
+        state.pinTableID(tableID);
+        frontierPair.pinNextFrontier(tableID);
+        return true;
+    }
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t tableID) override {
+        auto length = frontierPair.getCurrentIter();
+        auto hasActiveNodes = false;
+        for (auto i = startOffset; i < endOffset; ++i) {
+            auto newSourceMask = state.takeNext(i) & ~state.getSeen(i);
+            if (newSourceMask == 0) {
+                continue;
+            }
+            state.addSeen(i, newSourceMask);
+            state.setFrontier(i, newSourceMask);
+            frontierPair.addNodeToNextFrontier(i);
+            hasActiveNodes = true;
+            writer->write(nodeID_t{i, tableID}, newSourceMask, length);
+        }
+        if (hasActiveNodes) {
+            frontierPair.setActiveNodesForNextIter();
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<MultiSourceBFSLevelVertexCompute>(state, frontierPair,
+            writer->copy());
+    }
+
+private:
+    MultiSourceBFSState& state;
+    FrontierPair& frontierPair;
+    std::unique_ptr<MultiSourceBFSOutputWriter> writer;
+};
+
+MultiSourceBFS::MultiSourceBFS(ExecutionContext* context, Graph* graph) : graph{graph} {
+    auto curDenseFrontier = DenseFrontier::getUnvisitedFrontier(context, graph);
+    auto nextDenseFrontier = DenseFrontier::getUnvisitedFrontier(context, graph);
+    auto frontierPair = std::make_unique<DenseFrontierPair>(std::move(curDenseFrontier),
+        std::move(nextDenseFrontier));
+    auto auxiliaryState = std::make_unique<MultiSourceBFSState>(context, graph);
+    state = auxiliaryState.get();
+    auto edgeCompute = std::make_unique<MultiSourceBFSEdgeCompute>(*state);
+    computeState = std::make_unique<GDSComputeState>(std::move(frontierPair),
+        std::move(edgeCompute), std::move(auxiliaryState));
+}
+
+void MultiSourceBFS::run(ExecutionContext* context, const std::vector<nodeID_t>& sources,
+    ExtendDirection extendDirection, uint16_t upperBound, MultiSourceBFSOutputWriter& writer) {
+    KU_ASSERT(sources.size() <= MAX_NUM_SOURCES);
+    auto frontierPair = computeState->frontierPair->ptrCast<DenseFrontierPair>();
+    frontierPair->resetCurrentIter();
+    frontierPair->resetValue(context, graph, FRONTIER_UNVISITED);
+    auto resetVertexCompute = MultiSourceBFSResetVertexCompute(*state);
+    GDSUtils::runVertexCompute(context, GDSDensityState::DENSE, graph, resetVertexCompute);
+    for (auto i = 0u; i < sources.size(); ++i) {
+        auto sourceNodeID = sources[i];
+        auto sourceMask = static_cast<uint64_t>(1) << i;
+        state->pinTableID(sourceNodeID.tableID);
+        state->addSeen(sourceNodeID.offset, sourceMask);
+        state->setFrontier(sourceNodeID.offset,
+            state->getFrontier(sourceNodeID.offset) | sourceMask);
+        frontierPair->pinNextFrontier(sourceNodeID.tableID);
+        frontierPair->addNodeToNextFrontier(sourceNodeID);
+    }
+    frontierPair->setActiveNodesForNextIter();
+    while (frontierPair->continueNextIter(upperBound)) {
+        GDSUtils::runEdgeComputeIteration(context, *computeState, graph, extendDirection);
+        finishLevel(context, writer);
+    }
+}
+
+void MultiSourceBFS::finishLevel(ExecutionContext* context, MultiSourceBFSOutputWriter& writer) {
+    auto vertexCompute = MultiSourceBFSLevelVertexCompute(*state, *computeState->frontierPair,
+        writer.copy());
+    GDSUtils::runVertexCompute(context, GDSDensityState::DENSE, graph, vertexCompute);
+}
+
+} // namespace function
+} // namespace lbug
@@ -13,6 +13,7 @@ RJBindData::RJBindData(const RJBindData& other) {
     extendDirection = other.extendDirection;
     flipPath = other.flipPath;
     writePath = other.writePath;
+    bidirectional = other.bidirectional;
     directionExpr = other.directionExpr;
     lengthExpr = other.lengthExpr;
     pathNodeIDsExpr = other.pathNodeIDsExpr;
@@ -1,4 +1,5 @@
 #include "binder/expression/node_expression.h"
+#include "function/gds/delta_stepping.h"
 #include "function/gds/gds_function_collection.h"
 #include "function/gds/rec_joins.h"
 #include "function/gds/weight_utils.h"
@@ -109,6 +110,7 @@ public:
     }
 
     Costs* getCurrentCosts() { return curCosts; }
+    Costs* getNextCosts() { return nextCosts; }
 
     void pinCurTableID(table_id_t tableID) {
         switch (densityState) {
@@ -214,6 +216,8 @@ public:
         : costsPair{std::move(costsPair)} {}
 
     Costs* getCosts() { return costsPair->getCurrentCosts(); }
+    // Cost of a visited node of the table pinned for the next frontier.
+    double getNbrCost(offset_t offset) { return costsPair->getNextCosts()->getCost(offset); }
 
     void initSource(nodeID_t sourceNodeID) override {
         costsPair->pinCurTableID(sourceNodeID.tableID);
@@ -317,6 +321,11 @@ private:
                 gdsState = std::make_unique<GDSComputeState>(std::move(frontierPair),
                     std::move(edgeCompute), std::move(auxiliaryState));
             });
+        auto auxiliaryStatePtr =
+            gdsState->auxiliaryState->ptrCast<WSPDestinationsAuxiliaryState>();
+        DeltaSteppingBuckets::tryEnable(clientContext, bindData.upperBound,
+            [auxiliaryStatePtr](offset_t offset) { return auxiliaryStatePtr->getNbrCost(offset); },
+            *gdsState);
         return gdsState;
     }
 
@@ -1,5 +1,6 @@
 #include "binder/binder.h"
 #include "function/gds/auxiliary_state/path_auxiliary_state.h"
+#include "function/gds/delta_stepping.h"
 #include "function/gds/gds_function_collection.h"
 #include "function/gds/rec_joins.h"
 #include "function/gds/weight_utils.h"
@@ -132,6 +133,10 @@ private:
                 gdsState = std::make_unique<GDSComputeState>(std::move(frontierPair),
                     std::move(edgeCompute), std::move(auxiliaryState));
             });
+        auto auxiliaryState = gdsState->auxiliaryState->ptrCast<WSPPathsAuxiliaryState>();
+        DeltaSteppingBuckets::tryEnable(clientContext, bindData.upperBound,
+            [auxiliaryState](offset_t offset) { return auxiliaryState->getCost(offset); },
+            *gdsState);
         return gdsState;
     }
 
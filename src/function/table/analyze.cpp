@@ -0,0 +1,157 @@
+#include "binder/binder.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/simple_table_function.h"
+#include "function/table/standalone_call_function.h"
+#include "processor/execution_context.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
+#include "transaction/transaction.h"
+
+using namespace lbug::common;
+
+namespace lbug {
+namespace function {
+
+struct AnalyzeBindData final : TableFuncBindData {
+    catalog::TableCatalogEntry* tableEntry;
+
+    explicit AnalyzeBindData(catalog::TableCatalogEntry* tableEntry) : tableEntry{tableEntry} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<AnalyzeBindData>(tableEntry);
+    }
+};
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    const auto tableName = input->getLiteralVal<std::string>(0);
+    binder::Binder::validateTableExistence(*context, tableName);
+    const auto tableEntry = catalog::Catalog::Get(*context)->getTableCatalogEntry(
+        transaction::Transaction::Get(*context), tableName);
+    binder::Binder::validateNodeTableType(tableEntry);
+    return std::make_unique<AnalyzeBindData>(tableEntry);
+}
+
+static std::vector<LogicalType> getColumnTypes(const storage::NodeTable& table) {
+    std::vector<LogicalType> types;
+    for (auto i = 0u; i < table.getNumColumns(); i++) {
+        types.push_back(table.getColumn(i).getDataType().copy());
+    }
+    return types;
+}
+
+struct AnalyzeSharedState final : public SimpleTableFuncSharedState {
+    explicit AnalyzeSharedState(storage::NodeTable& table)
+        : SimpleTableFuncSharedState{table.getNumCommittedNodeGroups(), 1 /*maxMorselSize*/},
+          table{table}, stats{getColumnTypes(table)} {}
+
+    void merge(const storage::TableStats& other) {
+        std::unique_lock lck{mtx};
+        stats.merge(other);
+    }
+
+    std::mutex mtx;
+    storage::NodeTable& table;
+    // Statistics rebuilt from scratch from the scanned values.
+    storage::TableStats stats;
+};
+
+static std::unique_ptr<TableFuncSharedState> initSharedState(
+    const TableFuncInitSharedStateInput& input) {
+    const auto bindData = input.bindData->constPtrCast<AnalyzeBindData>();
+    auto& table = storage::StorageManager::Get(*input.context->clientContext)
+                      ->getTable(bindData->tableEntry->getTableID())
+                      ->cast<storage::NodeTable>();
+    return std::make_unique<AnalyzeSharedState>(table);
+}
+
+// Nested columns have no statistics to collect and are not scanned.
+static std::vector<column_id_t> getScannedColumnIDs(const storage::NodeTable& table) {
+    std::vector<column_id_t> columnIDs;
+    for (auto i = 0u; i < table.getNumColumns(); i++) {
+        if (!LogicalTypeUtils::isNested(table.getColumn(i).getDataType())) {
+            columnIDs.push_back(i);
+        }
+    }
+    return columnIDs;
+}
+
+struct AnalyzeLocalState final : TableFuncLocalState {
+    AnalyzeLocalState(const main::ClientContext& context, storage::NodeTable& table)
+        : columnIDs{getScannedColumnIDs(table)},
+          dataChunk{static_cast<uint32_t>(columnIDs.size() + 1),
+              std::make_shared<DataChunkState>()} {
+        dataChunk.insert(0, std::make_shared<ValueVector>(LogicalType::INTERNAL_ID()));
+        std::vector<ValueVector*> outputVectors;
+        for (auto i = 0u; i < columnIDs.size(); i++) {
+            dataChunk.insert(i + 1,
+                std::make_shared<ValueVector>(table.getColumn(columnIDs[i]).getDataType().copy()));
+            outputVectors.push_back(&dataChunk.getValueVectorMutable(i + 1));
+        }
+        scanState = std::make_unique<storage::NodeTableScanState>(
+            &dataChunk.getValueVectorMutable(0), outputVectors, dataChunk.state);
+        scanState->source = storage::TableScanSource::COMMITTED;
+        scanState->setToTable(transaction::Transaction::Get(context), &table, columnIDs, {});
+    }
+
+    std::vector<column_id_t> columnIDs;
+    DataChunk dataChunk;
+    std::unique_ptr<storage::NodeTableScanState> scanState;
+};
+
+static std::unique_ptr<TableFuncLocalState> initLocalState(
+    const TableFuncInitLocalStateInput& input) {
+    auto& table = input.sharedState.ptrCast<AnalyzeSharedState>()->table;
+    return std::make_unique<AnalyzeLocalState>(*input.clientContext, table);
+}
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto sharedState = input.sharedState->ptrCast<AnalyzeSharedState>();
+    auto localState = input.localState->ptrCast<AnalyzeLocalState>();
+    const auto morsel = sharedState->getMorsel();
+    if (morsel.isInvalid()) {
+        return 0;
+    }
+    auto transaction = transaction::Transaction::Get(*input.context->clientContext);
+    auto& table = sharedState->table;
+    auto& scanState = *localState->scanState;
+    auto stats = storage::TableStats{getColumnTypes(table)};
+    for (auto i = morsel.startOffset; i < morsel.endOffset; i++) {
+        scanState.nodeGroupIdx = i;
+        table.initScanState(transaction, scanState);
+        while (table.scan(transaction, scanState)) {
+            if (localState->columnIDs.empty()) {
+                stats.incrementCardinality(scanState.outState->getSelVector().getSelSize());
+            } else {
+                stats.update(localState->columnIDs, scanState.outputVectors);
+            }
+        }
+    }
+    sharedState->merge(stats);
+    return morsel.endOffset - morsel.startOffset;
+}
+
+static void finalizeFunc(const processor::ExecutionContext*, TableFuncSharedState* sharedState) {
+    auto analyzeSharedState = sharedState->ptrCast<AnalyzeSharedState>();
+    analyzeSharedState->table.setStats(std::move(analyzeSharedState->stats));
+}
+
+function_set AnalyzeFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::STRING});
+    func->bindFunc = bindFunc;
+    func->initSharedStateFunc = initSharedState;
+    func->initLocalStateFunc = initLocalState;
+    func->tableFunc = tableFunc;
+    func->finalizeFunc = finalizeFunc;
+    func->canParallelFunc = [] { return true; };
+    func->isReadOnly = false;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace lbug
@@ -0,0 +1,62 @@
+#include "binder/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/simple_table_function.h"
+#include "main/plan_cache.h"
+
+namespace lbug {
+namespace function {
+
+struct PlanCacheInfoBindData final : TableFuncBindData {
+    uint64_t numEntries;
+    uint64_t numHits;
+    uint64_t numMisses;
+
+    PlanCacheInfoBindData(uint64_t numEntries, uint64_t numHits, uint64_t numMisses,
+        binder::expression_vector columns)
+        : TableFuncBindData{std::move(columns), 1}, numEntries{numEntries}, numHits{numHits},
+          numMisses{numMisses} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<PlanCacheInfoBindData>(numEntries, numHits, numMisses, columns);
+    }
+};
+
+static common::offset_t internalTableFunc(const TableFuncMorsel& /*morsel*/,
+    const TableFuncInput& input, common::DataChunk& output) {
+    KU_ASSERT(output.getNumValueVectors() == 3);
+    auto bindData = input.bindData->constPtrCast<PlanCacheInfoBindData>();
+    output.getValueVectorMutable(0).setValue<uint64_t>(0, bindData->numEntries);
+    output.getValueVectorMutable(1).setValue<uint64_t>(0, bindData->numHits);
+    output.getValueVectorMutable(2).setValue<uint64_t>(0, bindData->numMisses);
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    auto planCache = main::PlanCache::Get(*context);
+    std::vector<common::LogicalType> returnTypes;
+    returnTypes.emplace_back(common::LogicalType::UINT64());
+    returnTypes.emplace_back(common::LogicalType::UINT64());
+    returnTypes.emplace_back(common::LogicalType::UINT64());
+    auto returnColumnNames = std::vector<std::string>{"num_entries", "num_hits", "num_misses"};
+    returnColumnNames =
+        TableFunction::extractYieldVariables(returnColumnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(returnColumnNames, returnTypes);
+    return std::make_unique<PlanCacheInfoBindData>(planCache->getNumEntries(),
+        planCache->getNumHits(), planCache->getNumMisses(), columns);
+}
+
+function_set PlanCacheInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    auto function = std::make_unique<TableFunction>(name, std::vector<common::LogicalTypeID>{});
+    function->tableFunc = SimpleTableFunc::getTableFunc(internalTableFunc);
+    function->bindFunc = bindFunc;
+    function->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    functionSet.push_back(std::move(function));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace lbug
@@ -1,6 +1,8 @@
 #include "graph/graph_entry_set.h"
 
 #include "common/exception/runtime.h"
+#include "graph/in_mem_graph.h"
+#include "graph/landmark_index.h"
 #include "main/client_context.h"
 #include <format>
 
@@ -21,6 +23,25 @@ void GraphEntrySet::validateGraphExist(const std::string& name) const {
     }
 }
 
+std::shared_ptr<InMemGraphData> GraphEntrySet::getCachedGraph(const std::string& name,
+    transaction_t startTS) {
+    KU_ASSERT(hasGraph(name));
+    auto& cachedGraph = nameToCachedGraph[name];
+    if (cachedGraph == nullptr || cachedGraph->getSnapshotTS() != startTS) {
+        cachedGraph = std::make_shared<InMemGraphData>(startTS);
+    }
+    return cachedGraph;
+}
+
+std::shared_ptr<LandmarkIndex> GraphEntrySet::getLandmarkIndex(const std::string& key,
+    ExtendDirection direction, transaction_t startTS) {
+    auto& index = keyToLandmarkIndex[key];
+    if (index == nullptr || index->getSnapshotTS() != startTS) {
+        index = std::make_shared<LandmarkIndex>(startTS, direction);
+    }
+    return index;
+}
+
 GraphEntrySet* GraphEntrySet::Get(const main::ClientContext& context) {
     return context.graphEntrySet.get();
 }
@@ -0,0 +1,227 @@
+#include "graph/in_mem_graph.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "catalog/catalog_entry/rel_group_catalog_entry.h"
+#include "main/client_context.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "transaction/transaction.h"
+
+using namespace lbug::catalog;
+using namespace lbug::common;
+using namespace lbug::storage;
+
+namespace lbug {
+namespace graph {
+
+static bool isFixedSize(PhysicalTypeID physicalType) {
+    switch (physicalType) {
+    case PhysicalTypeID::BOOL:
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::INT128:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT:
+    case PhysicalTypeID::INTERVAL:
+    case PhysicalTypeID::INTERNAL_ID:
+    case PhysicalTypeID::UINT128:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void InMemCSRProperty::append(const ValueVector& vector, sel_t pos) {
+    auto data = vector.getData() + pos * numBytesPerValue;
+    values.insert(values.end(), data, data + numBytesPerValue);
+    nulls.push_back(vector.isNull(pos));
+}
+
+void InMemCSRProperty::copyTo(ValueVector& vector, uint64_t startPos, uint64_t numValues) const {
+    memcpy(vector.getData(), values.data() + startPos * numBytesPerValue,
+        numValues * numBytesPerValue);
+    for (auto i = 0u; i < numValues; ++i) {
+        vector.setNull(i, nulls[startPos + i]);
+    }
+}
+
+bool InMemCSR::hasProperties(const std::vector<std::string>& propertyNames) const {
+    for (auto& propertyName : propertyNames) {
+        if (!std::any_of(properties.begin(), properties.end(),
+                [&](const InMemCSRProperty& property) { return property.name == propertyName; })) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const InMemCSRProperty& InMemCSR::getProperty(const std::string& propertyName) const {
+    for (auto& property : properties) {
+        if (property.name == propertyName) {
+            return property;
+        }
+    }
+    KU_UNREACHABLE;
+}
+
+std::shared_ptr<const InMemCSR> InMemGraphData::getCSR(transaction::Transaction* transaction,
+    OnDiskGraph& graph, const GraphRelInfo& relInfo, RelDataDirection direction,
+    const std::vector<std::string>& propertyNames) {
+    for (auto& propertyName : propertyNames) {
+        auto& type = relInfo.relGroupEntry->getProperty(propertyName).getType();
+        if (!isFixedSize(type.getPhysicalType())) {
+            return nullptr;
+        }
+    }
+    std::unique_lock lck{mtx};
+    auto key = std::make_pair(relInfo.relTableID, direction);
+    if (csrs.contains(key) && csrs.at(key)->hasProperties(propertyNames)) {
+        return csrs.at(key);
+    }
+    // Rebuild with the properties of the cached CSR as well, so that it keeps serving earlier
+    // scans. Scans that already hold the previous CSR keep it alive.
+    auto properties = propertyNames;
+    if (csrs.contains(key)) {
+        for (auto& property : csrs.at(key)->properties) {
+            if (std::find(properties.begin(), properties.end(), property.name) ==
+                properties.end()) {
+                properties.push_back(property.name);
+            }
+        }
+    }
+    auto csr = buildCSR(transaction, graph, relInfo, direction, properties);
+    csrs[key] = csr;
+    return csr;
+}
+
+std::shared_ptr<const InMemCSR> InMemGraphData::buildCSR(transaction::Transaction* transaction,
+    OnDiskGraph& graph, const GraphRelInfo& relInfo, RelDataDirection direction,
+    const std::vector<std::string>& propertyNames) {
+    auto isFwd = direction == RelDataDirection::FWD;
+    auto boundTableID = isFwd ? relInfo.srcTableID : relInfo.dstTableID;
+    auto nbrTableID = isFwd ? relInfo.dstTableID : relInfo.srcTableID;
+    auto csr = std::make_shared<InMemCSR>(nbrTableID);
+    for (auto& propertyName : propertyNames) {
+        auto& type = relInfo.relGroupEntry->getProperty(propertyName).getType();
+        csr->properties.emplace_back(propertyName, type.copy(),
+            PhysicalTypeUtils::getFixedTypeSize(type.getPhysicalType()));
+    }
+    auto scanState = graph.prepareRelScan(*relInfo.relGroupEntry, relInfo.relTableID, nbrTableID,
+        propertyNames, false /* randomLookup */);
+    auto maxOffset = graph.getMaxOffset(transaction, boundTableID);
+    csr->csrOffsets.resize(maxOffset + 1);
+    for (auto offset = 0u; offset < maxOffset; ++offset) {
+        csr->csrOffsets[offset] = csr->nbrOffsets.size();
+        auto nodeID = nodeID_t{offset, boundTableID};
+        auto iterator =
+            isFwd ? graph.scanFwd(nodeID, *scanState) : graph.scanBwd(nodeID, *scanState);
+        for (auto chunk : iterator) {
+            chunk.forEach([&](auto nbrNodeIDs, auto propertyVectors, auto i) {
+                csr->nbrOffsets.push_back(nbrNodeIDs[i].offset);
+                for (auto j = 0u; j < csr->properties.size(); ++j) {
+                    csr->properties[j].append(*propertyVectors[j], i);
+                }
+            });
+        }
+    }
+    csr->csrOffsets[maxOffset] = csr->nbrOffsets.size();
+    return csr;
+}
+
+InMemGraphNbrScanState::InMemGraphNbrScanState(MemoryManager* mm,
+    std::shared_ptr<const InMemCSR> fwdCSR, std::shared_ptr<const InMemCSR> bwdCSR,
+    const std::vector<std::string>& relProperties)
+    : fwdCSR{std::move(fwdCSR)}, bwdCSR{std::move(bwdCSR)}, relProperties{relProperties},
+      nbrNodeIDs(DEFAULT_VECTOR_CAPACITY), selVector{DEFAULT_VECTOR_CAPACITY} {
+    auto csr = this->fwdCSR != nullptr ? this->fwdCSR.get() : this->bwdCSR.get();
+    KU_ASSERT(csr != nullptr);
+    auto state = DataChunkState::getSingleValueDataChunkState();
+    for (auto& propertyName : relProperties) {
+        auto vector =
+            std::make_shared<ValueVector>(csr->getProperty(propertyName).type.copy(), mm, state);
+        propertyVectors.push_back(std::move(vector));
+    }
+}
+
+void InMemGraphNbrScanState::startScan(RelDataDirection direction, offset_t boundOffset) {
+    currentCSR = direction == RelDataDirection::FWD ? fwdCSR.get() : bwdCSR.get();
+    KU_ASSERT(currentCSR != nullptr && boundOffset + 1 < currentCSR->csrOffsets.size());
+    nextPos = currentCSR->csrOffsets[boundOffset];
+    endPos = currentCSR->csrOffsets[boundOffset + 1];
+    selVector.setToUnfiltered(0);
+    next();
+}
+
+bool InMemGraphNbrScanState::next() {
+    KU_ASSERT(currentCSR != nullptr);
+    if (nextPos == endPos) {
+        return false;
+    }
+    auto numNbrs = std::min<uint64_t>(endPos - nextPos, DEFAULT_VECTOR_CAPACITY);
+    for (auto i = 0u; i < numNbrs; ++i) {
+        nbrNodeIDs[i] = nodeID_t{currentCSR->nbrOffsets[nextPos + i], currentCSR->nbrTableID};
+    }
+    for (auto i = 0u; i < relProperties.size(); ++i) {
+        currentCSR->getProperty(relProperties[i]).copyTo(*propertyVectors[i], nextPos, numNbrs);
+    }
+    selVector.setToUnfiltered(numNbrs);
+    nextPos += numNbrs;
+    return true;
+}
+
+InMemGraph::InMemGraph(main::ClientContext* context, NativeGraphEntry entry,
+    std::shared_ptr<InMemGraphData> data)
+    : context{context}, onDiskGraph{context, std::move(entry)}, data{std::move(data)} {
+    for (auto tableID : onDiskGraph.getNodeTableIDs()) {
+        for (auto& relInfo : onDiskGraph.getRelInfos(tableID)) {
+            relTableIDToRelInfo.emplace(relInfo.relTableID, relInfo);
+        }
+    }
+}
+
+std::unique_ptr<NbrScanState> InMemGraph::prepareRelScan(const TableCatalogEntry& entry,
+    oid_t relTableID, table_id_t nbrTableID, std::vector<std::string> relProperties,
+    bool randomLookup) {
+    KU_ASSERT(relTableIDToRelInfo.contains(relTableID));
+    auto& relInfo = relTableIDToRelInfo.at(relTableID);
+    auto transaction = transaction::Transaction::Get(*context);
+    std::shared_ptr<const InMemCSR> fwdCSR, bwdCSR;
+    for (auto direction : entry.constCast<RelGroupCatalogEntry>().getRelDataDirections()) {
+        auto csr = data->getCSR(transaction, onDiskGraph, relInfo, direction, relProperties);
+        if (csr == nullptr) {
+            return onDiskGraph.prepareRelScan(entry, relTableID, nbrTableID,
+                std::move(relProperties), randomLookup);
+        }
+        (direction == RelDataDirection::FWD ? fwdCSR : bwdCSR) = std::move(csr);
+    }
+    return std::make_unique<InMemGraphNbrScanState>(MemoryManager::Get(*context),
+        std::move(fwdCSR), std::move(bwdCSR), relProperties);
+}
+
+Graph::EdgeIterator InMemGraph::scanFwd(nodeID_t nodeID, NbrScanState& state) {
+    auto inMemScanState = dynamic_cast<InMemGraphNbrScanState*>(&state);
+    if (inMemScanState == nullptr) {
+        return onDiskGraph.scanFwd(nodeID, state);
+    }
+    inMemScanState->startScan(RelDataDirection::FWD, nodeID.offset);
+    return EdgeIterator(inMemScanState);
+}
+
+Graph::EdgeIterator InMemGraph::scanBwd(nodeID_t nodeID, NbrScanState& state) {
+    auto inMemScanState = dynamic_cast<InMemGraphNbrScanState*>(&state);
+    if (inMemScanState == nullptr) {
+        return onDiskGraph.scanBwd(nodeID, state);
+    }
+    inMemScanState->startScan(RelDataDirection::BWD, nodeID.offset);
+    return EdgeIterator(inMemScanState);
+}
+
+} // namespace graph
+} // namespace lbug
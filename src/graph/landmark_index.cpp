@@ -0,0 +1,282 @@
+#include "graph/landmark_index.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+
+#include "common/exception/interrupt.h"
+#include "common/task_system/task_scheduler.h"
+#include "graph/graph.h"
+#include "graph/graph_entry.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+
+using namespace lbug::common;
+
+namespace lbug {
+namespace graph {
+
+// Scans the neighbors of a node following edges in a given direction. Each thread needs its own
+// scanner.
+class LandmarkNbrScanner {
+    struct ScanInfo {
+        std::unique_ptr<NbrScanState> scanState;
+        bool isFwd;
+    };
+
+public:
+    explicit LandmarkNbrScanner(Graph* graph) : graph{graph} {
+        for (auto tableID : graph->getNodeTableIDs()) {
+            for (auto& relInfo : graph->getRelInfos(tableID)) {
+                fwdScans[relInfo.srcTableID].push_back(
+                    ScanInfo{graph->prepareRelScan(*relInfo.relGroupEntry, relInfo.relTableID,
+                                 relInfo.dstTableID, {}),
+                        true /* isFwd */});
+                bwdScans[relInfo.dstTableID].push_back(
+                    ScanInfo{graph->prepareRelScan(*relInfo.relGroupEntry, relInfo.relTableID,
+                                 relInfo.srcTableID, {}),
+                        false /* isFwd */});
+            }
+        }
+    }
+
+    template<typename Func>
+    void forEachNbr(nodeID_t nodeID, ExtendDirection direction, Func&& func) {
+        if (direction != ExtendDirection::BWD) {
+            scan(nodeID, fwdScans, func);
+        }
+        if (direction != ExtendDirection::FWD) {
+            scan(nodeID, bwdScans, func);
+        }
+    }
+
+private:
+    template<typename Func>
+    void scan(nodeID_t nodeID, table_id_map_t<std::vector<ScanInfo>>& scans, Func& func) {
+        if (!scans.contains(nodeID.tableID)) {
+            return;
+        }
+        for (auto& scanInfo : scans.at(nodeID.tableID)) {
+            auto iterator = scanInfo.isFwd ? graph->scanFwd(nodeID, *scanInfo.scanState) :
+                                             graph->scanBwd(nodeID, *scanInfo.scanState);
+            for (auto chunk : iterator) {
+                chunk.forEach([&](auto nbrNodeIDs, auto, auto i) { func(nbrNodeIDs[i]); });
+            }
+        }
+    }
+
+private:
+    Graph* graph;
+    table_id_map_t<std::vector<ScanInfo>> fwdScans;
+    table_id_map_t<std::vector<ScanInfo>> bwdScans;
+};
+
+// Runs jobs [0, numJobs) on all threads, one job at a time.
+class LandmarkBFSTask final : public Task {
+public:
+    using job_func_t = std::function<void(uint64_t, LandmarkNbrScanner&)>;
+
+    LandmarkBFSTask(uint64_t maxNumThreads, processor::ExecutionContext* context, Graph* graph,
+        uint64_t numJobs, job_func_t func)
+        : Task{maxNumThreads}, context{context}, graph{graph}, numJobs{numJobs},
+          func{std::move(func)} {}
+
+    void run() override {
+        LandmarkNbrScanner scanner(graph);
+        while (true) {
+            auto job = nextJob.fetch_add(1, std::memory_order_relaxed);
+            if (job >= numJobs) {
+                return;
+            }
+            if (context->clientContext->interrupted()) {
+                throw InterruptException{};
+            }
+            func(job, scanner);
+        }
+    }
+
+    static void runJobs(processor::ExecutionContext* context, Graph* graph, uint64_t numJobs,
+        job_func_t func) {
+        auto clientContext = context->clientContext;
+        auto task = std::make_shared<LandmarkBFSTask>(clientContext->getMaxNumThreadForExec(),
+            context, graph, numJobs, std::move(func));
+        TaskScheduler::Get(*clientContext)
+            ->scheduleTaskAndWaitOrError(task, context, true /* launchNewWorkerThread */);
+    }
+
+private:
+    processor::ExecutionContext* context;
+    Graph* graph;
+    uint64_t numJobs;
+    job_func_t func;
+    std::atomic<uint64_t> nextJob = 0;
+};
+
+static ExtendDirection reverse(ExtendDirection direction) {
+    switch (direction) {
+    case ExtendDirection::FWD:
+        return ExtendDirection::BWD;
+    case ExtendDirection::BWD:
+        return ExtendDirection::FWD;
+    default:
+        return direction;
+    }
+}
+
+static constexpr offset_t DEGREE_MORSEL_SIZE = 2048;
+
+void LandmarkIndex::build(processor::ExecutionContext* context, Graph* graph,
+    uint64_t maxNumLandmarks) {
+    KU_ASSERT(!built);
+    auto transaction = transaction::Transaction::Get(*context->clientContext);
+    auto maxOffsetMap = graph->getMaxOffsetMap(transaction);
+    std::vector<nodeID_t> morselStarts;
+    for (auto& [tableID, maxOffset] : maxOffsetMap) {
+        tableStartIDs.emplace(tableID, numNodes);
+        numNodes += maxOffset;
+        for (auto offset = 0u; offset < maxOffset; offset += DEGREE_MORSEL_SIZE) {
+            morselStarts.push_back(nodeID_t{offset, tableID});
+        }
+    }
+    // Counts edges in both directions, so that landmarks are central in undirected terms too.
+    std::vector<uint64_t> degrees(numNodes, 0);
+    LandmarkBFSTask::runJobs(context, graph, morselStarts.size(),
+        [&](uint64_t job, LandmarkNbrScanner& scanner) {
+            auto start = morselStarts[job];
+            auto end = std::min(start.offset + DEGREE_MORSEL_SIZE, maxOffsetMap.at(start.tableID));
+            for (auto offset = start.offset; offset < end; ++offset) {
+                auto nodeID = nodeID_t{offset, start.tableID};
+                auto& degree = degrees[getID(nodeID)];
+                scanner.forEachNbr(nodeID, ExtendDirection::BOTH, [&](nodeID_t) { degree++; });
+            }
+        });
+    std::vector<nodeID_t> candidates;
+    for (auto& [tableID, maxOffset] : maxOffsetMap) {
+        for (auto offset = 0u; offset < maxOffset; ++offset) {
+            if (degrees[tableStartIDs.at(tableID) + offset] > 0) {
+                candidates.push_back(nodeID_t{offset, tableID});
+            }
+        }
+    }
+    numLandmarks = std::min<uint64_t>(maxNumLandmarks, candidates.size());
+    // Ties are broken by node ID so that the landmarks are deterministic.
+    std::partial_sort(candidates.begin(), candidates.begin() + numLandmarks, candidates.end(),
+        [&](nodeID_t a, nodeID_t b) {
+            auto aDegree = degrees[getID(a)];
+            auto bDegree = degrees[getID(b)];
+            return aDegree > bDegree || (aDegree == bDegree && a < b);
+        });
+    candidates.resize(numLandmarks);
+    fromLandmark.assign(numLandmarks * numNodes, UNREACHED);
+    if (direction != ExtendDirection::BOTH) {
+        toLandmark.assign(numLandmarks * numNodes, UNREACHED);
+    }
+    // Job l < numLandmarks fills the distances from landmark l, and job numLandmarks + l the
+    // distances to it, i.e. from it following edges in reverse.
+    auto numJobs = direction == ExtendDirection::BOTH ? numLandmarks : 2 * numLandmarks;
+    LandmarkBFSTask::runJobs(context, graph, numJobs,
+        [&](uint64_t job, LandmarkNbrScanner& scanner) {
+            auto isFrom = job < numLandmarks;
+            auto landmark = candidates[isFrom ? job : job - numLandmarks];
+            auto dists = (isFrom ? fromLandmark.data() : toLandmark.data()) +
+                         (isFrom ? job : job - numLandmarks) * numNodes;
+            auto bfsDirection = isFrom ? direction : reverse(direction);
+            std::vector<nodeID_t> frontier{landmark};
+            std::vector<nodeID_t> nextFrontier;
+            dists[getID(landmark)] = 0;
+            for (uint16_t depth = 1; !frontier.empty() && depth < UNREACHED; ++depth) {
+                for (auto nodeID : frontier) {
+                    scanner.forEachNbr(nodeID, bfsDirection, [&](nodeID_t nbrNodeID) {
+                        auto& dist = dists[getID(nbrNodeID)];
+                        if (dist == UNREACHED) {
+                            dist = depth;
+                            nextFrontier.push_back(nbrNodeID);
+                        }
+                    });
+                }
+                std::swap(frontier, nextFrontier);
+                nextFrontier.clear();
+            }
+        });
+    built = true;
+}
+
+template<bool COMPUTE_UPPER>
+LandmarkIndex::Bounds LandmarkIndex::computeBounds(nodeID_t src, nodeID_t dst) const {
+    KU_ASSERT(built);
+    Bounds bounds{0, UNREACHED};
+    if (!tableStartIDs.contains(src.tableID) || !tableStartIDs.contains(dst.tableID)) {
+        return bounds;
+    }
+    auto srcID = getID(src);
+    auto dstID = getID(dst);
+    auto& toDists = direction == ExtendDirection::BOTH ? fromLandmark : toLandmark;
+    for (auto l = 0u; l < numLandmarks; ++l) {
+        auto fromSrc = fromLandmark[l * numNodes + srcID];
+        auto fromDst = fromLandmark[l * numNodes + dstID];
+        auto srcTo = toDists[l * numNodes + srcID];
+        auto dstTo = toDists[l * numNodes + dstID];
+        if (fromSrc != UNREACHED) {
+            if (fromDst == UNREACHED) {
+                return Bounds{UNREACHED, UNREACHED};
+            }
+            if (fromDst > fromSrc) {
+                bounds.lower = std::max<uint16_t>(bounds.lower, fromDst - fromSrc);
+            }
+        }
+        if (dstTo != UNREACHED) {
+            if (srcTo == UNREACHED) {
+                return Bounds{UNREACHED, UNREACHED};
+            }
+            if (srcTo > dstTo) {
+                bounds.lower = std::max<uint16_t>(bounds.lower, srcTo - dstTo);
+            }
+        }
+        if constexpr (COMPUTE_UPPER) {
+            if (srcTo != UNREACHED && fromDst != UNREACHED) {
+                bounds.upper =
+                    static_cast<uint16_t>(std::min<uint32_t>(bounds.upper, srcTo + fromDst));
+            }
+        }
+    }
+    return bounds;
+}
+
+LandmarkIndex::Bounds LandmarkIndex::getBounds(nodeID_t src, nodeID_t dst) const {
+    return computeBounds<true /* COMPUTE_UPPER */>(src, dst);
+}
+
+uint16_t LandmarkIndex::getLowerBound(nodeID_t src, nodeID_t dst) const {
+    return computeBounds<false /* COMPUTE_UPPER */>(src, dst).lower;
+}
+
+std::string LandmarkIndex::getKey(Graph* graph, ExtendDirection direction) {
+    auto graphEntry = graph->getGraphEntry();
+    std::vector<table_id_t> nodeTableIDs, relTableIDs;
+    for (auto& nodeInfo : graphEntry->nodeInfos) {
+        if (nodeInfo.predicate != nullptr) {
+            return "";
+        }
+        nodeTableIDs.push_back(nodeInfo.entry->getTableID());
+    }
+    for (auto& relInfo : graphEntry->relInfos) {
+        if (relInfo.predicate != nullptr) {
+            return "";
+        }
+        relTableIDs.push_back(relInfo.entry->getTableID());
+    }
+    std::sort(nodeTableIDs.begin(), nodeTableIDs.end());
+    std::sort(relTableIDs.begin(), relTableIDs.end());
+    auto key = std::to_string(static_cast<uint8_t>(direction));
+    for (auto tableID : nodeTableIDs) {
+        key += " n" + std::to_string(tableID);
+    }
+    for (auto tableID : relTableIDs) {
+        key += " r" + std::to_string(tableID);
+    }
+    return key;
+}
+
+} // namespace graph
+} // namespace lbug
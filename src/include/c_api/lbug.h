@@ -96,6 +96,26 @@ struct ArrowArray {
 
 #endif // ARROW_C_DATA_INTERFACE
 
+// The Arrow C stream interface.
+// https://arrow.apache.org/docs/format/CStreamInterface.html
+
+#ifndef ARROW_C_STREAM_INTERFACE
+#define ARROW_C_STREAM_INTERFACE
+
+struct ArrowArrayStream {
+    // Callbacks providing stream functionality
+    int (*get_schema)(struct ArrowArrayStream*, struct ArrowSchema* out);
+    int (*get_next)(struct ArrowArrayStream*, struct ArrowArray* out);
+    const char* (*get_last_error)(struct ArrowArrayStream*);
+
+    // Release callback
+    void (*release)(struct ArrowArrayStream*);
+    // Opaque producer-specific data
+    void* private_data;
+};
+
+#endif // ARROW_C_STREAM_INTERFACE
+
 #ifdef __cplusplus
 }
 #endif
@@ -391,6 +411,18 @@ LBUG_C_API lbug_state lbug_connection_get_max_num_thread_for_exec(lbug_connectio
  */
 LBUG_C_API lbug_state lbug_connection_query(lbug_connection* connection, const char* query,
     lbug_query_result* out_query_result);
+/**
+ * @brief Executes the given query in the background and returns its result as a stream. Tuples can
+ * be read with lbug_query_result_get_next() while the query is still running, and execution pauses
+ * while they are not read. The connection cannot execute other queries until all tuples are read or
+ * the query result is destroyed.
+ * @param connection The connection instance to execute the query.
+ * @param query The query to execute. Must be a single statement.
+ * @param[out] out_query_result The output parameter that will hold the result of the query.
+ * @return The state indicating the success or failure of the operation.
+ */
+LBUG_C_API lbug_state lbug_connection_query_as_stream(lbug_connection* connection,
+    const char* query, lbug_query_result* out_query_result);
 /**
  * @brief Prepares the given query and returns the prepared statement.
  * @param connection The connection instance to prepare the query.
@@ -681,6 +713,8 @@ LBUG_C_API lbug_state lbug_query_result_get_query_summary(lbug_query_result* que
     lbug_query_summary* out_query_summary);
 /**
  * @brief Returns true if we have not consumed all tuples in the query result, false otherwise.
+ * For a streaming query result, also returns false if the query failed while streaming; check
+ * lbug_query_result_is_success afterwards.
  * @param query_result The query result instance to check.
  */
 LBUG_C_API bool lbug_query_result_has_next(lbug_query_result* query_result);
@@ -749,6 +783,20 @@ LBUG_C_API lbug_state lbug_query_result_get_arrow_schema(lbug_query_result* quer
 LBUG_C_API lbug_state lbug_query_result_get_next_arrow_chunk(lbug_query_result* query_result,
     int64_t chunk_size, struct ArrowArray* out_arrow_array);
 
+/**
+ * @brief Returns the remaining tuples of the query result as an arrow C stream.
+ * @param query_result The query result instance to return.
+ * @param chunk_size The number of tuples in each array of the stream.
+ * @param[out] out_stream The output parameter that will hold the arrow array stream. Each array of
+ * the stream is the same as the one returned by lbug_query_result_get_next_arrow_chunk.
+ * @return The state indicating the success or failure of the operation.
+ *
+ * The stream reads from the query result, which must not be destroyed before the stream is
+ * released. It is the caller's responsibility to call the release function of the stream.
+ */
+LBUG_C_API lbug_state lbug_query_result_get_arrow_stream(lbug_query_result* query_result,
+    int64_t chunk_size, struct ArrowArrayStream* out_stream);
+
 // FlatTuple
 /**
  * @brief Destroys the given flat tuple instance.
@@ -1461,6 +1509,17 @@ LBUG_C_API double lbug_query_summary_get_compiling_time(lbug_query_summary* quer
  * @param query_summary The query summary to get execution time.
  */
 LBUG_C_API double lbug_query_summary_get_execution_time(lbug_query_summary* query_summary);
+/**
+ * @brief Returns the planning time of the given query summary in milliseconds. The planning time
+ * is part of the compiling time.
+ * @param query_summary The query summary to get planning time.
+ */
+LBUG_C_API double lbug_query_summary_get_planning_time(lbug_query_summary* query_summary);
+/**
+ * @brief Returns the peak intermediate memory usage of the given query summary in bytes.
+ * @param query_summary The query summary to get peak memory usage.
+ */
+LBUG_C_API uint64_t lbug_query_summary_get_peak_memory_usage(lbug_query_summary* query_summary);
 
 // Utility functions
 /**
@@ -16,6 +16,7 @@ class FlatTuple;
 
 namespace common {
 class Value;
+class ValueVector;
 
 // An Arrow Vector(i.e., Array) is defined by a few pieces of metadata and data:
 //  1) a logical data type;
@@ -53,11 +54,18 @@ public:
         bool fallbackExtensionTypes);
 
     void append(const processor::FlatTuple& tuple);
+    // Appends the tuples at selected positions [startIdx, startIdx + numTuples) of the given vectors.
+    // Unflat vectors must share the same state. Flat vectors repeat their value for each tuple.
+    // Columns whose ValueVector layout matches the arrow layout are copied straight from the vector
+    // buffer; other columns are converted value by value.
+    void append(const std::vector<ValueVector*>& vectors, sel_t startIdx, sel_t numTuples);
     std::int64_t size() const { return numTuples; }
     ArrowArray toArray(const std::vector<LogicalType>& types);
 
 private:
     static void appendValue(ArrowVector* vector, const Value& value, bool fallbackExtensionTypes);
+    static void appendVector(ArrowVector* arrowVector, ValueVector& vector, sel_t startIdx,
+        sel_t numTuples, bool fallbackExtensionTypes);
 
     static ArrowArray* convertVectorToArray(ArrowVector& vector, const LogicalType& type,
         bool fallbackExtensionTypes);
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace lbug {
+namespace common {
+
+// A blocked Bloom filter over hash values: each hash sets NUM_BITS_PER_HASH bits in a single 64-bit
+// word, so that a lookup touches one word only. The filter is empty until initialized, and an
+// uninitialized filter may contain anything.
+// Note that this class is NOT thread-safe for concurrent inserts.
+class LBUG_API BloomFilter {
+    static constexpr uint64_t NUM_BITS_PER_ENTRY = 16;
+    static constexpr uint64_t NUM_BITS_PER_HASH = 4;
+
+public:
+    BloomFilter() = default;
+
+    void init(uint64_t numEntries);
+    bool isInitialized() const { return !words.empty(); }
+
+    void insert(hash_t hash) { words[getWordIdx(hash)] |= getBitMask(hash); }
+
+    bool mayContain(hash_t hash) const {
+        if (words.empty()) {
+            return true;
+        }
+        const auto mask = getBitMask(hash);
+        return (words[getWordIdx(hash)] & mask) == mask;
+    }
+
+private:
+    uint64_t getWordIdx(hash_t hash) const { return (hash >> 32) & wordIdxMask; }
+    static uint64_t getBitMask(hash_t hash);
+
+private:
+    std::vector<uint64_t> words;
+    uint64_t wordIdxMask = 0;
+};
+
+} // namespace common
+} // namespace lbug
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace lbug {
+namespace common {
+
+// Priority classes of tasks in the TaskScheduler. Lower values are served first.
+enum class TaskPriority : uint8_t {
+    HIGH = 0,
+    NORMAL = 1,
+    LOW = 2,
+};
+
+struct TaskPriorityUtils {
+    static constexpr uint8_t NUM_PRIORITIES = 3;
+
+    static TaskPriority fromString(const std::string& str);
+    static std::string toString(TaskPriority priority);
+};
+
+} // namespace common
+} // namespace lbug
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "common/api.h"
+#include "exception.h"
+
+namespace lbug {
+namespace common {
+
+// Thrown during execution if a cardinality estimate turned out to be so far off that the query
+// should be planned again, see planner::CardinalityFeedback. It is handled by the client context
+// and never reported to users.
+class LBUG_API ReoptimizationException : public Exception {
+public:
+    explicit ReoptimizationException() : Exception("Query needs to be re-optimized."){};
+};
+
+} // namespace common
+} // namespace lbug
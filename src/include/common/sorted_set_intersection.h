@@ -0,0 +1,29 @@
+#pragma once
+
+#include "common/types/types.h"
+
+namespace lbug {
+namespace common {
+
+// Intersects two ascending lists of distinct 64-bit values. Lists of similar sizes are merged in
+// SIMD blocks where the CPU supports it, and a list that is much smaller than the other one is
+// galloped into the larger list, so that the cost depends on the smaller list only.
+struct LBUG_API SortedSetIntersection {
+    // Lists whose sizes differ by at least this factor are intersected by galloping.
+    static constexpr uint64_t GALLOPING_SIZE_RATIO = 32;
+
+    // Writes the positions of the common values in `a` and `b` to `aPositions` and `bPositions`,
+    // which must have room for min(aSize, bSize) positions, and returns the number of common
+    // values. Positions are written in ascending order.
+    static uint64_t intersect(const uint64_t* a, uint64_t aSize, const uint64_t* b,
+        uint64_t bSize, sel_t* aPositions, sel_t* bPositions);
+    // Same as above on the offsets of node IDs, which must all belong to the same table.
+    static uint64_t intersect(const nodeID_t* a, uint64_t aSize, const nodeID_t* b,
+        uint64_t bSize, sel_t* aPositions, sel_t* bPositions);
+
+    // Returns the number of common values.
+    static uint64_t count(const uint64_t* a, uint64_t aSize, const uint64_t* b, uint64_t bSize);
+};
+
+} // namespace common
+} // namespace lbug
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "common/api.h"
+#include "common/enums/task_priority.h"
 
 namespace lbug {
 namespace common {
@@ -29,7 +30,8 @@ class LBUG_API Task {
 public:
     explicit Task(uint64_t maxNumThreads)
         : parent{nullptr}, maxNumThreads{maxNumThreads}, numThreadsFinished{0},
-          numThreadsRegistered{0}, exceptionsPtr{nullptr}, ID{UINT64_MAX} {}
+          numThreadsRegistered{0}, exceptionsPtr{nullptr}, ID{UINT64_MAX},
+          priority{TaskPriority::NORMAL} {}
 
     virtual ~Task() = default;
     virtual void run() = 0;
@@ -58,6 +60,13 @@ public:
 
     void setSingleThreadedTask() { maxNumThreads = 1; }
 
+    void setPriority(TaskPriority priority_) { priority = priority_; }
+    TaskPriority getPriority() const { return priority; }
+
+    // Returns whether a new worker can currently register itself to this task, and if so the
+    // number of workers already registered to it.
+    bool canRegister(uint64_t& numRegistered);
+
     bool registerThread();
 
     void deRegisterThreadAndFinalizeTask();
@@ -101,6 +110,7 @@ protected:
     uint64_t maxNumThreads, numThreadsFinished, numThreadsRegistered;
     std::exception_ptr exceptionsPtr;
     uint64_t ID;
+    TaskPriority priority;
 };
 
 } // namespace common
@@ -1,4 +1,5 @@
 #pragma once
+#include <array>
 #include <deque>
 
 #ifndef __SINGLE_THREADED__
@@ -10,12 +11,27 @@
 #include "processor/execution_context.h"
 
 namespace lbug {
+namespace storage {
+class QueryMemoryTracker;
+}
+namespace testing {
+class TaskSchedulerTest;
+} // namespace testing
 namespace common {
 
 struct ScheduledTask {
-    ScheduledTask(std::shared_ptr<Task> task, uint64_t ID) : task{std::move(task)}, ID{ID} {};
+    // Number of times a waiting task can be passed over in favour of a task of a higher priority
+    // class before it is promoted to the next higher class.
+    static constexpr uint64_t NUM_SKIPS_BEFORE_PROMOTION = 16;
+
+    ScheduledTask(std::shared_ptr<Task> task, uint64_t ID,
+        std::shared_ptr<storage::QueryMemoryTracker> memoryTracker)
+        : task{std::move(task)}, ID{ID}, numSkips{0}, memoryTracker{std::move(memoryTracker)} {};
     std::shared_ptr<Task> task;
     uint64_t ID;
+    uint64_t numSkips;
+    // Memory allocated by workers running the task is charged to the query that scheduled it.
+    std::shared_ptr<storage::QueryMemoryTracker> memoryTracker;
 };
 
 /**
@@ -34,13 +50,27 @@ struct ScheduledTask {
  * one of the threads working on T that errored. This is simply done by the call:
  *      scheduleTaskAndWaitOrError(T);
  *
- * TaskScheduler guarantees that workers will register themselves to tasks in FIFO order. However
- * this does not guarantee that the tasks will be completed in FIFO order: a long running task
- * that is not accepting more registration can stay in the queue for an unlimited time until
- * completion.
+ * Tasks are kept in one queue per priority class (see TaskPriority), which is taken from the
+ * query_priority setting of the client scheduling the task. A worker looking for work first serves
+ * the HIGH queue, then NORMAL, then LOW. Within a queue, the worker registers itself to the task
+ * that currently has the fewest workers registered, breaking ties in FIFO order. So a newly
+ * scheduled task (e.g., a short lookup) gets the next free worker instead of queueing behind a
+ * long running task that would accept every worker in the system. The number of workers a task
+ * can use is capped by its maxNumThreads (the threads setting of the client), which leaves
+ * workers free for other connections sharing the same database. Note that workers are never
+ * preempted: a worker registered to a task keeps working on it until the task runs out of morsels.
+ * To keep lower priority classes from starving under sustained load of higher ones, tasks age:
+ * every time a worker registers to a task of a higher class while a task is waiting to accept
+ * workers, the waiting task is skipped once, and after NUM_SKIPS_BEFORE_PROMOTION skips it is
+ * promoted to the next higher class. So a LOW task waits for at most a bounded number of worker
+ * registrations before it competes as a HIGH task.
+ * This does not guarantee that tasks will be completed in any order: a long running task that is
+ * not accepting more registration can stay in the queue for an unlimited time until completion.
  */
 #ifndef __SINGLE_THREADED__
 class LBUG_API TaskScheduler {
+    friend class testing::TaskSchedulerTest;
+
 public:
 #if defined(__APPLE__)
     explicit TaskScheduler(uint64_t numWorkerThreads, uint32_t threadQos);
@@ -63,15 +93,18 @@ private:
     // Functions to launch worker threads and for the worker threads to use to grab task from queue.
     void runWorkerThread();
 
-    std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task);
+    std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task,
+        std::shared_ptr<storage::QueryMemoryTracker> memoryTracker);
 
     void removeErroringTask(uint64_t scheduledTaskID);
 
     std::shared_ptr<ScheduledTask> getTaskAndRegister();
-    static void runTask(Task* task);
+    void ageWaitingTasks(uint8_t servedPriority);
+    static void runTask(Task* task, std::shared_ptr<storage::QueryMemoryTracker> memoryTracker);
 
 private:
-    std::deque<std::shared_ptr<ScheduledTask>> taskQueue;
+    std::array<std::deque<std::shared_ptr<ScheduledTask>>, TaskPriorityUtils::NUM_PRIORITIES>
+        taskQueues;
     bool stopWorkerThreads;
     std::vector<std::thread> workerThreads;
     std::mutex taskSchedulerMtx;
@@ -84,6 +117,8 @@ private:
 #else
 // Single-threaded version of TaskScheduler
 class TaskScheduler {
+    friend class testing::TaskSchedulerTest;
+
 public:
     explicit TaskScheduler(uint64_t numWorkerThreads);
     ~TaskScheduler();
@@ -94,15 +129,18 @@ public:
     static TaskScheduler* Get(const main::ClientContext& context);
 
 private:
-    std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task);
+    std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task,
+        std::shared_ptr<storage::QueryMemoryTracker> memoryTracker);
 
     void removeErroringTask(uint64_t scheduledTaskID);
 
     std::shared_ptr<ScheduledTask> getTaskAndRegister();
-    static void runTask(Task* task);
+    void ageWaitingTasks(uint8_t servedPriority);
+    static void runTask(Task* task, std::shared_ptr<storage::QueryMemoryTracker> memoryTracker);
 
 private:
-    std::deque<std::shared_ptr<ScheduledTask>> taskQueue;
+    std::array<std::deque<std::shared_ptr<ScheduledTask>>, TaskPriorityUtils::NUM_PRIORITIES>
+        taskQueues;
     bool stopWorkerThreads;
     std::mutex taskSchedulerMtx;
     uint64_t nextScheduledTaskID;
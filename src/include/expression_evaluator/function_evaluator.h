@@ -1,11 +1,32 @@
 #pragma once
 
 #include "expression_evaluator.h"
+#include "function/comparison/comparison_select_kernels.h"
 #include "function/scalar_function.h"
 
 namespace lbug {
 namespace evaluator {
 
+// A predicate between a column and constants that is evaluated with
+// function::ComparisonSelectKernels: a comparison, a conjunction of a lower and an upper bound
+// comparison on the same column (i.e. BETWEEN) or an IN-list.
+struct SelectKernelInfo {
+    enum class Kind : uint8_t { COMPARE = 0, BETWEEN = 1, IN = 2 };
+
+    Kind kind;
+    ExpressionEvaluator* columnEvaluator;
+    // The list of an IN-list.
+    common::ValueVector* constant;
+    function::SelectKernelOp op;
+    // The upper bound of BETWEEN.
+    common::ValueVector* upperConstant = nullptr;
+    function::SelectKernelOp upperOp = function::SelectKernelOp::LESS_THAN_EQUALS;
+
+    SelectKernelInfo(Kind kind, ExpressionEvaluator* columnEvaluator,
+        common::ValueVector* constant, function::SelectKernelOp op)
+        : kind{kind}, columnEvaluator{columnEvaluator}, constant{constant}, op{op} {}
+};
+
 class FunctionExpressionEvaluator : public ExpressionEvaluator {
     static constexpr EvaluatorType type_ = EvaluatorType::FUNCTION;
 
@@ -18,6 +39,8 @@ public:
 
     bool selectInternal(common::SelectionVector& selVector) override;
 
+    const SelectKernelInfo* getSelectKernelInfo() const { return selectKernelInfo.get(); }
+
     std::unique_ptr<ExpressionEvaluator> copy() override {
         return std::make_unique<FunctionExpressionEvaluator>(expression, copyVector(children));
     }
@@ -29,6 +52,17 @@ protected:
     void runExecFunc(void* dataPtr = nullptr);
 
 private:
+    void resolveSelectKernel();
+    void resolveConstant();
+    // Returns false if the kernel does not apply to the current input, e.g. because the column is
+    // flat or a constant is null.
+    bool trySelectWithKernel(common::SelectionVector& selVector, bool& hasSelectedValues);
+
+private:
+    std::unique_ptr<SelectKernelInfo> selectKernelInfo;
+    // A deterministic function of literals and parameters only is evaluated once per execution.
+    bool isConstant = false;
+    bool hasConstantResult = false;
     std::vector<std::shared_ptr<common::ValueVector>> parameters;
     std::unique_ptr<function::ScalarFunction> function;
     std::unique_ptr<function::FunctionBindData> bindData;
@@ -17,6 +17,14 @@ struct CountFunction : public BaseCountFunction {
         reinterpret_cast<CountState*>(state_)->count += multiplicity;
     }
 
+    static void updateBatch(uint8_t** entries, uint32_t stateOffset, common::ValueVector* input,
+        const common::SelectionVector& selVector, uint64_t multiplicity,
+        common::InMemOverflowBuffer* /*overflowBuffer*/) {
+        AggregateFunctionUtils::forEachNonNull(*input, selVector, [&](auto pos) {
+            reinterpret_cast<CountState*>(entries[pos] + stateOffset)->count += multiplicity;
+        });
+    }
+
     static void paramRewriteFunc(binder::expression_vector& arguments);
 
     static function_set getFunctionSet();
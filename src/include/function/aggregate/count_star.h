@@ -14,6 +14,10 @@ struct CountStarFunction : public BaseCountFunction {
     static void updatePos(uint8_t* state_, common::ValueVector* input, uint64_t multiplicity,
         uint32_t /*pos*/, common::InMemOverflowBuffer* /*overflowBuffer*/);
 
+    static void updateBatch(uint8_t** entries, uint32_t stateOffset, common::ValueVector* input,
+        const common::SelectionVector& selVector, uint64_t multiplicity,
+        common::InMemOverflowBuffer* /*overflowBuffer*/);
+
     static function_set getFunctionSet();
 };
 
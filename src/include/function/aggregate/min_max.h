@@ -36,6 +36,16 @@ struct MinMaxFunction {
         updateSingleValue<OP>(reinterpret_cast<MinMaxState*>(state_), input, pos, overflowBuffer);
     }
 
+    template<class OP>
+    static void updateBatch(uint8_t** entries, uint32_t stateOffset, common::ValueVector* input,
+        const common::SelectionVector& selVector, uint64_t /*multiplicity*/,
+        common::InMemOverflowBuffer* overflowBuffer) {
+        AggregateFunctionUtils::forEachNonNull(*input, selVector, [&](auto pos) {
+            updateSingleValue<OP>(reinterpret_cast<MinMaxState*>(entries[pos] + stateOffset),
+                input, pos, overflowBuffer);
+        });
+    }
+
     template<class OP>
     static void updateSingleValue(MinMaxState* state, common::ValueVector* input, uint32_t pos,
         common::InMemOverflowBuffer* overflowBuffer) {
@@ -36,6 +36,15 @@ struct SumFunction {
         updateSingleValue(state, input, pos, multiplicity);
     }
 
+    static void updateBatch(uint8_t** entries, uint32_t stateOffset, common::ValueVector* input,
+        const common::SelectionVector& selVector, uint64_t multiplicity,
+        common::InMemOverflowBuffer* /*overflowBuffer*/) {
+        AggregateFunctionUtils::forEachNonNull(*input, selVector, [&](auto pos) {
+            updateSingleValue(reinterpret_cast<SumState<RESULT_TYPE>*>(entries[pos] + stateOffset),
+                input, pos, multiplicity);
+        });
+    }
+
     static void updateSingleValue(SumState<RESULT_TYPE>* state, common::ValueVector* input,
         uint32_t pos, uint64_t multiplicity) {
         INPUT_TYPE val = input->getValue<INPUT_TYPE>(pos);
@@ -30,6 +30,11 @@ using aggr_update_all_function_t = std::function<void(uint8_t* state, common::Va
     uint64_t multiplicity, common::InMemOverflowBuffer* overflowBuffer)>;
 using aggr_update_pos_function_t = std::function<void(uint8_t* state, common::ValueVector* input,
     uint64_t multiplicity, uint32_t pos, common::InMemOverflowBuffer* overflowBuffer)>;
+// Updates the state at entries[pos] + stateOffset with the input value at pos, for each position of
+// the selection vector whose input value is not null. The input is nullptr for COUNT(*).
+using aggr_update_batch_function_t = std::function<void(uint8_t** entries, uint32_t stateOffset,
+    common::ValueVector* input, const common::SelectionVector& selVector, uint64_t multiplicity,
+    common::InMemOverflowBuffer* overflowBuffer)>;
 using aggr_combine_function_t = std::function<void(uint8_t* state, uint8_t* otherState,
     common::InMemOverflowBuffer* overflowBuffer)>;
 using aggr_finalize_function_t = std::function<void(uint8_t* state)>;
@@ -40,6 +45,9 @@ struct AggregateFunction final : public ScalarOrAggregateFunction {
     aggr_initialize_function_t initializeFunc;
     aggr_update_all_function_t updateAllFunc;
     aggr_update_pos_function_t updatePosFunc;
+    // Optional. Updates the states of a whole vector of groups in one call, see
+    // AggregateHashTable::updateAggState.
+    aggr_update_batch_function_t updateBatchFunc;
     aggr_combine_function_t combineFunc;
     aggr_finalize_function_t finalizeFunc;
     std::unique_ptr<AggregateState> initialNullAggregateState;
@@ -83,6 +91,15 @@ struct AggregateFunction final : public ScalarOrAggregateFunction {
         return updatePosFunc(state, input, multiplicity, pos, overflowBuffer);
     }
 
+    bool hasUpdateBatchFunc() const { return updateBatchFunc != nullptr; }
+
+    void updateBatchState(uint8_t** entries, uint32_t stateOffset, common::ValueVector* input,
+        const common::SelectionVector& selVector, uint64_t multiplicity,
+        common::InMemOverflowBuffer* overflowBuffer) const {
+        return updateBatchFunc(entries, stateOffset, input, selVector, multiplicity,
+            overflowBuffer);
+    }
+
     void combineState(uint8_t* state, uint8_t* otherState,
         common::InMemOverflowBuffer* overflowBuffer) const {
         return combineFunc(state, otherState, overflowBuffer);
@@ -101,10 +118,27 @@ struct AggregateFunctionUtils {
     static std::unique_ptr<AggregateFunction> getAggFunc(std::string name,
         common::LogicalTypeID inputType, common::LogicalTypeID resultType, bool isDistinct,
         param_rewrite_function_t paramRewriteFunc = nullptr) {
-        return std::make_unique<AggregateFunction>(std::move(name),
+        auto function = std::make_unique<AggregateFunction>(std::move(name),
             std::vector<common::LogicalTypeID>{inputType}, resultType, T::initialize, T::updateAll,
             T::updatePos, T::combine, T::finalize, isDistinct, nullptr /* bindFunc */,
             paramRewriteFunc);
+        function->updateBatchFunc = T::updateBatch;
+        return function;
+    }
+
+    // Calls update for each position of the selection vector whose input value is not null.
+    template<typename FUNC>
+    static void forEachNonNull(const common::ValueVector& input,
+        const common::SelectionVector& selVector, FUNC&& update) {
+        if (input.hasNoNullsGuarantee()) {
+            selVector.forEach(update);
+        } else {
+            selVector.forEach([&](auto pos) {
+                if (!input.isNull(pos)) {
+                    update(pos);
+                }
+            });
+        }
     }
 
     template<template<typename, typename> class FunctionType>
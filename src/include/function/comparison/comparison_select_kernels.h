@@ -0,0 +1,59 @@
+#pragma once
+
+#include <span>
+
+#include "common/data_chunk/sel_vector.h"
+
+namespace lbug {
+namespace function {
+
+enum class SelectKernelOp : uint8_t {
+    EQUALS = 0,
+    NOT_EQUALS = 1,
+    GREATER_THAN = 2,
+    GREATER_THAN_EQUALS = 3,
+    LESS_THAN = 4,
+    LESS_THAN_EQUALS = 5,
+};
+
+struct SelectKernelOpUtil {
+    // Returns the operator to use if the operands are swapped, i.e. `c op x` <=> `x flip(op) c`.
+    static SelectKernelOp flip(SelectKernelOp op);
+    static bool isLowerBound(SelectKernelOp op) {
+        return op == SelectKernelOp::GREATER_THAN || op == SelectKernelOp::GREATER_THAN_EQUALS;
+    }
+    static bool isUpperBound(SelectKernelOp op) {
+        return op == SelectKernelOp::LESS_THAN || op == SelectKernelOp::LESS_THAN_EQUALS;
+    }
+};
+
+// Select kernels evaluate predicates between a column of fixed-size values and constants and write
+// the positions of the qualifying values straight into a selection vector, without materializing a
+// BOOL result vector. Values at the positions selected by `input` are checked; null checks are the
+// responsibility of the caller. `output` may alias the positions of `input`.
+//
+// Unfiltered input is processed with AVX-512, AVX2 (both picked at runtime) or NEON, filtered input
+// and other types with a branch-free scalar loop. The results follow the scalar comparison
+// functions exactly, including for NaN.
+//
+// Supported types: int8_t to int64_t, uint8_t to uint64_t, float and double. SIMD is used for the
+// 32-bit and 64-bit types.
+struct ComparisonSelectKernels {
+    // Selects the positions of values where `value op constant` holds.
+    template<typename T>
+    static uint64_t compare(const T* values, const common::SelectionView& input, SelectKernelOp op,
+        T constant, common::sel_t* output);
+
+    // Selects the positions of values where `value lowerOp lower AND value upperOp upper` holds.
+    template<typename T>
+    static uint64_t between(const T* values, const common::SelectionView& input,
+        SelectKernelOp lowerOp, T lower, SelectKernelOp upperOp, T upper, common::sel_t* output);
+
+    // Selects the positions of values that are equal to any of `constants`.
+    template<typename T>
+    static uint64_t in(const T* values, const common::SelectionView& input,
+        std::span<const T> constants, common::sel_t* output);
+};
+
+} // namespace function
+} // namespace lbug
@@ -32,6 +32,11 @@ public:
 
     BFSGraphManager* getBFSGraphManager() { return bfsGraphManager.get(); }
 
+    // Cost of a visited node of the pinned table.
+    double getCost(common::offset_t offset) {
+        return bfsGraphManager->getCurrentGraph()->getParentListHead(offset)->getCost();
+    }
+
     void initSource(common::nodeID_t sourceNodeID) override {
         sourceParent.setCost(0);
         bfsGraphManager->getCurrentGraph()->pinTableID(sourceNodeID.tableID);
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <optional>
+
+#include "common/enums/extend_direction.h"
+#include "common/types/internal_id_util.h"
+#include "gds_state.h"
+#include "graph/graph.h"
+#include "graph/landmark_index.h"
+
+namespace lbug {
+namespace processor {
+struct ExecutionContext;
+}
+namespace function {
+
+struct BFSPath {
+    struct Step {
+        common::nodeID_t nodeID;
+        // The edge between the previous node and this node.
+        common::relID_t edgeID;
+        // Whether the edge is stored from the previous node to this node.
+        bool isFwdEdge;
+    };
+
+    common::nodeID_t sourceNodeID;
+    std::vector<Step> steps;
+};
+
+// Breadth-first search from both a source and a destination node, which stops once the two
+// searches meet. Each round expands all nodes of the smaller of the two frontiers, so for a
+// single pair of nodes far fewer nodes are visited than by a BFS from the source only. The search
+// runs on the calling thread.
+// With a landmark index, pairs that are too far apart are rejected without searching, and nodes
+// that cannot be on a shortest path by their lower bound distance to the other root are pruned.
+class BidirectionalBFS {
+    struct Parent {
+        common::nodeID_t nodeID;
+        common::relID_t edgeID;
+        bool isFwdScan;
+        uint16_t depth;
+    };
+
+    struct Side {
+        common::ExtendDirection direction;
+        common::nodeID_t root;
+        bool isSrc;
+        common::node_id_map_t<Parent> parents;
+        std::vector<common::nodeID_t> frontier;
+        uint16_t depth = 0;
+
+        Side(common::ExtendDirection direction, common::nodeID_t root, bool isSrc);
+    };
+
+    struct ScanInfo {
+        std::unique_ptr<graph::NbrScanState> scanState;
+        bool isFwd;
+    };
+
+public:
+    // propertiesToScan should contain the edge ID if the path is tracked. The landmark index, if
+    // any, must be built over the graph in the direction of the searches.
+    BidirectionalBFS(graph::Graph* graph, std::vector<std::string> propertiesToScan,
+        const graph::LandmarkIndex* landmarkIndex = nullptr);
+
+    // Returns a shortest path with at most maxLength edges that follows edges in the given
+    // direction.
+    std::optional<BFSPath> search(processor::ExecutionContext* context,
+        common::nodeID_t sourceNodeID, common::nodeID_t dstNodeID,
+        common::ExtendDirection direction, uint16_t maxLength);
+
+    // Populates the state of a single shortest path computation from the path's source node, as
+    // if a BFS had reached the nodes on the path in their order. This allows reusing the output
+    // writers of the computation.
+    static void populateComputeState(const BFSPath& path, GDSComputeState& computeState,
+        bool trackParents);
+
+private:
+    // Expands all nodes in the frontier of a side. Returns the node met with the other side
+    // closest to the root of the other side, if any.
+    std::optional<common::nodeID_t> expand(Side& side, const Side& otherSide);
+
+    static BFSPath getPath(const Side& srcSide, const Side& dstSide, common::nodeID_t meetNodeID);
+
+private:
+    graph::Graph* graph;
+    bool trackEdgeIDs;
+    const graph::LandmarkIndex* landmarkIndex;
+    // Nodes whose distance from the source plus the lower bound of their distance to the
+    // destination, or vice versa, exceeds this length are not on a shortest path.
+    uint16_t maxPathLength = 0;
+    // Scans of neighbors for each bound node table.
+    common::table_id_map_t<std::vector<ScanInfo>> fwdScans;
+    common::table_id_map_t<std::vector<ScanInfo>> bwdScans;
+};
+
+} // namespace function
+} // namespace lbug
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <mutex>
+
+#include "gds_state.h"
+
+namespace lbug {
+namespace main {
+class ClientContext;
+}
+namespace function {
+
+// Returns the tentative cost of a node of the table pinned by beginFrontierCompute.
+using node_cost_func_t = std::function<double(common::offset_t)>;
+
+// Buckets of delta-stepping for weighted shortest paths. Bucket i holds the nodes whose tentative
+// cost is in [i * delta, (i + 1) * delta). Frontier rounds only relax the nodes of the current
+// bucket; nodes whose cost improves to a later bucket wait until all earlier buckets are settled.
+// Compared to relaxing every improved node in every round, this bounds how often a node is
+// relaxed again on graphs with a wide range of weights.
+// If delta is not given, it is set to the mean cost of the nodes reached in the first round,
+// i.e. roughly the mean weight of the edges of the source.
+class DeltaSteppingBuckets {
+public:
+    DeltaSteppingBuckets(double delta, node_cost_func_t getCost)
+        : delta{delta}, getCost{std::move(getCost)} {}
+
+    // Returns the nodes that should stay in the next frontier, and keeps the others in their
+    // buckets.
+    std::vector<common::nodeID_t> deferNodes(const std::vector<common::nodeID_t>& nodeIDs);
+
+    // Sets delta if it is picked automatically. Must be called after each round.
+    void finishRound();
+
+    // Moves the nodes of the next non-empty bucket to the next frontier. Returns false if all
+    // buckets are empty.
+    bool moveToNextBucket(GDSComputeState& computeState);
+
+    // Wraps the edge compute of the state if delta-stepping is enabled. It is disabled by a
+    // negative wsp_delta setting and for paths with an upper bound, because a frontier round does
+    // not extend paths by exactly one edge.
+    static void tryEnable(main::ClientContext* context, uint16_t upperBound,
+        node_cost_func_t getCost, GDSComputeState& computeState);
+
+private:
+    uint64_t getBucketIdx(double cost) const;
+
+private:
+    // 0 until it is picked automatically.
+    double delta;
+    node_cost_func_t getCost;
+    uint64_t curBucketIdx = 0;
+    double sumFirstRoundCosts = 0;
+    uint64_t numFirstRoundNodes = 0;
+    std::mutex mtx;
+    std::map<uint64_t, std::vector<common::nodeID_t>> buckets;
+};
+
+class DeltaSteppingEdgeCompute final : public EdgeCompute {
+public:
+    DeltaSteppingEdgeCompute(std::unique_ptr<EdgeCompute> edgeCompute,
+        DeltaSteppingBuckets* buckets)
+        : inner{std::move(edgeCompute)}, buckets{buckets} {}
+
+    std::vector<common::nodeID_t> edgeCompute(common::nodeID_t boundNodeID,
+        graph::NbrScanState::Chunk& chunk, bool fwdEdge) override {
+        return buckets->deferNodes(inner->edgeCompute(boundNodeID, chunk, fwdEdge));
+    }
+
+    void resetSingleThreadState() override { inner->resetSingleThreadState(); }
+
+    std::unique_ptr<EdgeCompute> copy() override {
+        return std::make_unique<DeltaSteppingEdgeCompute>(inner->copy(), buckets);
+    }
+
+private:
+    // Edge compute of the weighted shortest path algorithm.
+    std::unique_ptr<EdgeCompute> inner;
+    DeltaSteppingBuckets* buckets;
+};
+
+} // namespace function
+} // namespace lbug
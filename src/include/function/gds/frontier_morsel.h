@@ -35,6 +35,9 @@ public:
     explicit FrontierMorselDispatcher(uint64_t maxThreads);
 
     void init(common::offset_t _maxOffset);
+    // Dispatches morsels of `_morselSize` offsets, e.g. 1 when each offset is a unit of work as
+    // large as a BFS.
+    void init(common::offset_t _maxOffset, uint64_t _morselSize);
 
     bool getNextRangeMorsel(FrontierMorsel& frontierMorsel);
 
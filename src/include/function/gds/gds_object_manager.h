@@ -49,7 +49,7 @@ public:
     }
 
     void allocate(const common::offset_t size, storage::MemoryManager* mm, bool initializeToZero) {
-        allocation = mm->allocateBuffer(initializeToZero, size * sizeof(T));
+        allocation = mm->allocateIntermediateBuffer(initializeToZero, size * sizeof(T));
         data = std::span<T>(reinterpret_cast<T*>(allocation->getData()), size);
         this->size = size;
     }
@@ -189,7 +189,7 @@ class GDSDenseObjectManager {
 public:
     void allocate(common::table_id_t tableID, common::offset_t maxOffset,
         storage::MemoryManager* mm) {
-        auto buffer = mm->allocateBuffer(false, maxOffset * sizeof(T));
+        auto buffer = mm->allocateIntermediateBuffer(false, maxOffset * sizeof(T));
         bufferPerTable.insert({tableID, std::move(buffer)});
     }
 
@@ -6,10 +6,14 @@
 namespace lbug {
 namespace function {
 
+class DeltaSteppingBuckets;
+
 struct GDSComputeState {
     std::shared_ptr<FrontierPair> frontierPair = nullptr;
     std::unique_ptr<EdgeCompute> edgeCompute = nullptr;
     std::unique_ptr<GDSAuxiliaryState> auxiliaryState = nullptr;
+    // Only set for weighted shortest paths computed with delta-stepping.
+    std::shared_ptr<DeltaSteppingBuckets> deltaSteppingBuckets = nullptr;
 
     GDSComputeState(std::shared_ptr<FrontierPair> frontierPair,
         std::unique_ptr<EdgeCompute> edgeCompute, std::unique_ptr<GDSAuxiliaryState> auxiliaryState)
@@ -17,6 +17,10 @@ public:
     static void runFTSEdgeCompute(processor::ExecutionContext* context, GDSComputeState& compState,
         graph::Graph* graph, common::ExtendDirection extendDirection,
         const std::vector<std::string>& propertiesToScan);
+    // Run a single iteration of edge compute without property scan. Used by algorithms that
+    // process the next frontier themselves between iterations.
+    static void runEdgeComputeIteration(processor::ExecutionContext* context,
+        GDSComputeState& compState, graph::Graph* graph, common::ExtendDirection extendDirection);
     // Run edge compute for recursive join.
     static void runRecursiveJoinEdgeCompute(processor::ExecutionContext* context,
         GDSComputeState& compState, graph::Graph* graph, common::ExtendDirection extendDirection,
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "common/enums/extend_direction.h"
+#include "gds_state.h"
+
+namespace lbug {
+namespace function {
+
+// Receives the nodes reached in a level of a multi-source BFS. Each thread writes to its own copy.
+class MultiSourceBFSOutputWriter {
+public:
+    virtual ~MultiSourceBFSOutputWriter() = default;
+
+    // Bit i of sourceMask is set if the node is reached from the i-th source of the batch.
+    virtual void write(common::nodeID_t dstNodeID, uint64_t sourceMask, uint16_t length) = 0;
+
+    virtual std::unique_ptr<MultiSourceBFSOutputWriter> copy() = 0;
+};
+
+// Bitsets of a multi-source BFS with one bit per source of a batch. For each node, seen holds the
+// sources that have reached it, frontier the sources it was reached from in the last level and
+// next the sources reaching it in the current level.
+class MultiSourceBFSState : public GDSAuxiliaryState {
+public:
+    MultiSourceBFSState(processor::ExecutionContext* context, graph::Graph* graph);
+
+    void pinBoundTableID(common::table_id_t tableID) { boundFrontier = frontier.getData(tableID); }
+    void pinNbrTableID(common::table_id_t tableID) {
+        nbrSeen = seen.getData(tableID);
+        nbrNext = next.getData(tableID);
+    }
+    // Pins all bitsets to the table, see MultiSourceBFS::finishLevel.
+    void pinTableID(common::table_id_t tableID) {
+        pinBoundTableID(tableID);
+        pinNbrTableID(tableID);
+    }
+
+    void beginFrontierCompute(common::table_id_t fromTableID,
+        common::table_id_t toTableID) override {
+        pinBoundTableID(fromTableID);
+        pinNbrTableID(toTableID);
+    }
+
+    void switchToDense(processor::ExecutionContext*, graph::Graph*) override {
+        // Do nothing. The bitsets are always dense.
+    }
+
+    void resetNode(common::offset_t offset) {
+        boundFrontier[offset].store(0, std::memory_order_relaxed);
+        nbrSeen[offset].store(0, std::memory_order_relaxed);
+        nbrNext[offset].store(0, std::memory_order_relaxed);
+    }
+
+    uint64_t getFrontier(common::offset_t offset) const {
+        return boundFrontier[offset].load(std::memory_order_relaxed);
+    }
+    void setFrontier(common::offset_t offset, uint64_t sourceMask) {
+        boundFrontier[offset].store(sourceMask, std::memory_order_relaxed);
+    }
+    uint64_t getSeen(common::offset_t offset) const {
+        return nbrSeen[offset].load(std::memory_order_relaxed);
+    }
+    void addSeen(common::offset_t offset, uint64_t sourceMask) {
+        nbrSeen[offset].fetch_or(sourceMask, std::memory_order_relaxed);
+    }
+    void addNext(common::offset_t offset, uint64_t sourceMask) {
+        nbrNext[offset].fetch_or(sourceMask, std::memory_order_relaxed);
+    }
+    uint64_t takeNext(common::offset_t offset) {
+        return nbrNext[offset].exchange(0, std::memory_order_relaxed);
+    }
+
+private:
+    GDSDenseObjectManager<std::atomic<uint64_t>> seen;
+    GDSDenseObjectManager<std::atomic<uint64_t>> frontier;
+    GDSDenseObjectManager<std::atomic<uint64_t>> next;
+    std::atomic<uint64_t>* boundFrontier = nullptr;
+    std::atomic<uint64_t>* nbrSeen = nullptr;
+    std::atomic<uint64_t>* nbrNext = nullptr;
+};
+
+// Multi-source BFS (MS-BFS) computing shortest path lengths from up to 64 sources at once. A node
+// is in the frontier if any source reached it in the last level, so each edge is scanned once per
+// level for all sources of a batch instead of once per source. Frontier rounds run as regular
+// frontier tasks over a dense frontier pair; a vertex compute after each level moves the newly
+// reached sources of every node into its frontier bitset and writes the new destinations.
+class MultiSourceBFS {
+public:
+    static constexpr uint64_t MAX_NUM_SOURCES = 64;
+
+    MultiSourceBFS(processor::ExecutionContext* context, graph::Graph* graph);
+
+    // Writes the shortest path length from each source to each node it reaches in at most
+    // upperBound levels.
+    void run(processor::ExecutionContext* context, const std::vector<common::nodeID_t>& sources,
+        common::ExtendDirection extendDirection, uint16_t upperBound,
+        MultiSourceBFSOutputWriter& writer);
+
+private:
+    // Marks the nodes reached by new sources in the level as active in the next frontier.
+    void finishLevel(processor::ExecutionContext* context, MultiSourceBFSOutputWriter& writer);
+
+private:
+    graph::Graph* graph;
+    std::unique_ptr<GDSComputeState> computeState;
+    MultiSourceBFSState* state;
+};
+
+} // namespace function
+} // namespace lbug
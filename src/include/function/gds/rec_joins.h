@@ -26,6 +26,9 @@ struct RJBindData {
 
     bool flipPath = false; // See PathsOutputWriterInfo::flipPath for comments.
     bool writePath = true;
+    // Search from both the input and the output node if both are bound to a single node. Only set
+    // for single shortest paths, see LogicalRecursiveExtend::canSearchBidirectionally.
+    bool bidirectional = false;
 
     std::shared_ptr<binder::Expression> directionExpr = nullptr;
     std::shared_ptr<binder::Expression> lengthExpr = nullptr;
@@ -128,6 +128,12 @@ struct BMInfoFunction final {
     static function_set getFunctionSet();
 };
 
+struct PlanCacheInfoFunction final {
+    static constexpr const char* name = "PLAN_CACHE_INFO";
+
+    static function_set getFunctionSet();
+};
+
 struct FileInfoFunction final {
     static constexpr const char* name = "FILE_INFO";
 
@@ -11,6 +11,14 @@ struct ClearWarningsFunction {
     static function_set getFunctionSet();
 };
 
+// Rebuilds the statistics of a node table, i.e. its cardinality and the number of distinct values,
+// most common values and histogram of each column, from a full scan of the table.
+struct AnalyzeFunction {
+    static constexpr const char* name = "ANALYZE";
+
+    static function_set getFunctionSet();
+};
+
 struct ProjectGraphNativeFunction {
     static constexpr const char* name = "PROJECT_GRAPH";
 
@@ -25,6 +25,8 @@ struct NativeGraphEntryTableInfo {
 struct LBUG_API NativeGraphEntry {
     std::vector<NativeGraphEntryTableInfo> nodeInfos;
     std::vector<NativeGraphEntryTableInfo> relInfos;
+    // Name of the projected graph in GraphEntrySet. Empty if the graph is not projected by name.
+    std::string name;
 
     NativeGraphEntry() = default;
     NativeGraphEntry(std::vector<catalog::TableCatalogEntry*> nodeEntries,
@@ -43,7 +45,7 @@ struct LBUG_API NativeGraphEntry {
 
 private:
     NativeGraphEntry(const NativeGraphEntry& other)
-        : nodeInfos{other.nodeInfos}, relInfos{other.relInfos} {}
+        : nodeInfos{other.nodeInfos}, relInfos{other.relInfos}, name{other.name} {}
 };
 
 } // namespace graph
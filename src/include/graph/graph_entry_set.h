@@ -4,6 +4,8 @@
 #include <unordered_map>
 
 #include "common/assert.h"
+#include "common/enums/extend_direction.h"
+#include "common/types/types.h"
 #include "parsed_graph_entry.h"
 
 namespace lbug {
@@ -12,6 +14,9 @@ class ClientContext;
 }
 namespace graph {
 
+class InMemGraphData;
+class LandmarkIndex;
+
 class GraphEntrySet {
 public:
     void validateGraphNotExist(const std::string& name) const;
@@ -25,7 +30,20 @@ public:
     void addGraph(const std::string& name, std::unique_ptr<ParsedGraphEntry> entry) {
         nameToEntry.insert({name, std::move(entry)});
     }
-    void dropGraph(const std::string& name) { nameToEntry.erase(name); }
+    void dropGraph(const std::string& name) {
+        nameToEntry.erase(name);
+        nameToCachedGraph.erase(name);
+    }
+
+    // Returns the in-memory copy of the graph for transactions reading the snapshot at startTS.
+    // A copy of an older snapshot is replaced, i.e. any committed write invalidates the cache.
+    std::shared_ptr<InMemGraphData> getCachedGraph(const std::string& name,
+        common::transaction_t startTS);
+
+    // Returns the landmark index with the given key, see LandmarkIndex::getKey, for transactions
+    // reading the snapshot at startTS. The returned index is not built yet if it is new.
+    std::shared_ptr<LandmarkIndex> getLandmarkIndex(const std::string& key,
+        common::ExtendDirection direction, common::transaction_t startTS);
 
     const std::unordered_map<std::string, std::unique_ptr<ParsedGraphEntry>>&
     getNameToEntryMap() const {
@@ -36,6 +54,8 @@ public:
 
 private:
     std::unordered_map<std::string, std::unique_ptr<ParsedGraphEntry>> nameToEntry;
+    std::unordered_map<std::string, std::shared_ptr<InMemGraphData>> nameToCachedGraph;
+    std::unordered_map<std::string, std::shared_ptr<LandmarkIndex>> keyToLandmarkIndex;
 };
 
 } // namespace graph
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+
+#include "on_disk_graph.h"
+
+namespace lbug {
+namespace graph {
+
+struct InMemCSRProperty {
+    std::string name;
+    common::LogicalType type;
+    uint32_t numBytesPerValue;
+    std::vector<uint8_t> values;
+    std::vector<bool> nulls;
+
+    InMemCSRProperty(std::string name, common::LogicalType type, uint32_t numBytesPerValue)
+        : name{std::move(name)}, type{std::move(type)}, numBytesPerValue{numBytesPerValue} {}
+
+    void append(const common::ValueVector& vector, common::sel_t pos);
+    void copyTo(common::ValueVector& vector, uint64_t startPos, uint64_t numValues) const;
+};
+
+// Neighbours of one direction of a rel table in compressed sparse row (CSR) format. The neighbours
+// of bound node i are at positions [csrOffsets[i], csrOffsets[i + 1]) of nbrOffsets and of each
+// property.
+struct InMemCSR {
+    common::table_id_t nbrTableID;
+    std::vector<uint64_t> csrOffsets;
+    std::vector<common::offset_t> nbrOffsets;
+    // Fixed-size rel properties, e.g. weights, that have been requested by scans so far.
+    std::vector<InMemCSRProperty> properties;
+
+    explicit InMemCSR(common::table_id_t nbrTableID) : nbrTableID{nbrTableID} {}
+
+    bool hasProperties(const std::vector<std::string>& propertyNames) const;
+    const InMemCSRProperty& getProperty(const std::string& propertyName) const;
+};
+
+// In-memory copy of the rel tables of a projected graph. It is built lazily per rel table and
+// direction by the first scan, and shared by all queries over the graph until a write transaction
+// commits, see GraphEntrySet::getCachedGraph.
+class InMemGraphData {
+public:
+    explicit InMemGraphData(common::transaction_t snapshotTS) : snapshotTS{snapshotTS} {}
+
+    common::transaction_t getSnapshotTS() const { return snapshotTS; }
+
+    // Returns the CSR of the rel table in the given direction with at least the given properties.
+    // Returns nullptr if one of the properties does not have a fixed size.
+    std::shared_ptr<const InMemCSR> getCSR(transaction::Transaction* transaction,
+        OnDiskGraph& graph, const GraphRelInfo& relInfo, common::RelDataDirection direction,
+        const std::vector<std::string>& propertyNames);
+
+private:
+    static std::shared_ptr<const InMemCSR> buildCSR(transaction::Transaction* transaction,
+        OnDiskGraph& graph, const GraphRelInfo& relInfo, common::RelDataDirection direction,
+        const std::vector<std::string>& propertyNames);
+
+private:
+    common::transaction_t snapshotTS;
+    std::mutex mtx;
+    std::map<std::pair<common::oid_t, common::RelDataDirection>, std::shared_ptr<const InMemCSR>>
+        csrs;
+};
+
+class InMemGraphNbrScanState final : public NbrScanState {
+public:
+    InMemGraphNbrScanState(storage::MemoryManager* mm, std::shared_ptr<const InMemCSR> fwdCSR,
+        std::shared_ptr<const InMemCSR> bwdCSR, const std::vector<std::string>& relProperties);
+
+    Chunk getChunk() override {
+        return createChunk(nbrNodeIDs, selVector, std::span(propertyVectors));
+    }
+    bool next() override;
+
+    void startScan(common::RelDataDirection direction, common::offset_t boundOffset);
+
+private:
+    std::shared_ptr<const InMemCSR> fwdCSR;
+    std::shared_ptr<const InMemCSR> bwdCSR;
+    std::vector<std::string> relProperties;
+    std::vector<common::nodeID_t> nbrNodeIDs;
+    common::SelectionVector selVector;
+    std::vector<std::shared_ptr<common::ValueVector>> propertyVectors;
+
+    const InMemCSR* currentCSR = nullptr;
+    uint64_t nextPos = 0;
+    uint64_t endPos = 0;
+};
+
+// Projected graph whose rel tables are scanned from a cached in-memory CSR instead of the buffer
+// manager. Node scans and rel scans of properties without a fixed size go to the on-disk graph.
+class LBUG_API InMemGraph final : public Graph {
+public:
+    InMemGraph(main::ClientContext* context, NativeGraphEntry entry,
+        std::shared_ptr<InMemGraphData> data);
+
+    NativeGraphEntry* getGraphEntry() override { return onDiskGraph.getGraphEntry(); }
+
+    std::vector<common::table_id_t> getNodeTableIDs() const override {
+        return onDiskGraph.getNodeTableIDs();
+    }
+
+    common::table_id_map_t<common::offset_t> getMaxOffsetMap(
+        transaction::Transaction* transaction) const override {
+        return onDiskGraph.getMaxOffsetMap(transaction);
+    }
+
+    common::offset_t getMaxOffset(transaction::Transaction* transaction,
+        common::table_id_t id) const override {
+        return onDiskGraph.getMaxOffset(transaction, id);
+    }
+
+    common::offset_t getNumNodes(transaction::Transaction* transaction) const override {
+        return onDiskGraph.getNumNodes(transaction);
+    }
+
+    std::vector<GraphRelInfo> getRelInfos(common::table_id_t srcTableID) override {
+        return onDiskGraph.getRelInfos(srcTableID);
+    }
+
+    std::unique_ptr<NbrScanState> prepareRelScan(const catalog::TableCatalogEntry& entry,
+        common::oid_t relTableID, common::table_id_t nbrTableID,
+        std::vector<std::string> relProperties, bool randomLookup = true) override;
+
+    EdgeIterator scanFwd(common::nodeID_t nodeID, NbrScanState& state) override;
+    EdgeIterator scanBwd(common::nodeID_t nodeID, NbrScanState& state) override;
+
+    std::unique_ptr<VertexScanState> prepareVertexScan(catalog::TableCatalogEntry* tableEntry,
+        const std::vector<std::string>& propertiesToScan) override {
+        return onDiskGraph.prepareVertexScan(tableEntry, propertiesToScan);
+    }
+    VertexIterator scanVertices(common::offset_t beginOffset, common::offset_t endOffsetExclusive,
+        VertexScanState& state) override {
+        return onDiskGraph.scanVertices(beginOffset, endOffsetExclusive, state);
+    }
+
+private:
+    main::ClientContext* context;
+    OnDiskGraph onDiskGraph;
+    std::shared_ptr<InMemGraphData> data;
+    std::unordered_map<common::oid_t, GraphRelInfo> relTableIDToRelInfo;
+};
+
+} // namespace graph
+} // namespace lbug
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "common/enums/extend_direction.h"
+#include "common/types/types.h"
+
+namespace lbug {
+namespace processor {
+struct ExecutionContext;
+}
+namespace graph {
+
+class Graph;
+
+// Distances between a few landmark nodes and every node of a graph. By the triangle inequality,
+// for any landmark l and nodes s and t:
+//   d(l, t) - d(l, s) <= d(s, t)   d(s, l) - d(t, l) <= d(s, t)   d(s, t) <= d(s, l) + d(l, t)
+// so the index gives lower and upper bounds on the distance between any two nodes in
+// O(#landmarks), and proves that t is unreachable from s if l reaches s but not t, or if t reaches
+// l but s does not. Landmarks are the nodes of highest degree, which lie on many shortest paths.
+//
+// The index covers all node and rel tables of a graph without predicates, for one extend
+// direction. It is built in parallel, one BFS per landmark and direction, and cached per graph
+// until a write transaction commits, see GraphEntrySet::getLandmarkIndex.
+class LandmarkIndex {
+public:
+    static constexpr uint16_t UNREACHED = UINT16_MAX;
+
+    struct Bounds {
+        // UNREACHED if there is no path.
+        uint16_t lower;
+        // UNREACHED if no landmark is on a path.
+        uint16_t upper;
+    };
+
+    LandmarkIndex(common::transaction_t snapshotTS, common::ExtendDirection direction)
+        : snapshotTS{snapshotTS}, direction{direction} {}
+
+    common::transaction_t getSnapshotTS() const { return snapshotTS; }
+    bool isBuilt() const { return built; }
+
+    void build(processor::ExecutionContext* context, Graph* graph, uint64_t numLandmarks);
+
+    // Bounds on the length of the shortest path from src to dst.
+    Bounds getBounds(common::nodeID_t src, common::nodeID_t dst) const;
+    uint16_t getLowerBound(common::nodeID_t src, common::nodeID_t dst) const;
+
+    // Returns the key of the index of a graph in the given direction, or an empty string if the
+    // graph has predicates, which the index does not apply.
+    static std::string getKey(Graph* graph, common::ExtendDirection direction);
+
+private:
+    uint64_t getID(common::nodeID_t nodeID) const {
+        return tableStartIDs.at(nodeID.tableID) + nodeID.offset;
+    }
+
+    template<bool COMPUTE_UPPER>
+    Bounds computeBounds(common::nodeID_t src, common::nodeID_t dst) const;
+
+private:
+    common::transaction_t snapshotTS;
+    common::ExtendDirection direction;
+    bool built = false;
+    common::table_id_map_t<uint64_t> tableStartIDs;
+    uint64_t numNodes = 0;
+    uint64_t numLandmarks = 0;
+    // fromLandmark[l * numNodes + id] is the distance from landmark l to node id following edges
+    // in the index direction, and toLandmark[l * numNodes + id] the distance from node id to
+    // landmark l. Both are the same for undirected (BOTH) graphs.
+    std::vector<uint16_t> fromLandmark;
+    std::vector<uint16_t> toLandmark;
+};
+
+} // namespace graph
+} // namespace lbug
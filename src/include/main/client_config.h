@@ -4,6 +4,7 @@
 #include <string>
 
 #include "common/enums/path_semantic.h"
+#include "common/enums/task_priority.h"
 
 namespace lbug {
 namespace main {
@@ -13,6 +14,10 @@ struct ClientConfigDefault {
     static constexpr uint64_t TIMEOUT_IN_MS = 0;
     static constexpr uint32_t VAR_LENGTH_MAX_DEPTH = 30;
     static constexpr uint64_t SPARSE_FRONTIER_THRESHOLD = 1000;
+    // 0 means the bucket width of delta-stepping is picked per source node by default.
+    static constexpr double WSP_DELTA = 0;
+    static constexpr bool CACHE_PROJECTED_GRAPHS = false;
+    static constexpr uint64_t SHORTEST_PATH_LANDMARKS = 0;
     static constexpr bool ENABLE_SEMI_MASK = true;
     static constexpr bool ENABLE_ZONE_MAP = true;
     static constexpr bool ENABLE_PROGRESS_BAR = false;
@@ -23,6 +28,13 @@ struct ClientConfigDefault {
     static constexpr uint64_t WARNING_LIMIT = 8 * 1024;
     static constexpr bool ENABLE_PLAN_OPTIMIZER = true;
     static constexpr bool ENABLE_INTERNAL_CATALOG = false;
+    static constexpr common::TaskPriority QUERY_PRIORITY = common::TaskPriority::NORMAL;
+    // 0 means the memory of a query is only bounded by the buffer pool by default.
+    static constexpr uint64_t QUERY_MEMORY_LIMIT = 0;
+    static constexpr uint64_t JOIN_ORDER_DP_THRESHOLD = 12;
+    // 0 means queries are never re-planned based on observed cardinalities by default.
+    static constexpr uint64_t REOPTIMIZATION_THRESHOLD = 0;
+    static constexpr bool ENABLE_PLAN_CACHE = true;
 };
 
 struct ClientConfig {
@@ -36,12 +48,26 @@ struct ClientConfig {
     bool enableZoneMap = ClientConfigDefault::ENABLE_ZONE_MAP;
     // Number of threads for execution.
     uint64_t numThreads = 1;
+    // Priority class of the tasks scheduled by this client, either HIGH, NORMAL or LOW. Waiting
+    // tasks of lower classes are promoted over time, see TaskScheduler.
+    common::TaskPriority queryPriority = ClientConfigDefault::QUERY_PRIORITY;
+    // Maximum intermediate memory (bytes) a single query can allocate.
+    uint64_t queryMemoryLimit = ClientConfigDefault::QUERY_MEMORY_LIMIT;
     // Timeout (milliseconds).
     uint64_t timeoutInMS = ClientConfigDefault::TIMEOUT_IN_MS;
     // Variable length maximum depth.
     uint32_t varLengthMaxDepth = ClientConfigDefault::VAR_LENGTH_MAX_DEPTH;
     // Threshold determines when to switch from sparse frontier to dense frontier
     uint64_t sparseFrontierThreshold = ClientConfigDefault::SPARSE_FRONTIER_THRESHOLD;
+    // Bucket width of delta-stepping for weighted shortest paths. Negative values disable
+    // delta-stepping, see DeltaSteppingBuckets.
+    double wspDelta = ClientConfigDefault::WSP_DELTA;
+    // If graph algorithms over a projected graph keep an in-memory copy of its rel tables for
+    // later calls, see InMemGraph.
+    bool cacheProjectedGraphs = ClientConfigDefault::CACHE_PROJECTED_GRAPHS;
+    // Number of landmarks of the distance index used by single-pair shortest path queries. 0
+    // disables the index, see LandmarkIndex.
+    uint64_t shortestPathLandmarks = ClientConfigDefault::SHORTEST_PATH_LANDMARKS;
     // If using progress bar.
     bool enableProgressBar = ClientConfigDefault::ENABLE_PROGRESS_BAR;
     // time before displaying progress bar
@@ -57,6 +83,14 @@ struct ClientConfig {
     bool enablePlanOptimizer = ClientConfigDefault::ENABLE_PLAN_OPTIMIZER;
     // If use internal catalog during binding
     bool enableInternalCatalog = ClientConfigDefault::ENABLE_INTERNAL_CATALOG;
+    // Query graphs with more nodes and rels than this are join ordered greedily instead of with
+    // dynamic programming, to bound planning time.
+    uint64_t joinOrderDPThreshold = ClientConfigDefault::JOIN_ORDER_DP_THRESHOLD;
+    // A read-only query is re-planned if a hash join build materializes more than this many times
+    // more or fewer tuples than estimated. 0 disables re-optimization.
+    uint64_t reoptimizationThreshold = ClientConfigDefault::REOPTIMIZATION_THRESHOLD;
+    // If ad-hoc queries differing only in their literals share a cached statement.
+    bool enablePlanCache = ClientConfigDefault::ENABLE_PLAN_CACHE;
 };
 
 } // namespace main
@@ -34,13 +34,19 @@ namespace graph {
 class GraphEntrySet;
 }
 
+namespace planner {
+class CardinalityFeedback;
+} // namespace planner
+
 namespace storage {
 class StorageManager;
-}
+class QueryMemoryTracker;
+} // namespace storage
 
 namespace processor {
 class ImportDB;
 class WarningContext;
+class StreamingResultSharedState;
 } // namespace processor
 
 namespace transaction {
@@ -61,6 +67,8 @@ struct ActiveQuery {
     explicit ActiveQuery();
     std::atomic<bool> interrupted;
     common::Timer timer;
+    // Accounts for the intermediate memory of the query, see QueryMemoryTracker.
+    std::shared_ptr<storage::QueryMemoryTracker> memoryTracker;
 
     void reset();
 };
@@ -79,6 +87,7 @@ class LBUG_API ClientContext {
     friend class common::RandomEngine;
     friend class common::ProgressBar;
     friend class graph::GraphEntrySet;
+    friend class planner::CardinalityFeedback;
 
 public:
     explicit ClientContext(Database* database);
@@ -102,6 +111,9 @@ public:
     void startTimer();
     uint64_t getTimeoutRemainingInMS() const;
     void resetActiveQuery() { activeQuery.reset(); }
+    const std::shared_ptr<storage::QueryMemoryTracker>& getQueryMemoryTracker() const {
+        return activeQuery.memoryTracker;
+    }
 
     // Parallelism
     void setMaxNumThreadForExec(uint64_t numThreads);
@@ -150,14 +162,22 @@ public:
     struct QueryConfig {
         QueryResultType resultType;
         common::ArrowResultConfig arrowConfig;
+        // Queue the result collector hands batches to if resultType is STREAM.
+        std::shared_ptr<processor::StreamingResultSharedState> streamingState;
 
         QueryConfig() : resultType{QueryResultType::FTABLE}, arrowConfig{} {}
         QueryConfig(QueryResultType resultType, common::ArrowResultConfig arrowConfig)
             : resultType{resultType}, arrowConfig{arrowConfig} {}
+        explicit QueryConfig(std::shared_ptr<processor::StreamingResultSharedState> streamingState)
+            : resultType{QueryResultType::STREAM}, arrowConfig{},
+              streamingState{std::move(streamingState)} {}
     };
 
     std::unique_ptr<QueryResult> query(std::string_view queryStatement,
         std::optional<uint64_t> queryID = std::nullopt, QueryConfig config = {});
+    // Executes the query in the background and returns a StreamingQueryResult as soon as the query
+    // is compiled. Only single statements are supported.
+    std::unique_ptr<QueryResult> queryAsStream(std::string_view queryStatement);
     std::unique_ptr<PreparedStatement> prepareWithParams(std::string_view query,
         std::unordered_map<std::string, std::unique_ptr<common::Value>> inputParams = {});
     std::unique_ptr<QueryResult> executeWithParams(PreparedStatement* preparedStatement,
@@ -212,11 +232,25 @@ private:
     std::unique_ptr<QueryResult> executeNoLock(PreparedStatement* preparedStatement,
         CachedPreparedStatement* cachedPreparedStatement,
         std::optional<uint64_t> queryID = std::nullopt, QueryConfig config = {});
+    // Executes the plan once. Throws ReoptimizationException if the query should be re-planned.
+    std::unique_ptr<QueryResult> executePlanNoLock(PreparedStatement* preparedStatement,
+        CachedPreparedStatement* cachedPreparedStatement, std::optional<uint64_t>& queryID,
+        const QueryConfig& config);
+    bool canReoptimize(const PreparedStatement& preparedStatement,
+        const QueryConfig& config) const;
     std::unique_ptr<QueryResult> queryNoLock(std::string_view query,
         std::optional<uint64_t> queryID = std::nullopt, QueryConfig config = {});
+    // Runs the query with its literals replaced by parameters, reusing the parsed statement of an
+    // earlier query of the same shape. Returns nullptr if the query cannot go through the plan
+    // cache, in which case it should run as usual.
+    std::unique_ptr<QueryResult> queryWithPlanCacheNoLock(std::string_view query,
+        std::optional<uint64_t> queryID, QueryConfig config);
 
     bool canExecuteWriteQuery() const;
 
+    // A streaming query keeps the connection busy until its result is drained or closed.
+    bool hasOpenStreamingResult() const;
+
     std::unique_ptr<QueryResult> handleFailedExecution(std::optional<uint64_t> queryID,
         const std::exception& e) const;
 
@@ -245,6 +279,10 @@ private:
     std::unique_ptr<processor::WarningContext> warningContext;
     // Graph entries
     std::unique_ptr<graph::GraphEntrySet> graphEntrySet;
+    // Cardinalities observed while executing the current query.
+    std::unique_ptr<planner::CardinalityFeedback> cardinalityFeedback;
+    // Result queue of the last streaming query.
+    std::weak_ptr<processor::StreamingResultSharedState> openStreamingState;
     // Whether the query can access internal tables/sequences or not.
     bool useInternalCatalogEntry_ = false;
     // Whether the transaction should be rolled back on destruction. If the parent database is
@@ -49,6 +49,16 @@ public:
 
     LBUG_API std::unique_ptr<QueryResult> queryAsArrow(std::string_view query, int64_t chunkSize);
 
+    /**
+     * @brief Executes the given query in the background and returns its result as a stream. Tuples
+     * can be read with getNext() while the query is still running, and execution pauses while the
+     * consumer is not reading. The connection cannot execute other queries until the result is
+     * fully read or destroyed.
+     * @param query The query to execute. Must be a single statement.
+     * @return the streaming result of the query.
+     */
+    LBUG_API std::unique_ptr<QueryResult> queryAsStream(std::string_view query);
+
     /**
      * @brief Prepares the given query and returns the prepared statement.
      * @param query The query to prepare.
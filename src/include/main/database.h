@@ -32,6 +32,7 @@ class StorageExtension;
 
 namespace main {
 class DatabaseManager;
+class PlanCache;
 /**
  * @brief Stores runtime configuration for creating or opening a Database
  */
@@ -153,6 +154,8 @@ public:
 
     DatabaseManager* getDatabaseManager() { return databaseManager.get(); }
 
+    PlanCache* getPlanCache() { return planCache.get(); }
+
     storage::MemoryManager* getMemoryManager() { return memoryManager.get(); }
 
     processor::QueryProcessor* getQueryProcessor() { return queryProcessor.get(); }
@@ -191,6 +194,7 @@ private:
     std::unique_ptr<transaction::TransactionManager> transactionManager;
     std::unique_ptr<common::FileInfo> lockFile;
     std::unique_ptr<DatabaseManager> databaseManager;
+    std::unique_ptr<PlanCache> planCache;
     std::unique_ptr<extension::ExtensionManager> extensionManager;
     QueryIDGenerator queryIDGenerator;
     std::shared_ptr<common::DatabaseLifeCycleManager> dbLifeCycleManager;
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "common/types/value/value.h"
+
+namespace lbug {
+namespace parser {
+class Statement;
+} // namespace parser
+
+namespace main {
+
+class ClientContext;
+
+// A query whose literals have been replaced by parameters, e.g.
+// MATCH (a:person) WHERE a.age > 30 RETURN a.name
+// becomes
+// MATCH (a:person) WHERE a.age > $__lit0 RETURN a.name
+// with parameter __lit0 set to 30. Only literals whose replacement by a parameter is known to bind
+// to the same expression are replaced: the operands of comparisons, the elements of IN lists and
+// the values of property maps.
+struct NormalizedQuery {
+    static constexpr const char* PARAMETER_PREFIX = "__lit";
+
+    std::string text;
+    std::unordered_map<std::string, std::shared_ptr<common::Value>> parameters;
+
+    // Returns nullopt if the query cannot be normalized, e.g. because it already has parameters.
+    static std::optional<NormalizedQuery> normalize(std::string_view query);
+};
+
+// Caches the parsed statements of normalized queries, so that ad-hoc queries of the same shape but
+// with different literals skip parsing. Statements are keyed by their normalized text and the
+// version of the catalog they were checked against. Like explicitly prepared statements, cached
+// statements are bound and planned again for every execution, because the binder evaluates table
+// functions and constant expressions eagerly.
+// Queries that turn out not to be cacheable, e.g. because a literal appears in a result column
+// name, are cached as well, without a statement, so they are checked only once.
+class PlanCache {
+public:
+    static constexpr uint64_t CAPACITY = 1024;
+
+    // Returns nullopt if the key is not cached, and a null statement if it is not cacheable.
+    std::optional<std::shared_ptr<parser::Statement>> lookup(const std::string& key);
+    void insert(const std::string& key, std::shared_ptr<parser::Statement> statement);
+
+    uint64_t getNumEntries() const;
+    uint64_t getNumHits() const { return numHits.load(); }
+    uint64_t getNumMisses() const { return numMisses.load(); }
+    void incrementNumHits() { numHits++; }
+    void incrementNumMisses() { numMisses++; }
+
+    static std::string getKey(const ClientContext& context, const NormalizedQuery& query);
+
+    static PlanCache* Get(const ClientContext& context);
+
+private:
+    using entry_t = std::pair<std::string, std::shared_ptr<parser::Statement>>;
+
+    mutable std::mutex mtx;
+    // Entries in least recently used order, the most recently used one at the front.
+    std::list<entry_t> entries;
+    std::unordered_map<std::string, std::list<entry_t>::iterator> keyToEntry;
+    std::atomic<uint64_t> numHits = 0;
+    std::atomic<uint64_t> numMisses = 0;
+};
+
+} // namespace main
+} // namespace lbug
@@ -17,6 +17,7 @@ namespace main {
 enum class QueryResultType {
     FTABLE = 0,
     ARROW = 1,
+    STREAM = 2,
 };
 
 /**
@@ -117,6 +118,18 @@ public:
      * If converting to another arrow type, this is usually handled automatically.
      */
     LBUG_API virtual std::unique_ptr<ArrowArray> getNextArrowChunk(int64_t chunkSize) = 0;
+    /**
+     * @brief Returns the remaining tuples of the query result as an arrow C stream.
+     * @param chunkSize number of tuples in each array of the stream. Must match the chunk size of
+     * queryAsArrow for results returned by it.
+     * @return An ArrowArrayStream whose arrays are the chunks returned by getNextArrowChunk.
+     *
+     * For results of queryAsArrow, the arrays are the record batches produced by the workers
+     * executing the query and are handed over without being copied. The stream reads from this
+     * query result, which must outlive it. It is the caller's responsibility to call the release
+     * function of the stream.
+     */
+    LBUG_API std::unique_ptr<ArrowArrayStream> getArrowArrayStream(int64_t chunkSize);
 
     QueryResultType getType() const { return type; }
 
@@ -127,6 +140,7 @@ public:
     std::unique_ptr<QueryResult> moveNextResult();
 
     void setQuerySummary(std::unique_ptr<QuerySummary> summary);
+    std::unique_ptr<QuerySummary> moveQuerySummary();
 
     void setDBLifeCycleManager(
         std::shared_ptr<common::DatabaseLifeCycleManager> dbLifeCycleManager);
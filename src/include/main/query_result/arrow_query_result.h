@@ -14,6 +14,7 @@ public:
     ArrowQueryResult(std::vector<std::string> columnNames,
         std::vector<common::LogicalType> columnTypes, processor::FactorizedTable& table,
         int64_t chunkSize);
+    ~ArrowQueryResult() override;
 
     uint64_t getNumTuples() const override;
 
@@ -27,6 +28,7 @@ public:
 
     bool hasNextArrowChunk() override;
 
+    // Moves the next array out of the result without copying its buffers.
     std::unique_ptr<ArrowArray> getNextArrowChunk(int64_t chunkSize) override;
 
 private:
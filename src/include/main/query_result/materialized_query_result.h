@@ -36,6 +36,7 @@ public:
     std::unique_ptr<ArrowArray> getNextArrowChunk(int64_t chunkSize) override;
 
     const processor::FactorizedTable& getFactorizedTable() const { return *table; }
+    std::shared_ptr<processor::FactorizedTable> getFactorizedTableUnsafe() const { return table; }
 
 private:
     std::shared_ptr<processor::FactorizedTable> table;
@@ -0,0 +1,74 @@
+#pragma once
+
+#ifndef __SINGLE_THREADED__
+#include <thread>
+#endif
+
+#include "main/query_result.h"
+
+namespace lbug {
+namespace processor {
+class FactorizedTable;
+class FactorizedTableIterator;
+class StreamingResultSharedState;
+} // namespace processor
+
+namespace main {
+
+/**
+ * @brief StreamingQueryResult returns the tuples of a query while the query is still executing.
+ * The query runs in the background and hands over its result in bounded batches. Execution pauses
+ * whenever the consumer falls behind, so the memory held by the result does not grow with the size
+ * of the result. The query summary is available once all tuples have been read. Until the stream is
+ * drained or the result is destroyed, the connection that created it cannot run other queries.
+ */
+class StreamingQueryResult : public QueryResult {
+    static constexpr QueryResultType type_ = QueryResultType::STREAM;
+
+public:
+#ifndef __SINGLE_THREADED__
+    StreamingQueryResult(std::shared_ptr<processor::StreamingResultSharedState> sharedState,
+        std::thread producer);
+#else
+    explicit StreamingQueryResult(
+        std::shared_ptr<processor::StreamingResultSharedState> sharedState);
+#endif
+    ~StreamingQueryResult() override;
+
+    // Only known once the stream has been drained.
+    uint64_t getNumTuples() const override;
+
+    // Blocks until the next tuple is produced or the query finishes.
+    bool hasNext() const override;
+
+    std::shared_ptr<processor::FlatTuple> getNext() override;
+
+    // Streams cannot be rewound.
+    void resetIterator() override;
+
+    // Consumes all remaining tuples of the stream.
+    std::string toString() const override;
+
+    bool hasNextArrowChunk() override;
+
+    std::unique_ptr<ArrowArray> getNextArrowChunk(int64_t chunkSize) override;
+
+private:
+    // Moves to the next non-empty batch if the current one is exhausted. Returns false once the
+    // stream is drained.
+    bool advance();
+    void finishStream();
+
+private:
+    std::shared_ptr<processor::StreamingResultSharedState> sharedState;
+#ifndef __SINGLE_THREADED__
+    std::thread producer;
+#endif
+    std::shared_ptr<processor::FactorizedTable> currentBatch;
+    std::unique_ptr<processor::FactorizedTableIterator> iterator;
+    bool streamFinished;
+    uint64_t numTuplesRead;
+};
+
+} // namespace main
+} // namespace lbug
@@ -16,6 +16,8 @@ namespace main {
  */
 struct PreparedSummary { // NOLINT(*-pro-type-member-init)
     double compilingTime = 0;
+    // Part of the compiling time spent in planning and optimizing.
+    double planningTime = 0;
     common::StatementType statementType;
 };
 
@@ -32,15 +34,30 @@ public:
      * @return query compiling time in milliseconds.
      */
     LBUG_API double getCompilingTime() const;
+    /**
+     * @return time spent planning and optimizing the query in milliseconds. This is part of the
+     * compiling time.
+     */
+    LBUG_API double getPlanningTime() const;
     /**
      * @return query execution time in milliseconds.
      */
     LBUG_API double getExecutionTime() const;
 
+    /**
+     * @return the highest amount of intermediate memory in bytes allocated by the query at any
+     * point of its execution.
+     */
+    LBUG_API uint64_t getPeakMemoryUsage() const;
+
     void setExecutionTime(double time);
 
+    void setPeakMemoryUsage(uint64_t peakMemoryUsage_);
+
     void incrementCompilingTime(double increment);
 
+    void incrementPlanningTime(double increment);
+
     void incrementExecutionTime(double increment);
 
     /**
@@ -55,6 +72,7 @@ public:
 
 private:
     double executionTime = 0;
+    uint64_t peakMemoryUsage = 0;
     PreparedSummary preparedSummary;
 };
 
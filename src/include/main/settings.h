@@ -12,6 +12,13 @@ struct ThreadsSetting {
     static common::Value getSetting(const ClientContext* context);
 };
 
+struct QueryPrioritySetting {
+    static constexpr auto name = "query_priority";
+    static constexpr auto inputType = common::LogicalTypeID::STRING;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
 struct WarningLimitSetting {
     static constexpr auto name = "warning_limit";
     static constexpr auto inputType = common::LogicalTypeID::UINT64;
@@ -26,6 +33,34 @@ struct TimeoutSetting {
     static common::Value getSetting(const ClientContext* context);
 };
 
+struct QueryMemoryLimitSetting {
+    static constexpr auto name = "query_memory_limit";
+    static constexpr auto inputType = common::LogicalTypeID::UINT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct JoinOrderDPThresholdSetting {
+    static constexpr auto name = "join_order_dp_threshold";
+    static constexpr auto inputType = common::LogicalTypeID::UINT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct ReoptimizationThresholdSetting {
+    static constexpr auto name = "reoptimization_threshold";
+    static constexpr auto inputType = common::LogicalTypeID::UINT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct EnablePlanCacheSetting {
+    static constexpr auto name = "enable_plan_cache";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
 struct ProgressBarSetting {
     static constexpr auto name = "progress_bar";
     static constexpr auto inputType = common::LogicalTypeID::BOOL;
@@ -47,6 +82,27 @@ struct SparseFrontierThresholdSetting {
     static common::Value getSetting(const ClientContext* context);
 };
 
+struct WSPDeltaSetting {
+    static constexpr auto name = "wsp_delta";
+    static constexpr auto inputType = common::LogicalTypeID::DOUBLE;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct CacheProjectedGraphsSetting {
+    static constexpr auto name = "cache_projected_graphs";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct ShortestPathLandmarksSetting {
+    static constexpr auto name = "shortest_path_landmarks";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
 struct EnableSemiMaskSetting {
     static constexpr auto name = "enable_semi_mask";
     static constexpr auto inputType = common::LogicalTypeID::BOOL;
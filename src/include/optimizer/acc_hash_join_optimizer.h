@@ -7,7 +7,8 @@ namespace lbug {
 namespace optimizer {
 
 // This optimizer enables the Accumulated hash join algorithm as introduced in paper "Lbug Graph
-// Database Management System".
+// Database Management System". Joins on other keys than node IDs pass their build side keys to the
+// probe side as a Bloom filter instead.
 class HashJoinSIPOptimizer final : public LogicalOperatorVisitor {
 public:
     void rewrite(const planner::LogicalPlan* plan);
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "binder/expression/expression.h"
+#include "planner/operator/logical_plan.h"
+
+namespace lbug {
+namespace optimizer {
+
+// Evaluates function expressions that are used more than once in a chain of FILTER and PROJECTION
+// operators only once, e.g. lower(a.name) in
+//     MATCH (a) WHERE lower(a.name) STARTS WITH 'a' RETURN lower(a.name)
+// A projection computing the common expressions is inserted below their first use, so that the
+// evaluators of later uses reference the computed vector instead of evaluating it again.
+class CommonSubexpressionOptimizer {
+public:
+    void rewrite(planner::LogicalPlan* plan);
+
+private:
+    void visitOperator(planner::LogicalOperator* op);
+
+    // Rewrites a chain of FILTER and PROJECTION operators given from top to bottom.
+    static void rewriteChain(const std::vector<planner::LogicalOperator*>& chain);
+
+    static void insertProjections(planner::LogicalOperator* op,
+        binder::expression_vector expressions);
+};
+
+} // namespace optimizer
+} // namespace lbug
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "binder/query/query_graph.h"
+#include "common/enums/extend_direction.h"
 #include "planner/operator/logical_plan.h"
+#include "storage/stats/degree_stats.h"
 #include "storage/stats/table_stats.h"
 
 namespace lbug {
@@ -16,6 +18,7 @@ class Transaction;
 namespace planner {
 
 class LogicalAggregate;
+class LogicalExtend;
 
 class CardinalityEstimator {
 public:
@@ -42,6 +45,12 @@ public:
 
     double getExtensionRate(const binder::RelExpression& rel,
         const binder::NodeExpression& boundNode, const transaction::Transaction* transaction) const;
+    // Extension rate of a non-recursive extend appended to `childOp`. If `childOp` already scanned
+    // the same adjacency lists of the bound node, bound nodes appear in proportion to their degree,
+    // so the expected degree is the size-biased one. It exceeds the average for skewed graphs.
+    double getExtensionRate(const binder::RelExpression& rel,
+        const binder::NodeExpression& boundNode, common::ExtendDirection direction,
+        const LogicalOperator& childOp, const transaction::Transaction* transaction) const;
     cardinality_t multiply(double extensionRate, cardinality_t card) const;
 
 private:
@@ -50,6 +59,12 @@ private:
         const std::vector<common::table_id_t>& tableIDs) const;
     cardinality_t getNumRels(const transaction::Transaction* transaction,
         const std::vector<common::table_id_t>& tableIDs) const;
+    storage::DegreeStats getDegreeStats(const std::vector<common::table_id_t>& relTableIDs,
+        common::ExtendDirection direction) const;
+    // Returns the selectivity of joining two plans on a node whose same adjacency lists are scanned
+    // on both sides, i.e. sum(d^2) / sum(d)^2, if it is known.
+    std::optional<double> getSkewedJoinSelectivity(const binder::Expression& nodeID,
+        const LogicalOperator& probeOp, const LogicalOperator& buildOp) const;
 
 private:
     main::ClientContext* context;
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "binder/query/query_graph.h"
+#include "common/api.h"
+
+namespace lbug {
+namespace main {
+class ClientContext;
+} // namespace main
+
+namespace planner {
+
+// Cardinalities observed while executing a query. If a hash join build materializes far more or
+// fewer tuples than estimated, the observed number is recorded here and the query is planned and
+// executed again, this time using the observed number for the subgraph matched by the build side.
+// Subgraphs are identified by the unique names of their query nodes and rels, which are stable
+// across binding the same statement again.
+class CardinalityFeedback {
+public:
+    // A query is re-planned at most this many times.
+    static constexpr uint64_t MAX_NUM_REOPTIMIZATIONS = 2;
+    // Misestimates of builds smaller than this are too cheap to be worth re-planning for.
+    static constexpr common::cardinality_t MIN_CARDINALITY_TO_REOPTIMIZE = 1024;
+
+    static std::string getSubgraphKey(const binder::SubqueryGraph& subgraph);
+    // Whether the observed cardinality is more than threshold times larger or smaller than the
+    // estimated one.
+    static bool isMisestimated(common::cardinality_t estimated, common::cardinality_t observed,
+        uint64_t threshold);
+
+    void addObservedCardinality(const std::string& subgraphKey, common::cardinality_t cardinality);
+    std::optional<common::cardinality_t> getObservedCardinality(
+        const std::string& subgraphKey) const;
+    bool isEmpty() const;
+
+    // Whether the running query can be re-planned if a misestimate is observed.
+    bool canReoptimize() const { return canReoptimize_; }
+    void setCanReoptimize(bool value) { canReoptimize_ = value; }
+    uint64_t getNumReoptimizations() const { return numReoptimizations; }
+    void incrementNumReoptimizations() { numReoptimizations++; }
+
+    void clear();
+
+    LBUG_API static CardinalityFeedback* Get(const main::ClientContext& context);
+
+private:
+    mutable std::mutex mtx;
+    std::unordered_map<std::string, common::cardinality_t> observedCardinalities;
+    bool canReoptimize_ = false;
+    uint64_t numReoptimizations = 0;
+};
+
+} // namespace planner
+} // namespace lbug
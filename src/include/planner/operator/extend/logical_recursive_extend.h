@@ -38,6 +38,10 @@ public:
 
     bool hasNodePredicate() const { return !children.empty(); }
 
+    // Single shortest paths between input and output nodes that are both restricted by semi masks
+    // can be computed by a bidirectional search, which is used if each mask contains one node.
+    bool canSearchBidirectionally() const;
+
     std::string getExpressionsForPrinting() const override { return function->getFunctionName(); }
 
     std::unique_ptr<LogicalOperator> copy() override {
@@ -23,10 +23,21 @@ private:
         : OPPrintInfo(other), keys(other.keys), aggregates(other.aggregates) {}
 };
 
+// The range of values of the only group by key of an aggregate, see
+// PartitioningAggregateHashTable::setDenseKeyRange.
+struct AggregateKeyRange {
+    int64_t minKey;
+    uint64_t numKeys;
+};
+
 class LogicalAggregate final : public LogicalOperator {
     static constexpr LogicalOperatorType operatorType_ = LogicalOperatorType::AGGREGATE;
 
 public:
+    // Group by keys with at most this many values in their range are aggregated in an array
+    // indexed by the key.
+    static constexpr uint64_t MAX_NUM_DENSE_KEYS = 1 << 16;
+
     LogicalAggregate(binder::expression_vector keys, binder::expression_vector aggregates,
         std::shared_ptr<LogicalOperator> child)
         : LogicalOperator{operatorType_, std::move(child)}, keys{std::move(keys)},
@@ -58,10 +69,16 @@ public:
         return result;
     }
     binder::expression_vector getAggregates() const { return aggregates; }
+    bool hasDistinctAggregate() const;
+
+    void setKeyRange(std::optional<AggregateKeyRange> range) { keyRange = range; }
+    const std::optional<AggregateKeyRange>& getKeyRange() const { return keyRange; }
 
     std::unique_ptr<LogicalOperator> copy() override {
-        return make_unique<LogicalAggregate>(keys, dependentKeys, aggregates, children[0]->copy(),
-            cardinality);
+        auto result = make_unique<LogicalAggregate>(keys, dependentKeys, aggregates,
+            children[0]->copy(), cardinality);
+        result->keyRange = keyRange;
+        return result;
     }
 
 private:
@@ -73,6 +90,8 @@ private:
     // be treated as a hash key during hash aggregation.
     binder::expression_vector dependentKeys;
     binder::expression_vector aggregates;
+    // Set by the planner if statistics show that the only key has a small range of values.
+    std::optional<AggregateKeyRange> keyRange;
 };
 
 } // namespace planner
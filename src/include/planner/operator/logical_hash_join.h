@@ -45,6 +45,20 @@ public:
     SIPInfo& getSIPInfoUnsafe() { return sipInfo; }
     SIPInfo getSIPInfo() const { return sipInfo; }
 
+    // Whether the build side keys should be passed to the probe side scans as a Bloom filter.
+    void setPassKeyFilter(bool passKeyFilter_) { passKeyFilter = passKeyFilter_; }
+    bool shouldPassKeyFilter() const { return passKeyFilter; }
+
+    // Only set for joins planned by join order enumeration, see CardinalityFeedback.
+    void setBuildSubgraph(std::string key, common::cardinality_t estimatedCardinality) {
+        buildSubgraphKey = std::move(key);
+        estimatedBuildCardinality = estimatedCardinality;
+    }
+    const std::string& getBuildSubgraphKey() const { return buildSubgraphKey; }
+    common::cardinality_t getEstimatedBuildCardinality() const {
+        return estimatedBuildCardinality;
+    }
+
     std::unique_ptr<LogicalOperator> copy() override;
 
     // Flat probe side key group in either of the following two cases:
@@ -63,6 +77,9 @@ private:
     common::JoinType joinType;
     std::shared_ptr<binder::Expression> mark; // when joinType is Mark or Left
     SIPInfo sipInfo;
+    bool passKeyFilter = false;
+    std::string buildSubgraphKey;
+    common::cardinality_t estimatedBuildCardinality = 0;
 };
 
 } // namespace planner
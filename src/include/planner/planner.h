@@ -170,10 +170,17 @@ public:
         common::ExtendDirection direction, const binder::expression_vector& properties,
         LogicalPlan& plan);
 
+    // Add a plan of the subgraph to the dp table, applying cardinalities observed by a previous
+    // execution of the query.
+    void addSubgraphPlan(const binder::SubqueryGraph& subgraph, LogicalPlan plan);
+
     // Plan dp level
     void planLevel(uint32_t level);
     void planLevelExactly(uint32_t level);
     void planLevelApproximately(uint32_t level);
+    // Extend the cheapest subgraph of the previous level by one variable and keep only the
+    // cheapest extension.
+    void planLevelGreedily(uint32_t level);
 
     // Plan worst case optimal join
     void planWCOJoin(uint32_t leftLevel, uint32_t rightLevel);
@@ -63,6 +63,9 @@ public:
 
     void addPlan(const binder::SubqueryGraph& subqueryGraph, LogicalPlan plan);
 
+    // Drop all subgraphs but the one with the cheapest plan.
+    void retainCheapestSubgraph();
+
     void clear() { subgraph2Plans.clear(); }
 
 private:
@@ -87,6 +90,8 @@ public:
 
     void addPlan(const binder::SubqueryGraph& subqueryGraph, LogicalPlan plan);
 
+    void retainCheapestSubgraph(uint32_t level) { dpLevels[level].retainCheapestSubgraph(); }
+
     void clear();
 
 private:
@@ -148,6 +148,12 @@ protected:
 
     void findHashSlots(const FactorizedTable& data, uint64_t startOffset, uint64_t numTuples);
 
+    // Specialization of findHashSlots for a single unflat key without nulls of a fixed-size type.
+    // Probes the hash table tuple by tuple, comparing keys directly instead of through
+    // compareEntryFuncs.
+    template<typename T>
+    void findHashSlotsWithSingleKey(const common::ValueVector& keyVector);
+
 protected:
     void initializeFT(const std::vector<function::AggregateFunction>& aggregateFunctions,
         FactorizedTableSchema&& tableSchema);
@@ -270,9 +276,12 @@ protected:
     std::unique_ptr<uint64_t[]> noMatchIdxes;
     std::unique_ptr<uint64_t[]> entryIdxesToInitialize;
     std::unique_ptr<HashSlot*[]> hashSlotsToUpdateAggState;
+    // Entries of hashSlotsToUpdateAggState, gathered for aggregate functions with batch updates.
+    std::unique_ptr<uint8_t*[]> entriesToUpdateAggState;
 
     std::vector<common::LogicalType> payloadTypes;
     std::vector<function::AggregateFunction> aggregateFunctions;
+    bool hasUpdateBatchFuncs = false;
 
     //! special handling of distinct aggregate
     std::vector<std::unique_ptr<AggregateHashTable>> distinctHashTables;
@@ -333,9 +342,29 @@ public:
 
     void mergeIfFull(uint64_t tuplesToAdd, bool mergeAll = false);
 
+    // Groups whose key is in [minKey, minKey + numKeys) are aggregated in a separate table whose
+    // entries are found by indexing an array with the key, which skips hashing and probing. Other
+    // groups, e.g. those of null keys or keys outside of a stale range, still go through the hash
+    // table. Only applies to a single key of an integer type.
+    void setDenseKeyRange(int64_t minKey, uint64_t numKeys);
+    // Flushes the groups of the dense key range into the partitions of the shared state, where
+    // they are merged with the groups of other threads.
+    void mergeDenseEntries();
+
+private:
+    // Returns false if the keys cannot be aggregated in the dense key range.
+    bool findDenseSlots(const std::vector<common::ValueVector*>& keyVectors,
+        const std::vector<common::ValueVector*>& dependentKeyVectors);
+    template<typename T>
+    bool findDenseSlots(const common::ValueVector& keyVector);
+
 private:
     FactorizedTableSchema tableSchema;
     AggregatePartitioningData* partitioningData;
+    int64_t denseMinKey = 0;
+    // Slot i points to the entry of key denseMinKey + i in denseTable, if it exists.
+    std::vector<HashSlot> denseSlots;
+    std::unique_ptr<FactorizedTable> denseTable;
 };
 
 } // namespace processor
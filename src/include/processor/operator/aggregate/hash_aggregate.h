@@ -28,6 +28,10 @@ struct HashAggregateInfo {
     std::vector<DataPos> unFlatKeysPos;
     std::vector<DataPos> dependentKeysPos;
     FactorizedTableSchema tableSchema;
+    // Range of the only key, see PartitioningAggregateHashTable::setDenseKeyRange. Zero keys if
+    // the key range is unknown.
+    int64_t denseMinKey = 0;
+    uint64_t numDenseKeys = 0;
 
     HashAggregateInfo(std::vector<DataPos> flatKeysPos, std::vector<DataPos> unFlatKeysPos,
         std::vector<DataPos> dependentKeysPos, FactorizedTableSchema tableSchema);
@@ -130,6 +134,8 @@ struct HashAggregatePrintInfo final : OPPrintInfo {
     binder::expression_vector keys;
     binder::expression_vector aggregates;
     uint64_t limitNum;
+    int64_t denseMinKey = 0;
+    uint64_t numDenseKeys = 0;
 
     HashAggregatePrintInfo(binder::expression_vector keys, binder::expression_vector aggregates)
         : keys{std::move(keys)}, aggregates{std::move(aggregates)}, limitNum{UINT64_MAX} {}
@@ -143,7 +149,8 @@ struct HashAggregatePrintInfo final : OPPrintInfo {
 private:
     HashAggregatePrintInfo(const HashAggregatePrintInfo& other)
         : OPPrintInfo{other}, keys{other.keys}, aggregates{other.aggregates},
-          limitNum{other.limitNum} {}
+          limitNum{other.limitNum}, denseMinKey{other.denseMinKey},
+          numDenseKeys{other.numDenseKeys} {}
 };
 
 class HashAggregate final : public BaseAggregate {
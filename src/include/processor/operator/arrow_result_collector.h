@@ -33,6 +33,9 @@ struct ArrowResultCollectorLocalState {
     void fillTuple();
 
     void resetCursor();
+    // Returns false if more than one chunk is unflat. Otherwise, sets unflatChunk to the unflat
+    // chunk (nullptr if all chunks are flat).
+    bool getUnflatChunk(common::DataChunk*& unflatChunk) const;
 };
 
 struct ArrowResultCollectorInfo {
@@ -76,6 +79,9 @@ private:
 
     void iterateResultSet(common::ArrowRowBatch* inputBatch);
     bool fillRowBatch(common::ArrowRowBatch& rowBatch);
+    void appendVectors(common::DataChunk* unflatChunk,
+        std::unique_ptr<common::ArrowRowBatch>& rowBatch);
+    std::unique_ptr<common::ArrowRowBatch> createRowBatch() const;
 
 private:
     std::shared_ptr<ArrowResultCollectorSharedState> sharedState;
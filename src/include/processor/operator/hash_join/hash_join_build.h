@@ -1,8 +1,10 @@
 #pragma once
 
+#include <atomic>
 #include <mutex>
 
 #include "binder/expression/expression.h"
+#include "common/bloom_filter.h"
 #include "join_hash_table.h"
 #include "processor/operator/physical_operator.h"
 #include "processor/operator/sink.h"
@@ -39,6 +41,9 @@ class HashJoinBuild;
 // a global htDirectory, which will be updated by the last thread in the hash join build side
 // task/pipeline, and probed by the HashJoinProbe operators.
 class HashJoinSharedState {
+    // Above this number of build tuples, the key filter is left empty and passes all probe rows.
+    static constexpr uint64_t MAX_NUM_KEY_FILTER_ENTRIES = 1 << 22;
+
 public:
     explicit HashJoinSharedState(std::unique_ptr<JoinHashTable> hashTable)
         : hashTable{std::move(hashTable)} {};
@@ -47,9 +52,23 @@ public:
 
     JoinHashTable* getHashTable() { return hashTable.get(); }
 
+    void addNumBuildTuples(uint64_t numTuples) { numBuildTuples += numTuples; }
+    uint64_t getNumBuildTuples() const { return numBuildTuples.load(); }
+
+    void setKeyFilter(std::shared_ptr<common::BloomFilter> filter) {
+        keyFilter = std::move(filter);
+    }
+    // Fills the key filter, if any, with the keys of the hash table.
+    void buildKeyFilter();
+
 protected:
     std::mutex mtx;
     std::unique_ptr<JoinHashTable> hashTable;
+    // Number of flat tuples produced by the build side. Only counted if the build checks its
+    // cardinality estimate, see HashJoinBuildInfo.
+    std::atomic<uint64_t> numBuildTuples = 0;
+    // Bloom filter of the build side keys checked by probe side scans.
+    std::shared_ptr<common::BloomFilter> keyFilter;
 };
 
 struct HashJoinBuildInfo {
@@ -57,6 +76,10 @@ struct HashJoinBuildInfo {
     std::vector<common::FStateType> fStateTypes;
     std::vector<DataPos> payloadsPos;
     FactorizedTableSchema tableSchema;
+    // Identifies the subgraph matched by the build side if the number of build tuples should be
+    // checked against the planner's estimate, see planner::CardinalityFeedback. Empty otherwise.
+    std::string subgraphKey;
+    common::cardinality_t estimatedCardinality = 0;
 
     HashJoinBuildInfo(std::vector<DataPos> keysPos, std::vector<common::FStateType> fStateTypes,
         std::vector<DataPos> payloadsPos, FactorizedTableSchema tableSchema)
@@ -69,7 +92,8 @@ struct HashJoinBuildInfo {
 private:
     HashJoinBuildInfo(const HashJoinBuildInfo& other)
         : keysPos{other.keysPos}, fStateTypes{other.fStateTypes}, payloadsPos{other.payloadsPos},
-          tableSchema{other.tableSchema.copy()} {}
+          tableSchema{other.tableSchema.copy()}, subgraphKey{other.subgraphKey},
+          estimatedCardinality{other.estimatedCardinality} {}
 };
 
 class HashJoinBuild : public Sink {
@@ -101,6 +125,7 @@ protected:
 
 private:
     void setKeyState(common::DataChunkState* state);
+    void checkCardinalityEstimate(ExecutionContext* context) const;
 
 protected:
     std::shared_ptr<HashJoinSharedState> sharedState;
@@ -110,6 +135,7 @@ protected:
     // State of unFlat key(s). If all keys are flat, it points to any flat key state.
     common::DataChunkState* keyState = nullptr;
     std::vector<common::ValueVector*> payloadVectors;
+    std::unordered_set<uint32_t> dataChunksPosInScope;
 
     std::unique_ptr<JoinHashTable> hashTable; // local state
 };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "common/bloom_filter.h"
 #include "processor/result/base_hash_table.h"
 #include "processor/result/factorized_table.h"
 
@@ -25,6 +26,8 @@ public:
 
     void allocateHashSlots(uint64_t numTuples);
     void buildHashSlots();
+    // Inserts the hash of the keys of each tuple into the filter.
+    void insertHashes(common::BloomFilter& filter);
 
     // The tmpHashResultVector may be null if there is only one keyVector
     void probe(const std::vector<common::ValueVector*>& keyVectors, common::ValueVector& hashVector,
@@ -5,6 +5,7 @@
 #include "binder/expression/expression.h"
 #include "processor/operator/sink.h"
 #include "sort_state.h"
+#include "storage/predicate/top_k_predicate.h"
 
 namespace lbug {
 namespace processor {
@@ -118,6 +119,8 @@ public:
     std::vector<vector_select_comparison_func> compareFuncs;
     std::vector<vector_select_comparison_func> equalsFuncs;
     bool hasBoundaryValue;
+    // Receives the first key of the boundary value, if a scan below filters on it.
+    storage::TopKBoundary* keyBoundary = nullptr;
 
 private:
     // Holds the ownership of all temp vectors.
@@ -150,6 +153,7 @@ public:
         uint64_t skipNumber, uint64_t limitNumber) {
         buffer = std::make_unique<TopKBuffer>(orderByDataInfo);
         buffer->init(memoryManager, skipNumber, limitNumber);
+        buffer->keyBoundary = keyBoundary.get();
     }
 
     void mergeLocalState(TopKLocalState* localState) {
@@ -161,6 +165,8 @@ public:
     inline void finalize() { buffer->finalize(); }
 
     std::unique_ptr<TopKBuffer> buffer;
+    // Set if the first key is a column of a scan below the TOP-K.
+    std::shared_ptr<storage::TopKBoundary> keyBoundary;
 
 private:
     std::mutex mtx;
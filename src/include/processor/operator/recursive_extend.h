@@ -45,6 +45,20 @@ public:
             printInfo->copy());
     }
 
+private:
+    void writeOutput(ExecutionContext* context, function::GDSComputeState& computeState,
+        common::nodeID_t sourceNodeID);
+
+    // Computes the shortest path between the single input node and the single output node with a
+    // bidirectional search. Returns false if the masks do not restrict both to a single node.
+    bool tryExecuteBidirectional(ExecutionContext* context,
+        const std::vector<std::string>& propertyNames);
+
+    // Computes shortest path lengths for batches of source nodes with a multi-source BFS. Returns
+    // false if the function does not only compute destinations and lengths or if there are too
+    // few sources.
+    bool tryExecuteMultiSource(ExecutionContext* context, common::offset_t totalNumNodes);
+
 private:
     std::unique_ptr<function::RJAlgorithm> function;
     function::RJBindData bindData;
@@ -93,6 +93,11 @@ public:
 
     bool isSource() const override { return true; }
 
+    // Skips the node groups and rows whose value in the output vector at pos does not satisfy a
+    // predicate passed by another operator. Returns false if the scan does not output pos.
+    bool addRuntimePredicate(const DataPos& pos,
+        std::shared_ptr<storage::RuntimeColumnPredicate> predicate);
+
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
 
     bool getNextTuplesInternal(ExecutionContext* context) override;
@@ -103,8 +108,10 @@ public:
     }
 
     std::unique_ptr<PhysicalOperator> copy() override {
-        return std::make_unique<ScanNodeTable>(opInfo.copy(), copyVector(tableInfos), sharedStates,
-            id, printInfo->copy(), progressSharedState);
+        auto result = std::make_unique<ScanNodeTable>(opInfo.copy(), copyVector(tableInfos),
+            sharedStates, id, printInfo->copy(), progressSharedState);
+        result->runtimePredicates = runtimePredicates;
+        return result;
     }
 
     double getProgress(ExecutionContext* context) const override;
@@ -120,6 +127,9 @@ private:
     std::vector<ScanNodeTableInfo> tableInfos;
     std::vector<std::shared_ptr<ScanNodeTableSharedState>> sharedStates;
     std::shared_ptr<ScanNodeTableProgressSharedState> progressSharedState;
+    // Output vector index and predicate, shared by all copies of the operator.
+    std::vector<std::pair<common::idx_t, std::shared_ptr<storage::RuntimeColumnPredicate>>>
+        runtimePredicates;
 };
 
 } // namespace processor
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+#include "common/system_config.h"
+#include "processor/operator/result_collector.h"
+
+namespace lbug {
+namespace main {
+class QueryResult;
+}
+namespace processor {
+
+// Bounded queue of result batches between the workers executing the root pipeline of a query
+// (producers) and a StreamingQueryResult (consumer). A worker that finds the queue full blocks
+// until the consumer takes a batch, so at most MAX_NUM_BUFFERED_BATCHES batches plus one partially
+// filled batch per worker are alive at any time, independent of the size of the result.
+class StreamingResultSharedState {
+public:
+    static constexpr uint64_t MAX_NUM_TUPLES_PER_BATCH = common::DEFAULT_VECTOR_CAPACITY;
+    static constexpr uint64_t MAX_NUM_BUFFERED_BATCHES = 4;
+
+    explicit StreamingResultSharedState(uint64_t maxNumBufferedBatches = MAX_NUM_BUFFERED_BATCHES)
+        : maxNumBufferedBatches{maxNumBufferedBatches}, headerSet{false}, cancelled{false},
+          finished{false} {}
+
+    // Producer side.
+    void setHeader(std::vector<std::string> columnNames,
+        std::vector<common::LogicalType> columnTypes);
+    // Blocks while the queue is full. Throws InterruptException if the consumer closed the result
+    // or the query is interrupted while waiting.
+    void push(std::shared_ptr<FactorizedTable> batch, const main::ClientContext& context);
+    // Marks the end of the stream. The result returned by the execution of the query carries the
+    // query summary or the error message.
+    void finish(std::unique_ptr<main::QueryResult> result);
+
+    // Consumer side.
+    // Blocks until the header is set or the stream finished before producing one (e.g. because
+    // the query failed to compile). Returns false in the latter case.
+    bool waitForHeader();
+    std::vector<std::string> getColumnNames() const { return columnNames; }
+    std::vector<common::LogicalType> getColumnTypes() const {
+        return common::LogicalType::copy(columnTypes);
+    }
+    // Blocks until a batch is available. Returns nullptr once the stream is finished and drained.
+    std::shared_ptr<FactorizedTable> pop();
+    // Unblocks and aborts the producers. Buffered batches are discarded.
+    void cancel();
+    bool isFinished();
+    std::unique_ptr<main::QueryResult> moveFinalResult();
+
+private:
+    std::mutex mtx;
+    std::condition_variable notFull;
+    std::condition_variable notEmpty;
+    uint64_t maxNumBufferedBatches;
+    std::deque<std::shared_ptr<FactorizedTable>> batches;
+    std::vector<std::string> columnNames;
+    std::vector<common::LogicalType> columnTypes;
+    bool headerSet;
+    bool cancelled;
+    bool finished;
+    std::unique_ptr<main::QueryResult> finalResult;
+};
+
+struct StreamingResultCollectorInfo {
+    FactorizedTableSchema tableSchema;
+    std::vector<DataPos> payloadPositions;
+
+    StreamingResultCollectorInfo(FactorizedTableSchema tableSchema,
+        std::vector<DataPos> payloadPositions)
+        : tableSchema{std::move(tableSchema)}, payloadPositions{std::move(payloadPositions)} {}
+    EXPLICIT_COPY_DEFAULT_MOVE(StreamingResultCollectorInfo);
+
+private:
+    StreamingResultCollectorInfo(const StreamingResultCollectorInfo& other)
+        : tableSchema{other.tableSchema.copy()}, payloadPositions{other.payloadPositions} {}
+};
+
+// Root sink of a query executed with QueryResultType::STREAM. Instead of merging every tuple into
+// a single factorized table, each worker hands over its tuples in batches of at most
+// MAX_NUM_TUPLES_PER_BATCH (factorized) tuples as soon as a batch is full.
+class StreamingResultCollector final : public Sink {
+    static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::RESULT_COLLECTOR;
+
+public:
+    StreamingResultCollector(StreamingResultCollectorInfo info,
+        std::shared_ptr<StreamingResultSharedState> sharedState,
+        storage::MemoryManager* memoryManager, std::unique_ptr<PhysicalOperator> child, uint32_t id,
+        std::unique_ptr<OPPrintInfo> printInfo)
+        : Sink{type_, std::move(child), id, std::move(printInfo)}, info{std::move(info)},
+          sharedState{std::move(sharedState)}, memoryManager{memoryManager} {}
+
+    void executeInternal(ExecutionContext* context) override;
+
+    // Tuples have already been handed over to the consumer. The returned result is empty and only
+    // carries the query summary back to the client context.
+    std::unique_ptr<main::QueryResult> getQueryResult() const override;
+
+    std::unique_ptr<PhysicalOperator> copy() override {
+        return std::make_unique<StreamingResultCollector>(info.copy(), sharedState, memoryManager,
+            children[0]->copy(), id, printInfo->copy());
+    }
+
+private:
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
+    std::shared_ptr<FactorizedTable> createBatch() const;
+
+private:
+    StreamingResultCollectorInfo info;
+    std::shared_ptr<StreamingResultSharedState> sharedState;
+    std::vector<common::ValueVector*> payloadVectors;
+    storage::MemoryManager* memoryManager;
+    std::shared_ptr<FactorizedTable> localBatch;
+};
+
+} // namespace processor
+} // namespace lbug
@@ -32,6 +32,7 @@ class TableCatalogEntry;
 }
 
 namespace planner {
+struct AggregateKeyRange;
 class LogicalSemiMasker;
 struct LogicalInsertInfo;
 class LogicalCopyFrom;
@@ -55,6 +56,7 @@ struct BatchInsertSharedState;
 struct PartitionerSharedState;
 class RelBatchInsertImpl;
 class ArrowResultCollector;
+class StreamingResultSharedState;
 
 class PlanMapper {
 public:
@@ -62,7 +64,8 @@ public:
 
     std::unique_ptr<PhysicalPlan> getPhysicalPlan(const planner::LogicalPlan* logicalPlan,
         const binder::expression_vector& expressions, main::QueryResultType resultType,
-        common::ArrowResultConfig arrowConfig);
+        common::ArrowResultConfig arrowConfig,
+        std::shared_ptr<StreamingResultSharedState> streamingState = nullptr);
 
     uint32_t getOperatorID() { return physicalOperatorID++; }
 
@@ -178,6 +181,10 @@ public:
     std::unique_ptr<PhysicalOperator> createArrowResultCollector(
         common::ArrowResultConfig arrowConfig, const binder::expression_vector& expressions,
         planner::Schema* schema, std::unique_ptr<PhysicalOperator> prevOperator);
+    std::unique_ptr<PhysicalOperator> createStreamingResultCollector(
+        std::shared_ptr<StreamingResultSharedState> sharedState,
+        const binder::expression_vector& expressions, planner::Schema* schema,
+        std::unique_ptr<PhysicalOperator> prevOperator);
 
     // Scan fTable
     std::unique_ptr<PhysicalOperator> createFTableScan(const binder::expression_vector& exprs,
@@ -214,7 +221,8 @@ public:
     std::unique_ptr<PhysicalOperator> createHashAggregate(const binder::expression_vector& keys,
         const binder::expression_vector& payloads, const binder::expression_vector& aggregates,
         planner::Schema* inSchema, planner::Schema* outSchema,
-        std::unique_ptr<PhysicalOperator> prevOperator);
+        std::unique_ptr<PhysicalOperator> prevOperator,
+        const planner::AggregateKeyRange* keyRange = nullptr);
 
     NodeInsertExecutor getNodeInsertExecutor(const planner::LogicalInsertInfo* boundInfo,
         const planner::Schema& inSchema, const planner::Schema& outSchema) const;
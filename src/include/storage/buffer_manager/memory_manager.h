@@ -19,6 +19,7 @@ class VirtualFileSystem;
 namespace storage {
 
 class MemoryManager;
+class QueryMemoryTracker;
 class FileHandle;
 class BufferManager;
 class ChunkedNodeGroup;
@@ -27,6 +28,7 @@ class MmAllocator;
 
 class MemoryBuffer {
     friend class Spiller;
+    friend class MemoryManager;
 
 public:
     LBUG_API MemoryBuffer(MemoryManager* mm, common::page_idx_t blockIdx, uint8_t* buffer,
@@ -58,6 +60,8 @@ private:
     MemoryManager* mm;
     common::page_idx_t pageIdx;
     bool evicted;
+    // The query this buffer is charged to. Only set for intermediate buffers.
+    std::shared_ptr<QueryMemoryTracker> memoryTracker;
 };
 
 /*
@@ -74,6 +78,12 @@ private:
  *
  * MM will return a MemoryBuffer to the caller, which is a wrapper of the allocated memory block,
  * and it will automatically call its allocator to reclaim the memory block when it is destroyed.
+ *
+ * Buffers holding intermediate results of query operators (factorized tables, hash slots, sort
+ * blocks, overflow strings, GDS states) are allocated with allocateIntermediateBuffer, which charges
+ * them to the QueryMemoryTracker of the query running on the current thread. Storage buffers
+ * (column chunks, undo buffer, WAL, overflow files) use allocateBuffer and are never charged, since
+ * they may outlive the query that created them.
  */
 class LBUG_API MemoryManager {
     friend class MemoryBuffer;
@@ -87,6 +97,10 @@ public:
 
     std::unique_ptr<MemoryBuffer> allocateBuffer(bool initializeToZero = false,
         uint64_t size = common::TEMP_PAGE_SIZE);
+    // Throws a BufferManagerException if the buffer would exceed the memory limit of the query.
+    // Operators do not spill when the limit is reached, so the limit is a hard cap.
+    std::unique_ptr<MemoryBuffer> allocateIntermediateBuffer(bool initializeToZero = false,
+        uint64_t size = common::TEMP_PAGE_SIZE);
     common::page_offset_t getPageSize() const { return pageSize; }
 
     BufferManager* getBufferManager() const { return bm; }
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "common/api.h"
+#include "common/copy_constructors.h"
+
+namespace lbug {
+namespace storage {
+
+/*
+ * QueryMemoryTracker accounts for the intermediate memory a single query allocates through
+ * MemoryManager::allocateIntermediateBuffer (factorized tables, hash slots, sort blocks, etc.) and
+ * enforces the per-query memory limit (the query_memory_limit setting). A memory limit of 0 means
+ * the query is unlimited. Reaching the limit fails the query; operators do not spill.
+ *
+ * Allocations are charged to the tracker that is active on the allocating thread. The task
+ * scheduler activates the tracker of the query while a worker runs one of its tasks (see
+ * QueryMemoryTrackerScope). Each MemoryBuffer keeps a reference to the tracker it was charged to
+ * and releases its memory to the same tracker when freed, so a buffer outliving its query (e.g.,
+ * a materialized result) does not corrupt the accounting of the next query.
+ */
+class LBUG_API QueryMemoryTracker {
+public:
+    explicit QueryMemoryTracker(uint64_t memoryLimit)
+        : memoryLimit{memoryLimit}, usedMemory{0}, peakMemory{0} {}
+    DELETE_COPY_AND_MOVE(QueryMemoryTracker);
+
+    // Returns false, without charging anything, if the reservation would exceed the memory limit.
+    bool reserve(uint64_t size);
+    void release(uint64_t size) { usedMemory -= size; }
+
+    uint64_t getMemoryLimit() const { return memoryLimit; }
+    uint64_t getUsedMemory() const { return usedMemory.load(); }
+    uint64_t getPeakMemory() const { return peakMemory.load(); }
+
+    // Returns the tracker allocations on the current thread are charged to, or nullptr if none.
+    static std::shared_ptr<QueryMemoryTracker> getActive();
+
+private:
+    void updatePeakMemory(uint64_t newUsedMemory);
+
+private:
+    uint64_t memoryLimit;
+    std::atomic<uint64_t> usedMemory;
+    std::atomic<uint64_t> peakMemory;
+};
+
+// Sets the active tracker of the current thread for the lifetime of the scope and restores the
+// previously active one on destruction.
+class LBUG_API QueryMemoryTrackerScope {
+public:
+    explicit QueryMemoryTrackerScope(std::shared_ptr<QueryMemoryTracker> tracker);
+    ~QueryMemoryTrackerScope();
+    DELETE_COPY_AND_MOVE(QueryMemoryTrackerScope);
+
+private:
+    std::shared_ptr<QueryMemoryTracker> prevTracker;
+};
+
+} // namespace storage
+} // namespace lbug
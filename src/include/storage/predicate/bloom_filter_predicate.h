@@ -0,0 +1,39 @@
+#pragma once
+
+#include "column_predicate.h"
+#include "common/bloom_filter.h"
+
+namespace lbug {
+namespace storage {
+
+// Keeps the rows whose value may be one of the keys inserted into the filter, e.g. the keys of a
+// hash join build side. The filter is filled at runtime, rows are kept until it is initialized.
+class ColumnBloomFilterPredicate final : public RuntimeColumnPredicate {
+public:
+    ColumnBloomFilterPredicate(std::string columnName, std::shared_ptr<common::BloomFilter> filter)
+        : RuntimeColumnPredicate{std::move(columnName), common::ExpressionType::EQUALS},
+          filter{std::move(filter)} {}
+
+    common::ZoneMapCheckResult checkZoneMap(
+        const MergedColumnChunkStats& /*stats*/) const override {
+        return common::ZoneMapCheckResult::ALWAYS_SCAN;
+    }
+
+    void select(const common::ValueVector& vector,
+        common::SelectionVector& selVector) const override;
+
+    std::string toString() override;
+
+    std::unique_ptr<ColumnPredicate> copy() const override {
+        return std::make_unique<ColumnBloomFilterPredicate>(columnName, filter);
+    }
+
+    // Only values hashed the same way in a vector and in a hash table are supported.
+    static bool isSupportedType(common::PhysicalTypeID physicalType);
+
+private:
+    std::shared_ptr<common::BloomFilter> filter;
+};
+
+} // namespace storage
+} // namespace lbug
@@ -5,6 +5,11 @@
 #include "common/enums/zone_map_check_result.h"
 
 namespace lbug {
+namespace common {
+class SelectionVector;
+class ValueVector;
+} // namespace common
+
 namespace storage {
 
 struct MergedColumnChunkStats;
@@ -32,6 +37,17 @@ protected:
     common::ExpressionType expressionType;
 };
 
+// A predicate whose operand is only known at runtime, e.g. passed sideways by another operator.
+// Scans check it against the rows they output in addition to zone maps.
+class LBUG_API RuntimeColumnPredicate : public ColumnPredicate {
+public:
+    using ColumnPredicate::ColumnPredicate;
+
+    // Removes the selected rows whose value in the vector cannot satisfy the predicate.
+    virtual void select(const common::ValueVector& vector,
+        common::SelectionVector& selVector) const = 0;
+};
+
 class LBUG_API ColumnPredicateSet {
 public:
     ColumnPredicateSet() = default;
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <mutex>
+#include <optional>
+
+#include "column_predicate.h"
+#include "common/types/value/value.h"
+
+namespace lbug {
+namespace storage {
+
+// The last key currently in a TOP-K buffer. Rows whose key sorts after the boundary cannot enter
+// the top k anymore, so scans below the TOP-K can drop them. The boundary only gets tighter.
+class LBUG_API TopKBoundary {
+public:
+    explicit TopKBoundary(bool isAscOrder) : isAscOrder{isAscOrder} {}
+
+    bool isAsc() const { return isAscOrder; }
+
+    // Replaces the boundary if the value is closer to the top of the order.
+    void update(const common::Value& newValue);
+
+    std::optional<common::Value> getValue() const;
+
+    // Only integers are supported, see ColumnTopKPredicate.
+    static bool isSupportedType(common::PhysicalTypeID physicalType);
+
+private:
+    bool isAscOrder;
+    mutable std::mutex mtx;
+    std::optional<common::Value> value;
+};
+
+class ColumnTopKPredicate final : public RuntimeColumnPredicate {
+public:
+    ColumnTopKPredicate(std::string columnName, std::shared_ptr<TopKBoundary> boundary)
+        : RuntimeColumnPredicate{std::move(columnName),
+              boundary->isAsc() ? common::ExpressionType::LESS_THAN_EQUALS :
+                                  common::ExpressionType::GREATER_THAN_EQUALS},
+          boundary{std::move(boundary)} {}
+
+    common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const override;
+
+    void select(const common::ValueVector& vector,
+        common::SelectionVector& selVector) const override;
+
+    std::string toString() override;
+
+    std::unique_ptr<ColumnPredicate> copy() const override {
+        return std::make_unique<ColumnTopKPredicate>(columnName, boundary);
+    }
+
+private:
+    std::shared_ptr<TopKBoundary> boundary;
+};
+
+} // namespace storage
+} // namespace lbug
@@ -6,6 +6,7 @@
 #include "common/serializer/serializer.h"
 #include "common/vector/value_vector.h"
 #include "storage/stats/hyperloglog.h"
+#include "storage/stats/value_histogram.h"
 
 namespace lbug {
 namespace storage {
@@ -17,6 +18,9 @@ public:
     EXPLICIT_COPY_DEFAULT_MOVE(ColumnStats);
 
     common::cardinality_t getNumDistinctValues() const { return hll ? hll->count() : 0; }
+    // Returns the most common values and histogram of the column, built from a sample of its
+    // values. Returns nullopt if no values have been sampled.
+    std::optional<ValueHistogram> getHistogram() const;
 
     void update(const common::ValueVector* vector);
 
@@ -24,6 +28,7 @@ public:
         if (hll) {
             KU_ASSERT(other.hll);
             hll->merge(*other.hll);
+            sample.merge(other.sample);
         };
     }
 
@@ -33,6 +38,8 @@ public:
         if (hll) {
             serializer.writeDebuggingInfo("hll");
             hll->serialize(serializer);
+            serializer.writeDebuggingInfo("sample");
+            sample.serialize(serializer);
         }
     }
 
@@ -45,15 +52,20 @@ public:
         if (hasHll) {
             deserializer.validateDebuggingInfo(info, "hll");
             columnStats.hll = HyperLogLog::deserialize(deserializer);
+            deserializer.validateDebuggingInfo(info, "sample");
+            columnStats.sample = ValueSample::deserialize(deserializer);
         }
         return columnStats;
     }
 
 private:
-    ColumnStats(const ColumnStats& other) : hll{other.hll}, hashes{nullptr} {}
+    ColumnStats(const ColumnStats& other)
+        : hll{other.hll}, sample{other.sample.copy()}, hashes{nullptr} {}
 
 private:
     std::optional<HyperLogLog> hll;
+    // Only maintained for columns with an hll, sampling from the same hashes.
+    ValueSample sample;
     // Preallocated vector for hash values.
     std::unique_ptr<common::ValueVector> hashes;
 };
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <array>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/types/types.h"
+
+namespace lbug {
+namespace storage {
+
+// Histogram of the degrees of the bound nodes of a rel table in one direction. Bucket i holds nodes
+// with a degree in [2^i, 2^(i+1)). Nodes without rels are not tracked; their number follows from
+// the cardinality of the node table.
+// Besides the number of nodes, each bucket keeps the sum of the degrees and the sum of the squared
+// degrees, so the estimator can tell a skewed (e.g. power-law) graph from a uniform one with the
+// same average degree.
+class DegreeStats {
+public:
+    static constexpr common::idx_t NUM_BUCKETS = 64;
+
+    struct Bucket {
+        common::cardinality_t numNodes = 0;
+        common::cardinality_t numRels = 0;
+        double sumSquaredDegrees = 0;
+    };
+
+    DegreeStats() = default;
+    EXPLICIT_COPY_DEFAULT_MOVE(DegreeStats);
+
+    void addNode(common::length_t degree);
+    void merge(const DegreeStats& other);
+
+    const Bucket& getBucket(common::idx_t bucketIdx) const { return buckets[bucketIdx]; }
+    common::length_t getMaxDegree() const { return maxDegree; }
+    common::cardinality_t getNumNodesWithRels() const;
+    common::cardinality_t getNumRels() const;
+    double getSumSquaredDegrees() const;
+    bool isEmpty() const { return getNumNodesWithRels() == 0; }
+
+    // The expected degree of a node reached by following a random rel of this direction backwards,
+    // i.e. sum(d^2) / sum(d). This is larger than the average degree if the degrees are skewed.
+    double getSizeBiasedDegree() const;
+
+    void serialize(common::Serializer& serializer) const;
+    static DegreeStats deserialize(common::Deserializer& deserializer);
+
+private:
+    DegreeStats(const DegreeStats& other) : buckets{other.buckets}, maxDegree{other.maxDegree} {}
+
+private:
+    std::array<Bucket, NUM_BUCKETS> buckets;
+    common::length_t maxDegree = 0;
+};
+
+} // namespace storage
+} // namespace lbug
@@ -42,6 +42,11 @@ public:
         return columnStats[columnID].getNumDistinctValues();
     }
 
+    const ColumnStats& getColumnStats(common::column_id_t columnID) const {
+        KU_ASSERT(columnID < columnStats.size());
+        return columnStats[columnID];
+    }
+
     void update(const std::vector<common::ValueVector*>& vectors,
         size_t numColumns = std::numeric_limits<size_t>::max());
     void update(const std::vector<common::column_id_t>& columnIDs,
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/types/types.h"
+
+namespace lbug {
+namespace storage {
+
+// Uniform sample of the non-null values of a column, maintained with reservoir sampling. Each entry
+// keeps the hash of the value and, for numeric columns, the value itself (NaN otherwise). The
+// sampling is deterministic given the insertion order, so that statistics are reproducible.
+class ValueSample {
+public:
+    static constexpr uint64_t CAPACITY = 256;
+
+    struct Entry {
+        common::hash_t hash;
+        double value;
+    };
+
+    ValueSample() = default;
+    EXPLICIT_COPY_DEFAULT_MOVE(ValueSample);
+
+    void insert(common::hash_t hash, double value);
+    // Merges the sample of a disjoint set of values, keeping the entries of both samples in
+    // proportion to the number of values each has seen.
+    void merge(const ValueSample& other);
+
+    std::span<const Entry> getEntries() const { return entries; }
+    uint64_t getNumValuesSeen() const { return numValuesSeen; }
+    bool isEmpty() const { return entries.empty(); }
+
+    void serialize(common::Serializer& serializer) const;
+    static ValueSample deserialize(common::Deserializer& deserializer);
+
+private:
+    ValueSample(const ValueSample& other)
+        : entries{other.entries}, numValuesSeen{other.numValuesSeen} {}
+
+private:
+    std::vector<Entry> entries;
+    uint64_t numValuesSeen = 0;
+};
+
+// Most common values and an equi-depth histogram of the remaining numeric values of a column, built
+// from a ValueSample. All selectivities are fractions of the non-null values of the column.
+class ValueHistogram {
+public:
+    static constexpr uint64_t MAX_NUM_MOST_COMMON_VALUES = 16;
+    static constexpr uint64_t NUM_BUCKETS = 16;
+
+    explicit ValueHistogram(const ValueSample& sample);
+
+    // Estimated fraction of values equal to the value with the given hash. Values that are not
+    // among the most common ones share the remaining fraction evenly.
+    double getEqualitySelectivity(common::hash_t hash,
+        common::cardinality_t numDistinctValues) const;
+    // Estimated fraction of values within the given bounds. Returns nullopt if the column is not
+    // numeric.
+    std::optional<double> getRangeSelectivity(std::optional<double> lower, bool includeLower,
+        std::optional<double> upper, bool includeUpper) const;
+
+private:
+    struct MostCommonValue {
+        common::hash_t hash;
+        double value;
+        double frequency;
+    };
+
+    std::vector<MostCommonValue> mostCommonValues;
+    double mostCommonValuesFrequency = 0;
+    // NUM_BUCKETS + 1 boundaries of the buckets over the values that are not among the most common
+    // ones, each bucket holding the same fraction of the values. Empty if there are no such values.
+    std::vector<double> bucketBoundaries;
+    double bucketFrequency = 0;
+    bool isNumeric = false;
+};
+
+} // namespace storage
+} // namespace lbug
@@ -14,6 +14,7 @@ namespace transaction {
 class Transaction;
 }
 namespace storage {
+class DegreeStats;
 class MemoryManager;
 
 using row_idx_vec_t = std::vector<common::row_idx_t>;
@@ -151,6 +152,8 @@ struct CSRNodeGroupCheckpointState final : NodeGroupCheckpointState {
 
     std::unique_ptr<InMemChunkedCSRHeader> oldHeader;
     std::unique_ptr<InMemChunkedCSRHeader> newHeader;
+    // Collects the degrees of the bound nodes after checkpointing each node group.
+    DegreeStats* degreeStats = nullptr;
 
     CSRNodeGroupCheckpointState(std::vector<common::column_id_t> columnIDs,
         std::vector<Column*> columns, PageAllocator& pageAllocator, MemoryManager* mm,
@@ -88,6 +88,10 @@ public:
         KU_UNUSED(lock);
         return stats.copy();
     }
+    void setStats(TableStats stats) {
+        auto lock = nodeGroups.lock();
+        this->stats = std::move(stats);
+    }
     void mergeStats(const TableStats& stats) {
         auto lock = nodeGroups.lock();
         this->stats.merge(stats);
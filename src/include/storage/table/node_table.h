@@ -204,10 +204,20 @@ public:
     }
 
     TableStats getStats(const transaction::Transaction* transaction) const;
+    // Merges the zone map stats of a column over all chunked groups of the table. Data in the local
+    // storage of transactions is not included. Returns stats without min and max if they are
+    // unknown, e.g. because some chunk has in-place updates.
+    MergedColumnChunkStats getMergedColumnChunkStats(common::column_id_t columnID) const;
     // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
     void mergeStats(const std::vector<common::column_id_t>& columnIDs, const TableStats& stats) {
         nodeGroups->mergeStats(columnIDs, stats);
     }
+    // Replaces the committed stats, e.g. after recomputing them from a full scan. The table is
+    // marked as changed so that the new stats are persisted by the next checkpoint.
+    void setStats(TableStats stats) {
+        nodeGroups->setStats(std::move(stats));
+        setHasChanges();
+    }
 
     void serialize(common::Serializer& serializer) const override;
     void deserialize(main::ClientContext* context, StorageManager* storageManager,
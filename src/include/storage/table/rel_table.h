@@ -191,6 +191,11 @@ public:
     common::row_idx_t getNumTotalRows(const transaction::Transaction* transaction) override;
 
     RelTableData* getDirectedTableData(common::RelDataDirection direction) const;
+    // Returns empty stats if the table does not store rels in the given direction.
+    DegreeStats getDegreeStats(common::RelDataDirection direction) const;
+    void mergeDegreeStats(common::RelDataDirection direction, const DegreeStats& stats) const {
+        getDirectedTableData(direction)->mergeDegreeStats(stats);
+    }
 
     common::offset_t reserveRelOffsets(common::offset_t numRels) {
         std::unique_lock xLck{relOffsetMtx};
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <cmath>
+#include <mutex>
 
 #include "common/enums/rel_direction.h"
 #include "common/enums/rel_multiplicity.h"
+#include "storage/stats/degree_stats.h"
 #include "storage/table/column.h"
 #include "storage/table/csr_node_group.h"
 #include "storage/table/node_group_collection.h"
@@ -95,6 +97,16 @@ public:
     common::RelMultiplicity getMultiplicity() const { return multiplicity; }
 
     TableStats getStats() const { return nodeGroups->getStats(); }
+    DegreeStats getDegreeStats() const {
+        std::unique_lock lck{degreeStatsMtx};
+        return degreeStats.copy();
+    }
+    // Degrees are recomputed from the CSR headers on checkpoint. In between, e.g. after COPY into
+    // existing node groups, merged stats may count a node once per batch of rels.
+    void mergeDegreeStats(const DegreeStats& other) {
+        std::unique_lock lck{degreeStatsMtx};
+        degreeStats.merge(other);
+    }
 
     void reclaimStorage(PageAllocator& pageAllocator) const;
     void checkpoint(const std::vector<common::column_id_t>& columnIDs,
@@ -161,6 +173,9 @@ private:
 
     PersistentVersionRecordHandler persistentVersionRecordHandler;
     InMemoryVersionRecordHandler inMemoryVersionRecordHandler;
+
+    mutable std::mutex degreeStatsMtx;
+    DegreeStats degreeStats;
 };
 
 } // namespace storage
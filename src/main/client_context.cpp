@@ -3,6 +3,7 @@
 #include "binder/binder.h"
 #include "common/exception/checkpoint.h"
 #include "common/exception/connection.h"
+#include "common/exception/reoptimization.h"
 #include "common/exception/runtime.h"
 #include "common/file_system/virtual_file_system.h"
 #include "common/random_engine.h"
@@ -15,14 +16,19 @@
 #include "main/database.h"
 #include "main/database_manager.h"
 #include "main/db_config.h"
+#include "main/plan_cache.h"
+#include "main/query_result/streaming_query_result.h"
 #include "optimizer/optimizer.h"
 #include "parser/parser.h"
 #include "parser/visitor/standalone_call_rewriter.h"
 #include "parser/visitor/statement_read_write_analyzer.h"
+#include "planner/join_order/cardinality_feedback.h"
 #include "planner/planner.h"
+#include "processor/operator/streaming_result_collector.h"
 #include "processor/plan_mapper.h"
 #include "processor/processor.h"
 #include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/query_memory_tracker.h"
 #include "storage/buffer_manager/spiller.h"
 #include "storage/storage_manager.h"
 #include "transaction/transaction_context.h"
@@ -44,6 +50,10 @@ using namespace lbug::transaction;
 namespace lbug {
 namespace main {
 
+static constexpr const char* OPEN_STREAMING_RESULT_ERROR =
+    "Cannot execute a query while a streaming query result of this connection is still open. "
+    "Read all of its tuples or close it first.";
+
 ActiveQuery::ActiveQuery() : interrupted{false} {}
 
 void ActiveQuery::reset() {
@@ -56,6 +66,7 @@ ClientContext::ClientContext(Database* database) : localDatabase{database} {
     randomEngine = std::make_unique<RandomEngine>();
     remoteDatabase = nullptr;
     graphEntrySet = std::make_unique<graph::GraphEntrySet>();
+    cardinalityFeedback = std::make_unique<CardinalityFeedback>();
     clientConfig.homeDirectory = getUserHomeDir();
     clientConfig.fileSearchPath = "";
     clientConfig.enableSemiMask = ClientConfigDefault::ENABLE_SEMI_MASK;
@@ -70,11 +81,18 @@ ClientContext::ClientContext(Database* database) : localDatabase{database} {
         ClientConfigDefault::RECURSIVE_PATTERN_FACTOR;
     clientConfig.disableMapKeyCheck = ClientConfigDefault::DISABLE_MAP_KEY_CHECK;
     clientConfig.warningLimit = ClientConfigDefault::WARNING_LIMIT;
+    clientConfig.enablePlanCache = ClientConfigDefault::ENABLE_PLAN_CACHE;
     progressBar = std::make_unique<ProgressBar>(clientConfig.enableProgressBar);
     warningContext = std::make_unique<WarningContext>(&clientConfig);
 }
 
 ClientContext::~ClientContext() {
+    if (const auto streamingState = openStreamingState.lock()) {
+        // Abort a streaming query that is still running and wait until it releases the context.
+        streamingState->cancel();
+        interrupt();
+        lock_t lck{mtx};
+    }
     if (preventTransactionRollbackOnDestruction) {
         return;
     }
@@ -265,6 +283,10 @@ void ClientContext::cleanUp() {
 
 std::unique_ptr<PreparedStatement> ClientContext::prepareWithParams(std::string_view query,
     std::unordered_map<std::string, std::unique_ptr<Value>> inputParams) {
+    if (hasOpenStreamingResult()) {
+        return PreparedStatement::getPreparedStatementWithError(
+            ConnectionException(OPEN_STREAMING_RESULT_ERROR).what());
+    }
     std::unique_lock lck{mtx};
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
@@ -311,6 +333,10 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     std::unordered_map<std::string, std::unique_ptr<Value>> inputParams,
     std::optional<uint64_t> queryID) { // NOLINT(performance-unnecessary-value-param): It doesn't
     // make sense to pass the map as a const reference.
+    if (hasOpenStreamingResult()) {
+        return QueryResult::getQueryResultWithError(
+            ConnectionException(OPEN_STREAMING_RESULT_ERROR).what());
+    }
     lock_t lck{mtx};
     if (!preparedStatement->isSuccess()) {
         return QueryResult::getQueryResultWithError(preparedStatement->errMsg);
@@ -339,21 +365,78 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
 
 std::unique_ptr<QueryResult> ClientContext::query(std::string_view query,
     std::optional<uint64_t> queryID, QueryConfig config) {
+    if (hasOpenStreamingResult()) {
+        return QueryResult::getQueryResultWithError(
+            ConnectionException(OPEN_STREAMING_RESULT_ERROR).what());
+    }
     lock_t lck{mtx};
     return queryNoLock(query, queryID, config);
 }
 
+std::unique_ptr<QueryResult> ClientContext::queryAsStream(std::string_view query) {
+    if (hasOpenStreamingResult()) {
+        return QueryResult::getQueryResultWithError(
+            ConnectionException(OPEN_STREAMING_RESULT_ERROR).what());
+    }
+    auto runQuery = [this](std::string query,
+                        std::shared_ptr<StreamingResultSharedState> streamingState) {
+        std::unique_ptr<QueryResult> result;
+        {
+            lock_t lck{mtx};
+            try {
+                result = queryNoLock(query, std::nullopt, QueryConfig{streamingState});
+            } catch (std::exception& e) {
+                result = QueryResult::getQueryResultWithError(e.what());
+            }
+        }
+        if (result == nullptr) {
+            result = QueryResult::getQueryResultWithError(
+                ConnectionException("Query does not produce a result to stream.").what());
+        }
+        streamingState->finish(std::move(result));
+    };
+#ifndef __SINGLE_THREADED__
+    auto streamingState = std::make_shared<StreamingResultSharedState>();
+    openStreamingState = streamingState;
+    auto producer = std::thread(runQuery, std::string(query), streamingState);
+    if (!streamingState->waitForHeader()) {
+        producer.join();
+        return streamingState->moveFinalResult();
+    }
+    return std::make_unique<StreamingQueryResult>(std::move(streamingState), std::move(producer));
+#else
+    // Without background threads the query runs to completion before the result is returned, so
+    // the queue cannot be bounded.
+    auto streamingState = std::make_shared<StreamingResultSharedState>(UINT64_MAX);
+    runQuery(std::string(query), streamingState);
+    if (!streamingState->waitForHeader()) {
+        return streamingState->moveFinalResult();
+    }
+    return std::make_unique<StreamingQueryResult>(std::move(streamingState));
+#endif
+}
+
 std::unique_ptr<QueryResult> ClientContext::queryNoLock(std::string_view query,
     std::optional<uint64_t> queryID, QueryConfig config) {
+    if (clientConfig.enablePlanCache) {
+        if (auto queryResult = queryWithPlanCacheNoLock(query, queryID, config)) {
+            return queryResult;
+        }
+    }
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
         parsedStatements = parseQuery(query);
     } catch (std::exception& exception) {
         return QueryResult::getQueryResultWithError(exception.what());
     }
+    if (config.resultType == QueryResultType::STREAM && parsedStatements.size() > 1) {
+        return QueryResult::getQueryResultWithError(
+            ConnectionException("Streaming query results do not support multiple statements.")
+                .what());
+    }
     std::unique_ptr<QueryResult> queryResult;
     QueryResult* lastResult = nullptr;
-    double internalCompilingTime = 0.0, internalExecutionTime = 0.0;
+    double internalCompilingTime = 0.0, internalPlanningTime = 0.0, internalExecutionTime = 0.0;
     for (const auto& statement : parsedStatements) {
         auto [preparedStatement, cachedStatement] =
             prepareNoLock(statement, false /*shouldCommitNewTransaction*/);
@@ -372,10 +455,12 @@ std::unique_ptr<QueryResult> ClientContext::queryNoLock(std::string_view query,
             // The result of internal statements should be invisible to end users. Skip chaining the
             // result of internal statements to the final result to end users.
             internalCompilingTime += currentQuerySummary->getCompilingTime();
+            internalPlanningTime += currentQuerySummary->getPlanningTime();
             internalExecutionTime += currentQuerySummary->getExecutionTime();
             continue;
         }
         currentQuerySummary->incrementCompilingTime(internalCompilingTime);
+        currentQuerySummary->incrementPlanningTime(internalPlanningTime);
         currentQuerySummary->incrementExecutionTime(internalExecutionTime);
         if (!lastResult) {
             // first result of the query
@@ -391,6 +476,70 @@ std::unique_ptr<QueryResult> ClientContext::queryNoLock(std::string_view query,
     return queryResult;
 }
 
+static bool hasParameterColumn(const CachedPreparedStatement& cachedStatement) {
+    const auto prefix = std::string("$") + NormalizedQuery::PARAMETER_PREFIX;
+    for (auto& columnName : cachedStatement.getColumnNames()) {
+        if (columnName.find(prefix) != std::string::npos) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::unique_ptr<QueryResult> ClientContext::queryWithPlanCacheNoLock(std::string_view query,
+    std::optional<uint64_t> queryID, QueryConfig config) {
+    auto normalizedQuery = NormalizedQuery::normalize(query);
+    if (!normalizedQuery.has_value()) {
+        return nullptr;
+    }
+    auto planCache = PlanCache::Get(*this);
+    const auto key = PlanCache::getKey(*this, *normalizedQuery);
+    auto parsedStatement = planCache->lookup(key);
+    if (parsedStatement.has_value() && *parsedStatement == nullptr) {
+        return nullptr;
+    }
+    const auto isHit = parsedStatement.has_value();
+    std::shared_ptr<Statement> statement;
+    if (isHit) {
+        statement = *parsedStatement;
+    } else {
+        auto parserTimer = TimeMetric(true /*enable*/);
+        parserTimer.start();
+        try {
+            auto statements = Parser::parseQuery(normalizedQuery->text,
+                localDatabase->getTransformerExtensions());
+            if (statements.size() == 1 &&
+                statements[0]->getStatementType() == StatementType::QUERY) {
+                statement = std::move(statements[0]);
+            }
+        } catch (std::exception&) {} // NOLINT(bugprone-empty-catch): Parsed again as usual.
+        parserTimer.stop();
+        if (statement == nullptr) {
+            planCache->insert(key, nullptr);
+            return nullptr;
+        }
+        statement->setParsingTime(parserTimer.getElapsedTimeMS());
+    }
+    auto [preparedStatement, cachedStatement] = prepareNoLock(statement,
+        false /*shouldCommitNewTransaction*/, std::move(normalizedQuery->parameters));
+    useInternalCatalogEntry_ = false;
+    // Errors are reported for the original query text instead.
+    if (!preparedStatement->isSuccess()) {
+        return nullptr;
+    }
+    if (isHit) {
+        planCache->incrementNumHits();
+    } else if (hasParameterColumn(*cachedStatement)) {
+        // E.g. RETURN a.age > 30 would name its column a.age > $__lit0.
+        planCache->insert(key, nullptr);
+        return nullptr;
+    } else {
+        planCache->insert(key, statement);
+        planCache->incrementNumMisses();
+    }
+    return executeNoLock(preparedStatement.get(), cachedStatement.get(), queryID, config);
+}
+
 std::vector<std::shared_ptr<Statement>> ClientContext::parseQuery(std::string_view query) {
     if (query.empty()) {
         throw ConnectionException("Query is empty.");
@@ -468,9 +617,14 @@ ClientContext::PrepareResult ClientContext::prepareNoLock(
                 preparedStatement->unknownParameters = expressionBinder->getUnknownParameters();
                 preparedStatement->parameterMap = expressionBinder->getKnownParameters();
                 cachedStatement->columns = boundStatement->getStatementResult()->getColumns();
+                auto planningTimer = TimeMetric(true /* enable */);
+                planningTimer.start();
                 auto planner = Planner(this);
                 auto bestPlan = planner.planStatement(*boundStatement);
                 optimizer::Optimizer::optimize(&bestPlan, this, planner.getCardinalityEstimator());
+                planningTimer.stop();
+                preparedStatement->preparedSummary.planningTime =
+                    planningTimer.getElapsedTimeMS();
                 cachedStatement->logicalPlan = std::make_unique<LogicalPlan>(std::move(bestPlan));
             },
             preparedStatement->isReadOnly(),
@@ -490,12 +644,63 @@ ClientContext::PrepareResult ClientContext::prepareNoLock(
 std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* preparedStatement,
     CachedPreparedStatement* cachedStatement, std::optional<uint64_t> queryID,
     QueryConfig queryConfig) {
+    const auto feedback = CardinalityFeedback::Get(*this);
+    feedback->clear();
+    // Statement re-planned with the cardinalities observed by previous attempts.
+    PrepareResult replanned;
+    std::unique_ptr<QueryResult> result;
+    while (true) {
+        feedback->setCanReoptimize(canReoptimize(*preparedStatement, queryConfig));
+        try {
+            result = executePlanNoLock(preparedStatement, cachedStatement, queryID, queryConfig);
+            break;
+        } catch (ReoptimizationException&) {
+            // The failed attempt has been rolled back. Plan the statement again, which picks up
+            // the observed cardinalities, and restart it.
+            const auto memoryManager = storage::MemoryManager::Get(*this);
+            memoryManager->getBufferManager()->getSpillerOrSkip(
+                [](auto& spiller) { spiller.clearFile(); });
+            if (queryID.has_value()) {
+                progressBar->endProgress(queryID.value());
+            }
+            feedback->incrementNumReoptimizations();
+            replanned = prepareNoLock(cachedStatement->parsedStatement,
+                false /*shouldCommitNewTransaction*/, preparedStatement->parameterMap);
+            preparedStatement = replanned.preparedStatement.get();
+            cachedStatement = replanned.cachedPreparedStatement.get();
+        }
+    }
+    feedback->clear();
+    return result;
+}
+
+// Restarting a query is only possible if it has neither written anything nor handed out results,
+// and if rolling back the failed attempt does not affect a transaction started by the user.
+bool ClientContext::canReoptimize(const PreparedStatement& preparedStatement,
+    const QueryConfig& config) const {
+    return clientConfig.reoptimizationThreshold != 0 && preparedStatement.isReadOnly() &&
+           preparedStatement.getStatementType() == StatementType::QUERY &&
+           config.resultType != QueryResultType::STREAM &&
+           transactionContext->isAutoTransaction() && !transactionContext->hasActiveTransaction() &&
+           CardinalityFeedback::Get(*this)->getNumReoptimizations() <
+               CardinalityFeedback::MAX_NUM_REOPTIMIZATIONS;
+}
+
+std::unique_ptr<QueryResult> ClientContext::executePlanNoLock(PreparedStatement* preparedStatement,
+    CachedPreparedStatement* cachedStatement, std::optional<uint64_t>& queryID,
+    const QueryConfig& queryConfig) {
     if (!preparedStatement->isSuccess()) {
         return QueryResult::getQueryResultWithError(preparedStatement->errMsg);
     }
     useInternalCatalogEntry_ = cachedStatement->useInternalCatalogEntry;
     this->resetActiveQuery();
+    activeQuery.memoryTracker =
+        std::make_shared<storage::QueryMemoryTracker>(clientConfig.queryMemoryLimit);
     this->startTimer();
+    if (queryConfig.streamingState) {
+        queryConfig.streamingState->setHeader(cachedStatement->getColumnNames(),
+            cachedStatement->getColumnTypes());
+    }
     auto executingTimer = TimeMetric(true /* enable */);
     executingTimer.start();
     std::unique_ptr<QueryResult> result;
@@ -514,7 +719,8 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
                     std::make_unique<ExecutionContext>(profiler.get(), this, *queryID);
                 auto mapper = PlanMapper(executionContext.get());
                 const auto physicalPlan = mapper.getPhysicalPlan(cachedStatement->logicalPlan.get(),
-                    cachedStatement->columns, queryConfig.resultType, queryConfig.arrowConfig);
+                    cachedStatement->columns, queryConfig.resultType, queryConfig.arrowConfig,
+                    queryConfig.streamingState);
                 if (isTransactionStatement) {
                     result = localDatabase->queryProcessor->execute(physicalPlan.get(),
                         executionContext.get());
@@ -530,6 +736,8 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
             preparedStatement->isReadOnly(), isTransactionStatement,
             TransactionHelper::getAction(true /*shouldCommitNewTransaction*/,
                 !isTransactionStatement /*shouldCommitAutoTransaction*/));
+    } catch (ReoptimizationException&) {
+        throw;
     } catch (std::exception& e) {
         useInternalCatalogEntry_ = false;
         return handleFailedExecution(queryID, e);
@@ -541,6 +749,7 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
     result->setColumnTypes(cachedStatement->getColumnTypes());
     auto summary = std::make_unique<QuerySummary>(preparedStatement->preparedSummary);
     summary->setExecutionTime(executingTimer.getElapsedTimeMS());
+    summary->setPeakMemoryUsage(activeQuery.memoryTracker->getPeakMemory());
     result->setQuerySummary(std::move(summary));
     return result;
 }
@@ -595,6 +804,11 @@ void ClientContext::TransactionHelper::runFuncInTransaction(TransactionContext&
     }
 }
 
+bool ClientContext::hasOpenStreamingResult() const {
+    const auto streamingState = openStreamingState.lock();
+    return streamingState != nullptr && !streamingState->isFinished();
+}
+
 bool ClientContext::canExecuteWriteQuery() const {
     if (getDBConfig()->readOnly) {
         return false;
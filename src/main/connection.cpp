@@ -61,6 +61,13 @@ std::unique_ptr<QueryResult> Connection::queryAsArrow(std::string_view query, in
     return queryResult;
 }
 
+std::unique_ptr<QueryResult> Connection::queryAsStream(std::string_view query) {
+    dbLifeCycleManager->checkDatabaseClosedOrThrow();
+    auto queryResult = clientContext->queryAsStream(query);
+    queryResult->setDBLifeCycleManager(dbLifeCycleManager);
+    return queryResult;
+}
+
 std::unique_ptr<QueryResult> Connection::queryWithID(std::string_view queryStatement,
     uint64_t queryID) {
     dbLifeCycleManager->checkDatabaseClosedOrThrow();
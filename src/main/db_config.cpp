@@ -22,7 +22,12 @@ static ConfigurationOption options[] = { // NOLINT(cert-err58-cpp):
     GET_CONFIGURATION(RecursivePatternFactorSetting), GET_CONFIGURATION(EnableMVCCSetting),
     GET_CONFIGURATION(CheckpointThresholdSetting), GET_CONFIGURATION(AutoCheckpointSetting),
     GET_CONFIGURATION(ForceCheckpointClosingDBSetting), GET_CONFIGURATION(SpillToDiskSetting),
-    GET_CONFIGURATION(EnableOptimizerSetting), GET_CONFIGURATION(EnableInternalCatalogSetting)};
+    GET_CONFIGURATION(EnableOptimizerSetting), GET_CONFIGURATION(EnableInternalCatalogSetting),
+    GET_CONFIGURATION(QueryPrioritySetting), GET_CONFIGURATION(QueryMemoryLimitSetting),
+    GET_CONFIGURATION(JoinOrderDPThresholdSetting),
+    GET_CONFIGURATION(ReoptimizationThresholdSetting), GET_CONFIGURATION(EnablePlanCacheSetting),
+    GET_CONFIGURATION(WSPDeltaSetting), GET_CONFIGURATION(CacheProjectedGraphsSetting),
+    GET_CONFIGURATION(ShortestPathLandmarksSetting)};
 
 DBConfig::DBConfig(const SystemConfig& systemConfig)
     : bufferPoolSize{systemConfig.bufferPoolSize}, maxNumThreads{systemConfig.maxNumThreads},
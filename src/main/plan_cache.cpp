@@ -0,0 +1,345 @@
+#include "main/plan_cache.h"
+
+#include <array>
+
+#include "catalog/catalog.h"
+#include "common/string_utils.h"
+#include "function/cast/functions/cast_from_string_functions.h"
+#include "main/client_context.h"
+#include "main/database.h"
+
+using namespace lbug::common;
+
+namespace lbug {
+namespace main {
+
+namespace {
+
+enum class TokenType : uint8_t {
+    IDENTIFIER,
+    INTEGER,
+    DECIMAL,
+    STRING,
+    // A string literal with escape sequences, which is left to the parser.
+    ESCAPED_STRING,
+    SYMBOL,
+    QUOTED_IDENTIFIER,
+};
+
+struct Token {
+    TokenType type;
+    uint64_t start;
+    uint64_t end;
+};
+
+// Splits a query into tokens, skipping whitespace and comments. Returns nullopt for anything the
+// normalizer does not understand, so that such queries are left alone.
+class Tokenizer {
+public:
+    explicit Tokenizer(std::string_view query) : query{query} {}
+
+    std::optional<std::vector<Token>> tokenize() {
+        std::vector<Token> tokens;
+        while (true) {
+            skipWhitespaceAndComments();
+            if (pos >= query.size()) {
+                return tokens;
+            }
+            const auto start = pos;
+            const auto c = query[pos];
+            TokenType type{};
+            if (isIdentifierStart(c)) {
+                while (pos < query.size() && isIdentifierPart(query[pos])) {
+                    pos++;
+                }
+                type = TokenType::IDENTIFIER;
+            } else if (isDigit(c)) {
+                type = TokenType::INTEGER;
+                skipDigits();
+                if (pos + 1 < query.size() && query[pos] == '.' && isDigit(query[pos + 1])) {
+                    pos++;
+                    skipDigits();
+                    type = TokenType::DECIMAL;
+                }
+                // Exponents, hexadecimal literals etc.
+                if (pos < query.size() && isIdentifierPart(query[pos])) {
+                    return std::nullopt;
+                }
+            } else if (c == '\'' || c == '"') {
+                if (!skipString(c, type)) {
+                    return std::nullopt;
+                }
+            } else if (c == '`') {
+                pos = query.find('`', pos + 1);
+                if (pos == std::string_view::npos) {
+                    return std::nullopt;
+                }
+                pos++;
+                type = TokenType::QUOTED_IDENTIFIER;
+            } else if (c == '$') {
+                return std::nullopt;
+            } else {
+                pos += getSymbolLength();
+                type = TokenType::SYMBOL;
+            }
+            tokens.push_back({type, start, pos});
+        }
+    }
+
+private:
+    static bool isDigit(char c) { return c >= '0' && c <= '9'; }
+    static bool isIdentifierStart(char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' ||
+               static_cast<uint8_t>(c) >= 0x80;
+    }
+    static bool isIdentifierPart(char c) { return isIdentifierStart(c) || isDigit(c); }
+
+    void skipDigits() {
+        while (pos < query.size() && isDigit(query[pos])) {
+            pos++;
+        }
+    }
+
+    void skipWhitespaceAndComments() {
+        while (pos < query.size()) {
+            if (StringUtils::isSpace(query[pos])) {
+                pos++;
+            } else if (query.substr(pos, 2) == "//") {
+                pos = std::min(query.find('\n', pos), query.size());
+            } else if (query.substr(pos, 2) == "/*") {
+                const auto end = query.find("*/", pos + 2);
+                pos = end == std::string_view::npos ? query.size() : end + 2;
+            } else {
+                return;
+            }
+        }
+    }
+
+    bool skipString(char quote, TokenType& type) {
+        type = TokenType::STRING;
+        pos++;
+        while (pos < query.size() && query[pos] != quote) {
+            if (query[pos] == '\\') {
+                type = TokenType::ESCAPED_STRING;
+                pos++;
+            }
+            pos++;
+        }
+        if (pos >= query.size()) {
+            return false;
+        }
+        pos++;
+        return true;
+    }
+
+    uint64_t getSymbolLength() const {
+        static constexpr std::array<std::string_view, 8> multiCharSymbols = {"<>", "<=", ">=",
+            "!=", "=~", "..", "->", "<-"};
+        for (auto& symbol : multiCharSymbols) {
+            if (query.substr(pos, symbol.size()) == symbol) {
+                return symbol.size();
+            }
+        }
+        return 1;
+    }
+
+private:
+    std::string_view query;
+    uint64_t pos = 0;
+};
+
+class Normalizer {
+public:
+    Normalizer(std::string_view query, std::vector<Token> tokens)
+        : query{query}, tokens{std::move(tokens)} {}
+
+    std::optional<NormalizedQuery> normalize() {
+        for (auto& token : tokens) {
+            if (token.type == TokenType::IDENTIFIER && (isKeyword(token, "LOAD") ||
+                                                           isKeyword(token, "CALL"))) {
+                // Table functions and LOAD FROM require their arguments and options to be
+                // literals.
+                return std::nullopt;
+            }
+        }
+        NormalizedQuery result;
+        uint64_t copiedUntil = 0;
+        // For each open bracket, whether it opens the list of an IN expression.
+        std::vector<std::pair<char, bool>> openBrackets;
+        for (auto i = 0u; i < tokens.size(); i++) {
+            auto& token = tokens[i];
+            if (token.type == TokenType::SYMBOL) {
+                const auto c = query[token.start];
+                if (c == '(' || c == '[' || c == '{') {
+                    const auto isInList = c == '[' && i > 0 && isKeyword(tokens[i - 1], "IN");
+                    openBrackets.emplace_back(c, isInList);
+                } else if ((c == ')' || c == ']' || c == '}') && !openBrackets.empty()) {
+                    openBrackets.pop_back();
+                }
+                continue;
+            }
+            if (!isReplaceable(i, openBrackets)) {
+                continue;
+            }
+            auto value = getValue(token);
+            if (value == nullptr) {
+                continue;
+            }
+            const auto name = std::string(NormalizedQuery::PARAMETER_PREFIX) +
+                              std::to_string(result.parameters.size());
+            result.text += query.substr(copiedUntil, token.start - copiedUntil);
+            result.text += "$" + name;
+            copiedUntil = token.end;
+            result.parameters.emplace(name, std::move(value));
+        }
+        if (result.parameters.empty()) {
+            return std::nullopt;
+        }
+        result.text += query.substr(copiedUntil);
+        return result;
+    }
+
+private:
+    std::string_view getText(const Token& token) const {
+        return query.substr(token.start, token.end - token.start);
+    }
+
+    bool isKeyword(const Token& token, std::string_view keyword) const {
+        return token.type == TokenType::IDENTIFIER &&
+               StringUtils::caseInsensitiveEquals(getText(token), keyword);
+    }
+
+    bool isSymbol(uint64_t idx, std::string_view symbol) const {
+        return idx < tokens.size() && tokens[idx].type == TokenType::SYMBOL &&
+               getText(tokens[idx]) == symbol;
+    }
+
+    bool isComparison(uint64_t idx) const {
+        return isSymbol(idx, "=") || isSymbol(idx, "<>") || isSymbol(idx, "!=") ||
+               isSymbol(idx, "<") || isSymbol(idx, "<=") || isSymbol(idx, ">") ||
+               isSymbol(idx, ">=");
+    }
+
+    bool startsPredicate(uint64_t idx) const {
+        if (isSymbol(idx, "(")) {
+            return true;
+        }
+        auto& token = tokens[idx];
+        return isKeyword(token, "WHERE") || isKeyword(token, "AND") || isKeyword(token, "OR") ||
+               isKeyword(token, "XOR") || isKeyword(token, "NOT");
+    }
+
+    // A literal is only replaced if it is known to be bound as a plain operand, e.g. not as a
+    // result column, a function option or a bound of a recursive pattern.
+    bool isReplaceable(uint64_t idx, const std::vector<std::pair<char, bool>>& openBrackets) const {
+        if (idx == 0) {
+            return false;
+        }
+        // a.x = 5, a.x < 5 ...
+        if (isComparison(idx - 1)) {
+            return true;
+        }
+        // WHERE 5 < a.x ...
+        if (isComparison(idx + 1) && startsPredicate(idx - 1)) {
+            return true;
+        }
+        if (openBrackets.empty()) {
+            return false;
+        }
+        const auto [bracket, isInList] = openBrackets.back();
+        // a.x IN [1, 2, 3]
+        if (isInList) {
+            return (isSymbol(idx - 1, "[") || isSymbol(idx - 1, ",")) &&
+                   (isSymbol(idx + 1, "]") || isSymbol(idx + 1, ","));
+        }
+        // (a:person {age: 5})
+        return bracket == '{' && (isSymbol(idx + 1, "}") || isSymbol(idx + 1, ",")) && idx >= 3 &&
+               isSymbol(idx - 1, ":") &&
+               tokens[idx - 2].type == TokenType::IDENTIFIER &&
+               (isSymbol(idx - 3, "{") || isSymbol(idx - 3, ","));
+    }
+
+    std::shared_ptr<Value> getValue(const Token& token) const {
+        auto text = getText(token);
+        switch (token.type) {
+        case TokenType::INTEGER: {
+            ku_string_t literal{text.data(), text.size()};
+            int64_t result = 0;
+            if (!function::CastString::tryCast(literal, result)) {
+                return nullptr;
+            }
+            return std::make_shared<Value>(result);
+        }
+        case TokenType::DECIMAL: {
+            ku_string_t literal{text.data(), text.size()};
+            double result = 0;
+            function::CastString::operation(literal, result);
+            return std::make_shared<Value>(result);
+        }
+        case TokenType::STRING: {
+            return std::make_shared<Value>(LogicalType::STRING(),
+                std::string(text.substr(1, text.size() - 2)));
+        }
+        default:
+            return nullptr;
+        }
+    }
+
+private:
+    std::string_view query;
+    std::vector<Token> tokens;
+};
+
+} // namespace
+
+std::optional<NormalizedQuery> NormalizedQuery::normalize(std::string_view query) {
+    auto tokens = Tokenizer{query}.tokenize();
+    if (!tokens.has_value()) {
+        return std::nullopt;
+    }
+    return Normalizer{query, std::move(*tokens)}.normalize();
+}
+
+std::optional<std::shared_ptr<parser::Statement>> PlanCache::lookup(const std::string& key) {
+    std::unique_lock lck{mtx};
+    auto it = keyToEntry.find(key);
+    if (it == keyToEntry.end()) {
+        return std::nullopt;
+    }
+    entries.splice(entries.begin(), entries, it->second);
+    return it->second->second;
+}
+
+void PlanCache::insert(const std::string& key, std::shared_ptr<parser::Statement> statement) {
+    std::unique_lock lck{mtx};
+    auto it = keyToEntry.find(key);
+    if (it != keyToEntry.end()) {
+        it->second->second = std::move(statement);
+        entries.splice(entries.begin(), entries, it->second);
+        return;
+    }
+    entries.emplace_front(key, std::move(statement));
+    keyToEntry.emplace(key, entries.begin());
+    if (entries.size() > CAPACITY) {
+        keyToEntry.erase(entries.back().first);
+        entries.pop_back();
+    }
+}
+
+uint64_t PlanCache::getNumEntries() const {
+    std::unique_lock lck{mtx};
+    return entries.size();
+}
+
+std::string PlanCache::getKey(const ClientContext& context, const NormalizedQuery& query) {
+    const auto catalog = catalog::Catalog::Get(context);
+    return query.text + '\0' + std::to_string(reinterpret_cast<uintptr_t>(catalog)) + ':' +
+           std::to_string(catalog->getVersion());
+}
+
+PlanCache* PlanCache::Get(const ClientContext& context) {
+    return context.getDatabase()->getPlanCache();
+}
+
+} // namespace main
+} // namespace lbug
@@ -1,5 +1,7 @@
 #include "main/query_result.h"
 
+#include <cerrno>
+
 #include "common/arrow/arrow_converter.h"
 #include "main/query_result/materialized_query_result.h"
 #include "processor/result/flat_tuple.h"
@@ -83,6 +85,68 @@ std::unique_ptr<ArrowSchema> QueryResult::getArrowSchema() const {
         false /* fallbackExtensionTypes */);
 }
 
+namespace {
+
+struct ArrowArrayStreamData {
+    QueryResult* result;
+    int64_t chunkSize;
+    std::string lastError;
+
+    ArrowArrayStreamData(QueryResult* result, int64_t chunkSize)
+        : result{result}, chunkSize{chunkSize} {}
+};
+
+} // namespace
+
+static int getArrowStreamSchema(ArrowArrayStream* stream, ArrowSchema* out) {
+    auto data = static_cast<ArrowArrayStreamData*>(stream->private_data);
+    try {
+        *out = *data->result->getArrowSchema();
+    } catch (std::exception& e) {
+        data->lastError = e.what();
+        return EIO;
+    }
+    return 0;
+}
+
+static int getArrowStreamNext(ArrowArrayStream* stream, ArrowArray* out) {
+    auto data = static_cast<ArrowArrayStreamData*>(stream->private_data);
+    try {
+        if (!data->result->hasNextArrowChunk()) {
+            // Marks the end of the stream.
+            out->release = nullptr;
+            return 0;
+        }
+        *out = *data->result->getNextArrowChunk(data->chunkSize);
+    } catch (std::exception& e) {
+        data->lastError = e.what();
+        return EIO;
+    }
+    return 0;
+}
+
+static const char* getArrowStreamLastError(ArrowArrayStream* stream) {
+    auto data = static_cast<ArrowArrayStreamData*>(stream->private_data);
+    return data->lastError.empty() ? nullptr : data->lastError.c_str();
+}
+
+static void releaseArrowStream(ArrowArrayStream* stream) {
+    delete static_cast<ArrowArrayStreamData*>(stream->private_data);
+    stream->release = nullptr;
+}
+
+std::unique_ptr<ArrowArrayStream> QueryResult::getArrowArrayStream(int64_t chunkSize) {
+    checkDatabaseClosedOrThrow();
+    validateQuerySucceed();
+    auto stream = std::make_unique<ArrowArrayStream>();
+    stream->get_schema = getArrowStreamSchema;
+    stream->get_next = getArrowStreamNext;
+    stream->get_last_error = getArrowStreamLastError;
+    stream->release = releaseArrowStream;
+    stream->private_data = new ArrowArrayStreamData(this, chunkSize);
+    return stream;
+}
+
 void QueryResult::validateQuerySucceed() const {
     if (!success) {
         throw Exception(errMsg);
@@ -110,6 +174,10 @@ void QueryResult::setQuerySummary(std::unique_ptr<QuerySummary> summary) {
     querySummary = std::move(summary);
 }
 
+std::unique_ptr<QuerySummary> QueryResult::moveQuerySummary() {
+    return std::move(querySummary);
+}
+
 void QueryResult::setDBLifeCycleManager(
     std::shared_ptr<DatabaseLifeCycleManager> dbLifeCycleManager) {
     this->dbLifeCycleManager = dbLifeCycleManager;
@@ -28,6 +28,15 @@ ArrowQueryResult::ArrowQueryResult(std::vector<std::string> columnNames,
     }
 }
 
+ArrowQueryResult::~ArrowQueryResult() {
+    // Release the arrays that have not been handed over to the caller.
+    for (auto& array : arrays) {
+        if (array.release != nullptr) {
+            array.release(&array);
+        }
+    }
+}
+
 uint64_t ArrowQueryResult::getNumTuples() const {
     return numTuples;
 }
@@ -75,7 +84,10 @@ std::unique_ptr<ArrowArray> ArrowQueryResult::getNextArrowChunk(int64_t chunkSiz
         throw RuntimeException(
             std::format("Chunk size does not match expected value {}.", chunkSize_));
     }
-    return std::make_unique<ArrowArray>(arrays[cursor++]);
+    auto array = std::make_unique<ArrowArray>(arrays[cursor]);
+    // The caller owns the array from now on.
+    arrays[cursor++].release = nullptr;
+    return array;
 }
 
 } // namespace main
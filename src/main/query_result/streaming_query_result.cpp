@@ -0,0 +1,149 @@
+#include "main/query_result/streaming_query_result.h"
+
+#include "common/arrow/arrow_row_batch.h"
+#include "common/exception/runtime.h"
+#include "processor/operator/streaming_result_collector.h"
+#include "processor/result/factorized_table.h"
+#include "processor/result/flat_tuple.h"
+
+using namespace lbug::common;
+using namespace lbug::processor;
+
+namespace lbug {
+namespace main {
+
+#ifndef __SINGLE_THREADED__
+StreamingQueryResult::StreamingQueryResult(std::shared_ptr<StreamingResultSharedState> sharedState,
+    std::thread producer)
+    : QueryResult{type_, sharedState->getColumnNames(), sharedState->getColumnTypes()},
+      sharedState{std::move(sharedState)}, producer{std::move(producer)}, streamFinished{false},
+      numTuplesRead{0} {}
+#else
+StreamingQueryResult::StreamingQueryResult(std::shared_ptr<StreamingResultSharedState> sharedState)
+    : QueryResult{type_, sharedState->getColumnNames(), sharedState->getColumnTypes()},
+      sharedState{std::move(sharedState)}, streamFinished{false}, numTuplesRead{0} {}
+#endif
+
+StreamingQueryResult::~StreamingQueryResult() {
+    // Abort the query if the result is closed before the stream is drained.
+    sharedState->cancel();
+#ifndef __SINGLE_THREADED__
+    if (producer.joinable()) {
+        producer.join();
+    }
+#endif
+    if (dbLifeCycleManager && currentBatch) {
+        currentBatch->setPreventDestruction(dbLifeCycleManager->isDatabaseClosed);
+    }
+}
+
+uint64_t StreamingQueryResult::getNumTuples() const {
+    checkDatabaseClosedOrThrow();
+    validateQuerySucceed();
+    if (!streamFinished) {
+        throw RuntimeException("The number of tuples of a streaming QueryResult is only known "
+                               "after all tuples have been read.");
+    }
+    return numTuplesRead;
+}
+
+bool StreamingQueryResult::hasNext() const {
+    checkDatabaseClosedOrThrow();
+    validateQuerySucceed();
+    // Pulling the next batch changes the state of the result but not the tuples it represents.
+    auto hasNext = const_cast<StreamingQueryResult*>(this)->advance();
+    validateQuerySucceed();
+    return hasNext;
+}
+
+std::shared_ptr<FlatTuple> StreamingQueryResult::getNext() {
+    if (!hasNext()) {
+        throw RuntimeException(
+            "No more tuples in QueryResult, Please check hasNext() before calling getNext().");
+    }
+    iterator->getNext(*tuple);
+    numTuplesRead++;
+    return tuple;
+}
+
+void StreamingQueryResult::resetIterator() {
+    throw RuntimeException("Cannot reset the iterator of a streaming QueryResult.");
+}
+
+std::string StreamingQueryResult::toString() const {
+    checkDatabaseClosedOrThrow();
+    if (!isSuccess()) {
+        return errMsg;
+    }
+    std::string result;
+    for (auto i = 0u; i < columnNames.size(); ++i) {
+        if (i != 0) {
+            result += "|";
+        }
+        result += columnNames[i];
+    }
+    result += "\n";
+    auto mutableResult = const_cast<StreamingQueryResult*>(this);
+    while (mutableResult->hasNext()) {
+        result += mutableResult->getNext()->toString();
+    }
+    return result;
+}
+
+bool StreamingQueryResult::hasNextArrowChunk() {
+    return hasNext();
+}
+
+std::unique_ptr<ArrowArray> StreamingQueryResult::getNextArrowChunk(int64_t chunkSize) {
+    checkDatabaseClosedOrThrow();
+    auto rowBatch =
+        std::make_unique<ArrowRowBatch>(columnTypes, chunkSize, false /* fallbackExtensionTypes */);
+    auto rowBatchSize = 0u;
+    while (rowBatchSize < chunkSize) {
+        if (!hasNext()) {
+            break;
+        }
+        rowBatch->append(*getNext());
+        rowBatchSize++;
+    }
+    return std::make_unique<ArrowArray>(rowBatch->toArray(columnTypes));
+}
+
+bool StreamingQueryResult::advance() {
+    while (iterator == nullptr || !iterator->hasNext()) {
+        if (streamFinished) {
+            return false;
+        }
+        // Release the consumed batch before blocking on the next one.
+        iterator = nullptr;
+        currentBatch = sharedState->pop();
+        if (currentBatch == nullptr) {
+            finishStream();
+            return false;
+        }
+        iterator = std::make_unique<FactorizedTableIterator>(*currentBatch);
+    }
+    return true;
+}
+
+void StreamingQueryResult::finishStream() {
+    streamFinished = true;
+#ifndef __SINGLE_THREADED__
+    if (producer.joinable()) {
+        producer.join();
+    }
+#endif
+    auto finalResult = sharedState->moveFinalResult();
+    if (finalResult == nullptr) {
+        return;
+    }
+    if (!finalResult->isSuccess()) {
+        success = false;
+        errMsg = finalResult->getErrorMessage();
+        return;
+    }
+    setQuerySummary(finalResult->moveQuerySummary());
+}
+
+} // namespace main
+} // namespace lbug
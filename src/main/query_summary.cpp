@@ -11,18 +11,34 @@ double QuerySummary::getCompilingTime() const {
     return preparedSummary.compilingTime;
 }
 
+double QuerySummary::getPlanningTime() const {
+    return preparedSummary.planningTime;
+}
+
 double QuerySummary::getExecutionTime() const {
     return executionTime;
 }
 
+uint64_t QuerySummary::getPeakMemoryUsage() const {
+    return peakMemoryUsage;
+}
+
 void QuerySummary::setExecutionTime(double time) {
     executionTime = time;
 }
 
+void QuerySummary::setPeakMemoryUsage(uint64_t peakMemoryUsage_) {
+    peakMemoryUsage = peakMemoryUsage_;
+}
+
 void QuerySummary::incrementCompilingTime(double increment) {
     preparedSummary.compilingTime += increment;
 }
 
+void QuerySummary::incrementPlanningTime(double increment) {
+    preparedSummary.planningTime += increment;
+}
+
 void QuerySummary::incrementExecutionTime(double increment) {
     executionTime += increment;
 }
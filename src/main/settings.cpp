@@ -20,6 +20,17 @@ common::Value ThreadsSetting::getSetting(const ClientContext* context) {
     return common::Value(context->getClientConfig()->numThreads);
 }
 
+void QueryPrioritySetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getClientConfigUnsafe()->queryPriority =
+        common::TaskPriorityUtils::fromString(parameter.getValue<std::string>());
+}
+
+common::Value QueryPrioritySetting::getSetting(const ClientContext* context) {
+    return common::Value::createValue(
+        common::TaskPriorityUtils::toString(context->getClientConfig()->queryPriority));
+}
+
 void WarningLimitSetting::setContext(ClientContext* context, const common::Value& parameter) {
     parameter.validateType(inputType);
     context->getClientConfigUnsafe()->warningLimit = parameter.getValue<uint64_t>();
@@ -38,6 +49,45 @@ common::Value TimeoutSetting::getSetting(const ClientContext* context) {
     return common::Value(context->getClientConfig()->timeoutInMS);
 }
 
+void QueryMemoryLimitSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getClientConfigUnsafe()->queryMemoryLimit = parameter.getValue<uint64_t>();
+}
+
+common::Value QueryMemoryLimitSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->queryMemoryLimit);
+}
+
+void JoinOrderDPThresholdSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getClientConfigUnsafe()->joinOrderDPThreshold = parameter.getValue<uint64_t>();
+}
+
+common::Value JoinOrderDPThresholdSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->joinOrderDPThreshold);
+}
+
+void ReoptimizationThresholdSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getClientConfigUnsafe()->reoptimizationThreshold = parameter.getValue<uint64_t>();
+}
+
+common::Value ReoptimizationThresholdSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->reoptimizationThreshold);
+}
+
+void EnablePlanCacheSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getClientConfigUnsafe()->enablePlanCache = parameter.getValue<bool>();
+}
+
+common::Value EnablePlanCacheSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->enablePlanCache);
+}
+
 void ProgressBarSetting::setContext(ClientContext* context, const common::Value& parameter) {
     parameter.validateType(inputType);
     context->getClientConfigUnsafe()->enableProgressBar = parameter.getValue<bool>();
@@ -68,6 +118,39 @@ common::Value SparseFrontierThresholdSetting::getSetting(const ClientContext* co
     return common::Value(context->getClientConfig()->sparseFrontierThreshold);
 }
 
+void WSPDeltaSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getClientConfigUnsafe()->wspDelta = parameter.getValue<double>();
+}
+
+common::Value WSPDeltaSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->wspDelta);
+}
+
+void CacheProjectedGraphsSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getClientConfigUnsafe()->cacheProjectedGraphs = parameter.getValue<bool>();
+}
+
+common::Value CacheProjectedGraphsSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->cacheProjectedGraphs);
+}
+
+void ShortestPathLandmarksSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    auto numLandmarks = parameter.getValue<int64_t>();
+    if (numLandmarks < 0) {
+        throw common::RuntimeException("shortest_path_landmarks must be a non-negative integer.");
+    }
+    context->getClientConfigUnsafe()->shortestPathLandmarks = numLandmarks;
+}
+
+common::Value ShortestPathLandmarksSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->shortestPathLandmarks);
+}
+
 void EnableSemiMaskSetting::setContext(ClientContext* context, const common::Value& parameter) {
     parameter.validateType(inputType);
     context->getClientConfigUnsafe()->enableSemiMask = parameter.getValue<bool>();
@@ -9,6 +9,7 @@
 #include "planner/operator/logical_path_property_probe.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
 #include "planner/operator/sip/logical_semi_masker.h"
+#include "storage/predicate/bloom_filter_predicate.h"
 
 using namespace lbug::common;
 using namespace lbug::binder;
@@ -306,11 +307,35 @@ static bool tryBuildToProbeHJSIP(LogicalOperator* op) {
     return true;
 }
 
+// Semi masks only filter node IDs. For other keys, the probe side scans get a Bloom filter of the
+// build side keys. The filter is only filled if the build side turns out to be small, see
+// HashJoinSharedState.
+static void tryPassKeyFilter(LogicalHashJoin& hashJoin) {
+    if (hashJoin.getJoinType() != JoinType::INNER ||
+        hashJoin.getSIPInfo().direction == SIPDirection::PROBE_TO_BUILD) {
+        // The probe side must be scanned after the build side.
+        return;
+    }
+    auto joinConditions = hashJoin.getJoinConditions();
+    if (joinConditions.size() != 1) {
+        return;
+    }
+    auto& [probeKey, buildKey] = joinConditions[0];
+    if (probeKey->getDataType().getLogicalTypeID() == LogicalTypeID::INTERNAL_ID ||
+        probeKey->getDataType() != buildKey->getDataType() ||
+        !storage::ColumnBloomFilterPredicate::isSupportedType(
+            probeKey->getDataType().getPhysicalType())) {
+        return;
+    }
+    hashJoin.setPassKeyFilter(true);
+}
+
 void HashJoinSIPOptimizer::visitHashJoin(LogicalOperator* op) {
     auto& hashJoin = op->cast<LogicalHashJoin>();
     if (LogicalOperatorUtils::isAccHashJoin(hashJoin)) {
         return;
     }
+    tryPassKeyFilter(hashJoin);
     if (hashJoin.getSIPInfo().position == SemiMaskPosition::PROHIBIT) {
         return;
     }
@@ -320,7 +345,9 @@ void HashJoinSIPOptimizer::visitHashJoin(LogicalOperator* op) {
     if (hashJoin.getSIPInfo().position == SemiMaskPosition::PROHIBIT_PROBE_TO_BUILD) {
         return;
     }
-    tryProbeToBuildHJSIP(op);
+    if (tryProbeToBuildHJSIP(op)) {
+        hashJoin.setPassKeyFilter(false);
+    }
 }
 
 // TODO(Xiyang): we don't apply SIP from build to probe.
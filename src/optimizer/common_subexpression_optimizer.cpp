@@ -0,0 +1,199 @@
+#include "optimizer/common_subexpression_optimizer.h"
+
+#include "binder/expression/scalar_function_expression.h"
+#include "binder/expression_visitor.h"
+#include "function/sequence/sequence_functions.h"
+#include "planner/operator/logical_filter.h"
+#include "planner/operator/logical_projection.h"
+
+using namespace lbug::binder;
+using namespace lbug::common;
+using namespace lbug::planner;
+
+namespace lbug {
+namespace optimizer {
+
+void CommonSubexpressionOptimizer::rewrite(LogicalPlan* plan) {
+    visitOperator(plan->getLastOperator().get());
+}
+
+static bool isChainOperator(const LogicalOperator& op) {
+    switch (op.getOperatorType()) {
+    case LogicalOperatorType::FILTER:
+    case LogicalOperatorType::PROJECTION:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void CommonSubexpressionOptimizer::visitOperator(LogicalOperator* op) {
+    if (!isChainOperator(*op)) {
+        for (auto i = 0u; i < op->getNumChildren(); ++i) {
+            visitOperator(op->getChild(i).get());
+        }
+        return;
+    }
+    std::vector<LogicalOperator*> chain;
+    auto current = op;
+    while (isChainOperator(*current)) {
+        chain.push_back(current);
+        current = current->getChild(0).get();
+    }
+    visitOperator(current);
+    rewriteChain(chain);
+    // Recompute schemas bottom-up, including the ones of inserted projections.
+    std::vector<LogicalOperator*> ops;
+    for (auto child = op; child != current; child = child->getChild(0).get()) {
+        ops.push_back(child);
+    }
+    for (auto it = ops.rbegin(); it != ops.rend(); ++it) {
+        (*it)->computeFlatSchema();
+    }
+}
+
+static bool hasNextVal(const Expression& expression) {
+    if (expression.expressionType == ExpressionType::FUNCTION &&
+        expression.constCast<ScalarFunctionExpression>().getFunction().name ==
+            function::NextValFunction::name) {
+        return true;
+    }
+    for (auto& child : ExpressionChildrenCollector::collectChildren(expression)) {
+        if (hasNextVal(*child)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool canShare(const std::shared_ptr<Expression>& expression) {
+    if (expression->expressionType != ExpressionType::FUNCTION ||
+        ExpressionVisitor::isRandom(*expression) || hasNextVal(*expression)) {
+        return false;
+    }
+    // Functions of literals and parameters only are evaluated once per execution anyway.
+    auto collector = DependentVarNameCollector();
+    collector.visit(expression);
+    return !collector.getVarNames().empty();
+}
+
+namespace {
+
+struct ExpressionUses {
+    struct Use {
+        std::shared_ptr<Expression> expression;
+        // The first operator, i.e. the lowest one in the chain, evaluating the expression.
+        LogicalOperator* firstUser;
+        uint64_t numUses;
+    };
+
+    std::vector<Use> entries;
+    expression_map<idx_t> entryIdx;
+
+    void add(const std::shared_ptr<Expression>& expression, LogicalOperator* user) {
+        if (!entryIdx.contains(expression)) {
+            entryIdx.insert({expression, entries.size()});
+            entries.push_back(Use{expression, user, 0});
+        }
+        entries[entryIdx.at(expression)].numUses++;
+    }
+
+    void clear() {
+        entries.clear();
+        entryIdx.clear();
+    }
+};
+
+} // namespace
+
+static void collectUses(const std::shared_ptr<Expression>& expression, LogicalOperator* user,
+    ExpressionUses& uses) {
+    switch (expression->expressionType) {
+    // Case alternatives are evaluated only for some rows, and lambdas, subqueries and aggregates
+    // are evaluated in their own scope.
+    case ExpressionType::CASE_ELSE:
+    case ExpressionType::LAMBDA:
+    case ExpressionType::SUBQUERY:
+    case ExpressionType::AGGREGATE_FUNCTION:
+        return;
+    default:
+        break;
+    }
+    if (canShare(expression)) {
+        uses.add(expression, user);
+    }
+    for (auto& child : ExpressionChildrenCollector::collectChildren(*expression)) {
+        collectUses(child, user, uses);
+    }
+}
+
+void CommonSubexpressionOptimizer::rewriteChain(const std::vector<LogicalOperator*>& chain) {
+    // A projection drops all expressions that it does not project, so expressions are only shared
+    // between operators up to the next projection. Uses above the last projection are not shared
+    // because the inserted expressions would be visible to the operator above the chain.
+    ExpressionUses uses;
+    for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+        auto op = *it;
+        if (op->getOperatorType() == LogicalOperatorType::FILTER) {
+            collectUses(op->constCast<LogicalFilter>().getPredicate(), op, uses);
+            continue;
+        }
+        for (auto& expression : op->constCast<LogicalProjection>().getExpressionsToProject()) {
+            collectUses(expression, op, uses);
+        }
+        std::vector<LogicalOperator*> users;
+        std::unordered_map<LogicalOperator*, expression_vector> expressionsPerUser;
+        for (auto& use : uses.entries) {
+            if (use.numUses < 2 ||
+                use.firstUser->getChild(0)->getSchema()->isExpressionInScope(*use.expression)) {
+                continue;
+            }
+            if (!expressionsPerUser.contains(use.firstUser)) {
+                users.push_back(use.firstUser);
+            }
+            expressionsPerUser[use.firstUser].push_back(use.expression);
+        }
+        for (auto user : users) {
+            insertProjections(user, std::move(expressionsPerUser.at(user)));
+        }
+        uses.clear();
+    }
+}
+
+static bool containsAnyOf(const Expression& expression, const expression_set& others) {
+    for (auto& child : ExpressionChildrenCollector::collectChildren(expression)) {
+        if (others.contains(child) || containsAnyOf(*child, others)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CommonSubexpressionOptimizer::insertProjections(LogicalOperator* op,
+    expression_vector expressions) {
+    // Shared expressions may contain each other, e.g. lower(a.name) and size(lower(a.name)). Inner
+    // expressions are computed by a projection below the one computing outer expressions.
+    while (!expressions.empty()) {
+        auto expressionSet = expression_set{expressions.begin(), expressions.end()};
+        expression_vector expressionsToProject, remainingExpressions;
+        for (auto& expression : expressions) {
+            if (containsAnyOf(*expression, expressionSet)) {
+                remainingExpressions.push_back(expression);
+            } else {
+                expressionsToProject.push_back(expression);
+            }
+        }
+        auto child = op->getChild(0);
+        auto projectionExpressions = child->getSchema()->getExpressionsInScope();
+        projectionExpressions.insert(projectionExpressions.end(), expressionsToProject.begin(),
+            expressionsToProject.end());
+        auto projection =
+            std::make_shared<LogicalProjection>(std::move(projectionExpressions), std::move(child));
+        projection->computeFlatSchema();
+        op->setChild(0, std::move(projection));
+        expressions = std::move(remainingExpressions);
+    }
+}
+
+} // namespace optimizer
+} // namespace lbug
@@ -4,6 +4,7 @@
 #include "optimizer/acc_hash_join_optimizer.h"
 #include "optimizer/agg_key_dependency_optimizer.h"
 #include "optimizer/cardinality_updater.h"
+#include "optimizer/common_subexpression_optimizer.h"
 #include "optimizer/correlated_subquery_unnest_solver.h"
 #include "optimizer/count_rel_table_optimizer.h"
 #include "optimizer/factorization_rewriter.h"
@@ -67,6 +68,11 @@ void Optimizer::optimize(planner::LogicalPlan* plan, main::ClientContext* contex
         auto topKOptimizer = TopKOptimizer();
         topKOptimizer.rewrite(plan);
 
+        // CommonSubexpressionOptimizer inserts projections and thus should be applied after
+        // optimizers that match patterns of projections.
+        auto commonSubexpressionOptimizer = CommonSubexpressionOptimizer();
+        commonSubexpressionOptimizer.rewrite(plan);
+
         auto factorizationRewriter = FactorizationRewriter();
         factorizationRewriter.rewrite(plan);
 
@@ -1,10 +1,13 @@
 #include "planner/join_order/cardinality_estimator.h"
 
+#include "binder/expression/expression_util.h"
 #include "binder/expression/property_expression.h"
 #include "catalog/catalog.h"
 #include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/type_utils.h"
 #include "main/client_context.h"
 #include "planner/join_order/join_order_util.h"
+#include "planner/operator/extend/logical_extend.h"
 #include "planner/operator/logical_aggregate.h"
 #include "planner/operator/logical_hash_join.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
@@ -94,15 +97,21 @@ uint64_t CardinalityEstimator::estimateHashJoin(
     const LogicalOperator& buildOp) const {
     if (LogicalHashJoin::isNodeIDOnlyJoin(joinConditions)) {
         cardinality_t denominator = 1u;
+        double skewFactor = 1;
         auto joinKeys = LogicalHashJoin::getJoinNodeIDs(joinConditions);
         for (auto& joinKey : joinKeys) {
             if (nodeIDName2dom.contains(joinKey->getUniqueName())) {
-                denominator *= getNodeIDDom(joinKey->getUniqueName());
+                auto dom = getNodeIDDom(joinKey->getUniqueName());
+                denominator *= dom;
+                // Both sides are likely to meet at the high-degree nodes.
+                if (auto selectivity = getSkewedJoinSelectivity(*joinKey, probeOp, buildOp)) {
+                    skewFactor *= std::max(1.0, *selectivity * atLeastOne(dom));
+                }
             }
         }
         return atLeastOne(probeOp.getCardinality() *
                           JoinOrderUtil::getJoinKeysFlatCardinality(joinKeys, buildOp) /
-                          atLeastOne(denominator));
+                          atLeastOne(denominator) * skewFactor);
     } else {
         // Naively estimate the cardinality if the join is non-ID based
         cardinality_t estCardinality = probeOp.getCardinality() * buildOp.getCardinality();
@@ -157,25 +166,111 @@ static bool isSingleLabelledProperty(const Expression& expression) {
     return expression.constCast<PropertyExpression>().isSingleLabel();
 }
 
+// Returns the stats of the column a single-labelled property refers to, if they are known.
+static const storage::ColumnStats* getColumnStatsIfPossible(main::ClientContext* context,
+    const Expression& expression,
+    const std::unordered_map<common::table_id_t, storage::TableStats>& nodeTableStats) {
+    if (!isSingleLabelledProperty(expression)) {
+        return nullptr;
+    }
+    auto& propertyExpr = expression.constCast<PropertyExpression>();
+    auto tableID = propertyExpr.getSingleTableID();
+    if (!nodeTableStats.contains(tableID) || !propertyExpr.hasProperty(tableID)) {
+        return nullptr;
+    }
+    auto transaction = Transaction::Get(*context);
+    auto entry = catalog::Catalog::Get(*context)->getTableCatalogEntry(transaction, tableID);
+    auto columnID = entry->getColumnID(propertyExpr.getPropertyName());
+    if (columnID == INVALID_COLUMN_ID || columnID == ROW_IDX_COLUMN_ID) {
+        return nullptr;
+    }
+    return &nodeTableStats.at(tableID).getColumnStats(columnID);
+}
+
 static std::optional<cardinality_t> getTableStatsIfPossible(main::ClientContext* context,
     const Expression& predicate,
     const std::unordered_map<common::table_id_t, storage::TableStats>& nodeTableStats) {
     KU_ASSERT(predicate.getNumChildren() >= 1);
-    if (isSingleLabelledProperty(*predicate.getChild(0))) {
-        auto& propertyExpr = predicate.getChild(0)->cast<PropertyExpression>();
-        auto tableID = propertyExpr.getSingleTableID();
-        if (nodeTableStats.contains(tableID) && propertyExpr.hasProperty(tableID)) {
-            auto transaction = Transaction::Get(*context);
-            auto entry =
-                catalog::Catalog::Get(*context)->getTableCatalogEntry(transaction, tableID);
-            auto columnID = entry->getColumnID(propertyExpr.getPropertyName());
-            if (columnID != INVALID_COLUMN_ID && columnID != ROW_IDX_COLUMN_ID) {
-                auto& stats = nodeTableStats.at(tableID);
-                return atLeastOne(stats.getNumDistinctValues(columnID));
-            }
+    auto columnStats = getColumnStatsIfPossible(context, *predicate.getChild(0), nodeTableStats);
+    if (columnStats == nullptr) {
+        return {};
+    }
+    return atLeastOne(columnStats->getNumDistinctValues());
+}
+
+static std::optional<double> getNumericValue(const Value& value) {
+    std::optional<double> result;
+    TypeUtils::visit(value.getDataType().getPhysicalType(), [&]<typename T>(T) {
+        if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+            result = static_cast<double>(value.getValue<T>());
         }
+    });
+    return result;
+}
+
+static ExpressionType flipComparison(ExpressionType type) {
+    switch (type) {
+    case ExpressionType::GREATER_THAN:
+        return ExpressionType::LESS_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return ExpressionType::LESS_THAN_EQUALS;
+    case ExpressionType::LESS_THAN:
+        return ExpressionType::GREATER_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return ExpressionType::GREATER_THAN_EQUALS;
+    default:
+        return type;
+    }
+}
+
+// Returns the selectivity of comparing a column with a literal or parameter based on the most common values and
+// histogram of the column, if they are known.
+static std::optional<double> getHistogramSelectivity(main::ClientContext* context,
+    const Expression& predicate,
+    const std::unordered_map<common::table_id_t, storage::TableStats>& nodeTableStats) {
+    if (predicate.getNumChildren() != 2) {
+        return std::nullopt;
+    }
+    auto comparison = predicate.expressionType;
+    auto column = predicate.getChild(0);
+    auto literal = predicate.getChild(1);
+    if (ExpressionUtil::canEvaluateAsLiteral(*column)) {
+        std::swap(column, literal);
+        comparison = flipComparison(comparison);
+    }
+    if (!ExpressionUtil::canEvaluateAsLiteral(*literal)) {
+        return std::nullopt;
+    }
+    auto columnStats = getColumnStatsIfPossible(context, *column, nodeTableStats);
+    if (columnStats == nullptr) {
+        return std::nullopt;
+    }
+    auto histogram = columnStats->getHistogram();
+    auto value = ExpressionUtil::evaluateAsLiteralValue(*literal);
+    if (!histogram || value.isNull() ||
+        value.getDataType().getPhysicalType() != column->getDataType().getPhysicalType()) {
+        return std::nullopt;
+    }
+    if (comparison == ExpressionType::EQUALS) {
+        return histogram->getEqualitySelectivity(value.computeHash(),
+            columnStats->getNumDistinctValues());
+    }
+    auto numericValue = getNumericValue(value);
+    if (!numericValue) {
+        return std::nullopt;
+    }
+    switch (comparison) {
+    case ExpressionType::GREATER_THAN:
+        return histogram->getRangeSelectivity(numericValue, false, std::nullopt, false);
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return histogram->getRangeSelectivity(numericValue, true, std::nullopt, false);
+    case ExpressionType::LESS_THAN:
+        return histogram->getRangeSelectivity(std::nullopt, false, numericValue, false);
+    case ExpressionType::LESS_THAN_EQUALS:
+        return histogram->getRangeSelectivity(std::nullopt, false, numericValue, true);
+    default:
+        return std::nullopt;
     }
-    return {};
 }
 
 uint64_t CardinalityEstimator::estimateFilter(const LogicalOperator& childPlan,
@@ -183,15 +278,19 @@ uint64_t CardinalityEstimator::estimateFilter(const LogicalOperator& childPlan,
     if (predicate.expressionType == ExpressionType::EQUALS) {
         if (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1))) {
             return 1;
-        } else {
-            const auto numDistinctValues =
-                getTableStatsIfPossible(context, predicate, nodeTableStats);
-            if (numDistinctValues.has_value()) {
-                return atLeastOne(childPlan.getCardinality() / numDistinctValues.value());
-            }
-            return atLeastOne(
-                childPlan.getCardinality() * PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY);
         }
+    }
+    const auto selectivity = getHistogramSelectivity(context, predicate, nodeTableStats);
+    if (selectivity.has_value()) {
+        return atLeastOne(childPlan.getCardinality() * selectivity.value());
+    }
+    if (predicate.expressionType == ExpressionType::EQUALS) {
+        const auto numDistinctValues = getTableStatsIfPossible(context, predicate, nodeTableStats);
+        if (numDistinctValues.has_value()) {
+            return atLeastOne(childPlan.getCardinality() / numDistinctValues.value());
+        }
+        return atLeastOne(
+            childPlan.getCardinality() * PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY);
     } else {
         return atLeastOne(
             childPlan.getCardinality() * PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY);
@@ -221,6 +320,99 @@ uint64_t CardinalityEstimator::getNumRels(const Transaction* transaction,
     return atLeastOne(numRels);
 }
 
+storage::DegreeStats CardinalityEstimator::getDegreeStats(
+    const std::vector<table_id_t>& relTableIDs, ExtendDirection direction) const {
+    storage::DegreeStats result;
+    auto storageManager = storage::StorageManager::Get(*context);
+    for (auto tableID : relTableIDs) {
+        auto& relTable = storageManager->getTable(tableID)->cast<storage::RelTable>();
+        if (direction != ExtendDirection::BWD) {
+            result.merge(relTable.getDegreeStats(RelDataDirection::FWD));
+        }
+        if (direction != ExtendDirection::FWD) {
+            result.merge(relTable.getDegreeStats(RelDataDirection::BWD));
+        }
+    }
+    return result;
+}
+
+static ExtendDirection reverse(ExtendDirection direction) {
+    switch (direction) {
+    case ExtendDirection::FWD:
+        return ExtendDirection::BWD;
+    case ExtendDirection::BWD:
+        return ExtendDirection::FWD;
+    default:
+        return direction;
+    }
+}
+
+// The adjacency lists of a node, i.e. the rels of the given tables and direction incident to it.
+struct Adjacency {
+    std::vector<table_id_t> relTableIDs;
+    ExtendDirection direction;
+
+    Adjacency(const RelExpression& rel, ExtendDirection direction)
+        : relTableIDs{rel.getInnerRelTableIDs()}, direction{direction} {
+        std::sort(relTableIDs.begin(), relTableIDs.end());
+    }
+
+    bool operator==(const Adjacency& other) const = default;
+};
+
+// Returns the adjacency lists of `nodeID` scanned by the first extend found in the plan rooted at
+// `op`, either from `nodeID` or to it.
+static std::optional<Adjacency> findScannedAdjacency(const LogicalOperator& op,
+    const Expression& nodeID) {
+    if (op.getOperatorType() == LogicalOperatorType::EXTEND) {
+        auto& extend = op.constCast<LogicalExtend>();
+        if (*extend.getBoundNode()->getInternalID() == nodeID) {
+            return Adjacency{*extend.getRel(), extend.getDirection()};
+        }
+        if (*extend.getNbrNode()->getInternalID() == nodeID) {
+            return Adjacency{*extend.getRel(), reverse(extend.getDirection())};
+        }
+    }
+    for (auto i = 0u; i < op.getNumChildren(); ++i) {
+        if (auto adjacency = findScannedAdjacency(*op.getChild(i), nodeID)) {
+            return adjacency;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<double> CardinalityEstimator::getSkewedJoinSelectivity(const Expression& nodeID,
+    const LogicalOperator& probeOp, const LogicalOperator& buildOp) const {
+    auto probeAdjacency = findScannedAdjacency(probeOp, nodeID);
+    auto buildAdjacency = findScannedAdjacency(buildOp, nodeID);
+    if (!probeAdjacency || probeAdjacency != buildAdjacency) {
+        return std::nullopt;
+    }
+    auto stats = getDegreeStats(probeAdjacency->relTableIDs, probeAdjacency->direction);
+    if (stats.isEmpty()) {
+        return std::nullopt;
+    }
+    // Each side picks the join node with a probability proportional to its degree.
+    auto numRels = static_cast<double>(stats.getNumRels());
+    return stats.getSumSquaredDegrees() / (numRels * numRels);
+}
+
+double CardinalityEstimator::getExtensionRate(const RelExpression& rel,
+    const NodeExpression& boundNode, ExtendDirection direction, const LogicalOperator& childOp,
+    const Transaction* transaction) const {
+    auto rate = getExtensionRate(rel, boundNode, transaction);
+    KU_ASSERT(rel.getRelType() == QueryRelType::NON_RECURSIVE);
+    auto adjacency = Adjacency{rel, direction};
+    if (findScannedAdjacency(childOp, *boundNode.getInternalID()) != adjacency) {
+        return rate;
+    }
+    auto stats = getDegreeStats(adjacency.relTableIDs, direction);
+    if (stats.isEmpty()) {
+        return rate;
+    }
+    return stats.getSizeBiasedDegree();
+}
+
 double CardinalityEstimator::getExtensionRate(const RelExpression& rel,
     const NodeExpression& boundNode, const Transaction* transaction) const {
     auto numBoundNodes = static_cast<double>(getNumNodes(transaction, boundNode.getTableIDs()));
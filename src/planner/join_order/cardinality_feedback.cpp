@@ -0,0 +1,73 @@
+#include "planner/join_order/cardinality_feedback.h"
+
+#include <algorithm>
+
+#include "main/client_context.h"
+
+using namespace lbug::common;
+
+namespace lbug {
+namespace planner {
+
+std::string CardinalityFeedback::getSubgraphKey(const binder::SubqueryGraph& subgraph) {
+    std::string key;
+    for (auto i = 0u; i < subgraph.queryGraph.getNumQueryNodes(); ++i) {
+        if (subgraph.queryNodesSelector[i]) {
+            key += subgraph.queryGraph.getQueryNode(i)->getUniqueName();
+            key += ",";
+        }
+    }
+    key += "|";
+    for (auto i = 0u; i < subgraph.queryGraph.getNumQueryRels(); ++i) {
+        if (subgraph.queryRelsSelector[i]) {
+            key += subgraph.queryGraph.getQueryRel(i)->getUniqueName();
+            key += ",";
+        }
+    }
+    return key;
+}
+
+bool CardinalityFeedback::isMisestimated(cardinality_t estimated, cardinality_t observed,
+    uint64_t threshold) {
+    if (threshold == 0 || std::max(estimated, observed) < MIN_CARDINALITY_TO_REOPTIMIZE) {
+        return false;
+    }
+    const auto smaller = std::max<cardinality_t>(1, std::min(estimated, observed));
+    const auto larger = std::max(estimated, observed);
+    return static_cast<double>(larger) / static_cast<double>(smaller) >
+           static_cast<double>(threshold);
+}
+
+void CardinalityFeedback::addObservedCardinality(const std::string& subgraphKey,
+    cardinality_t cardinality) {
+    std::unique_lock lck{mtx};
+    observedCardinalities[subgraphKey] = cardinality;
+}
+
+std::optional<cardinality_t> CardinalityFeedback::getObservedCardinality(
+    const std::string& subgraphKey) const {
+    std::unique_lock lck{mtx};
+    if (!observedCardinalities.contains(subgraphKey)) {
+        return std::nullopt;
+    }
+    return observedCardinalities.at(subgraphKey);
+}
+
+bool CardinalityFeedback::isEmpty() const {
+    std::unique_lock lck{mtx};
+    return observedCardinalities.empty();
+}
+
+void CardinalityFeedback::clear() {
+    std::unique_lock lck{mtx};
+    observedCardinalities.clear();
+    canReoptimize_ = false;
+    numReoptimizations = 0;
+}
+
+CardinalityFeedback* CardinalityFeedback::Get(const main::ClientContext& context) {
+    return context.cardinalityFeedback.get();
+}
+
+} // namespace planner
+} // namespace lbug
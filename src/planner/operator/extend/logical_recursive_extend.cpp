@@ -1,5 +1,7 @@
 #include "planner/operator/extend/logical_recursive_extend.h"
 
+#include "function/gds/gds_function_collection.h"
+
 namespace lbug {
 namespace planner {
 
@@ -19,5 +21,16 @@ void LogicalRecursiveExtend::computeFactorizedSchema() {
     }
 }
 
+bool LogicalRecursiveExtend::canSearchBidirectionally() const {
+    auto functionName = function->getFunctionName();
+    if (functionName != function::SingleSPDestinationsFunction::name &&
+        functionName != function::SingleSPPathsFunction::name) {
+        return false;
+    }
+    // A node predicate restricts the nodes on the path, which the search does not check.
+    return hasInputNodeMask_ && hasOutputNodeMask_ && !hasNodePredicate() &&
+           bindData.lowerBound <= 1;
+}
+
 } // namespace planner
 } // namespace lbug
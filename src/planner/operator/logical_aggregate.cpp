@@ -56,6 +56,15 @@ f_group_pos_set LogicalAggregate::getGroupsPosToFlatten() {
     return flattenedGroups;
 }
 
+bool LogicalAggregate::hasDistinctAggregate() const {
+    for (auto& aggregate : aggregates) {
+        if (aggregate->constCast<binder::AggregateFunctionExpression>().isDistinct()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 std::string LogicalAggregate::getExpressionsForPrinting() const {
     std::string result = "Group By [";
     for (auto& expression : keys) {
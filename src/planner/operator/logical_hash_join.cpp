@@ -136,6 +136,8 @@ std::unique_ptr<LogicalOperator> LogicalHashJoin::copy() {
     auto op = std::make_unique<LogicalHashJoin>(joinConditions, joinType, mark, children[0]->copy(),
         children[1]->copy(), cardinality);
     op->sipInfo = sipInfo;
+    op->passKeyFilter = passKeyFilter;
+    op->setBuildSubgraph(buildSubgraphKey, estimatedBuildCardinality);
     return op;
 }
 
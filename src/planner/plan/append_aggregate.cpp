@@ -1,11 +1,86 @@
+#include "binder/expression/property_expression.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
 #include "planner/operator/logical_aggregate.h"
 #include "planner/planner.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
+#include "transaction/transaction.h"
 
 using namespace lbug::binder;
+using namespace lbug::common;
 
 namespace lbug {
 namespace planner {
 
+static bool isDenseKeyType(PhysicalTypeID physicalType) {
+    switch (physicalType) {
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT8:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Returns the range of the only group by key if it is a node property whose zone maps show a small
+// range of values. The range is only a hint, values outside of it are still aggregated correctly.
+static std::optional<AggregateKeyRange> getKeyRange(main::ClientContext* context,
+    const LogicalAggregate& aggregate) {
+    if (aggregate.getKeys().size() != 1 || !aggregate.getDependentKeys().empty() ||
+        aggregate.hasDistinctAggregate()) {
+        return std::nullopt;
+    }
+    auto& key = *aggregate.getKeys()[0];
+    const auto physicalType = key.getDataType().getPhysicalType();
+    if (key.expressionType != ExpressionType::PROPERTY || !isDenseKeyType(physicalType)) {
+        return std::nullopt;
+    }
+    auto& property = key.constCast<PropertyExpression>();
+    if (!property.isSingleLabel()) {
+        return std::nullopt;
+    }
+    auto tableID = property.getSingleTableID();
+    auto transaction = transaction::Transaction::Get(*context);
+    auto entry = catalog::Catalog::Get(*context)->getTableCatalogEntry(transaction, tableID);
+    if (entry->getType() != catalog::CatalogEntryType::NODE_TABLE_ENTRY ||
+        !property.hasProperty(tableID)) {
+        return std::nullopt;
+    }
+    auto columnID = entry->getColumnID(property.getPropertyName());
+    if (columnID == INVALID_COLUMN_ID || columnID == ROW_IDX_COLUMN_ID) {
+        return std::nullopt;
+    }
+    auto table = storage::StorageManager::Get(*context)->getTable(tableID);
+    auto stats = table->cast<storage::NodeTable>().getMergedColumnChunkStats(columnID).stats;
+    if (!stats.min.has_value() || !stats.max.has_value()) {
+        return std::nullopt;
+    }
+    int64_t min = 0, max = 0;
+    if (physicalType == PhysicalTypeID::UINT64) {
+        if (stats.max->get<uint64_t>() > static_cast<uint64_t>(INT64_MAX)) {
+            return std::nullopt;
+        }
+        min = static_cast<int64_t>(stats.min->get<uint64_t>());
+        max = static_cast<int64_t>(stats.max->get<uint64_t>());
+    } else {
+        min = stats.min->get<int64_t>();
+        max = stats.max->get<int64_t>();
+    }
+    // Computed modulo 2^64, so that it cannot overflow for ranges that do not fit in an int64.
+    const auto numKeys = static_cast<uint64_t>(max) - static_cast<uint64_t>(min) + 1;
+    if (min > max || numKeys == 0 || numKeys > LogicalAggregate::MAX_NUM_DENSE_KEYS) {
+        return std::nullopt;
+    }
+    return AggregateKeyRange{min, numKeys};
+}
+
 void Planner::appendAggregate(const expression_vector& expressionsToGroupBy,
     const expression_vector& expressionsToAggregate, LogicalPlan& plan) {
     auto aggregate = make_shared<LogicalAggregate>(expressionsToGroupBy, expressionsToAggregate,
@@ -14,6 +89,7 @@ void Planner::appendAggregate(const expression_vector& expressionsToGroupBy,
     aggregate->setChild(0, plan.getLastOperator());
     aggregate->computeFactorizedSchema();
     aggregate->setCardinality(cardinalityEstimator.estimateAggregate(*aggregate));
+    aggregate->setKeyRange(getKeyRange(clientContext, *aggregate));
     plan.setLastOperator(std::move(aggregate));
 }
 
@@ -84,7 +84,8 @@ void Planner::appendNonRecursiveExtend(const std::shared_ptr<NodeExpression>& bo
     extend->computeFactorizedSchema();
     // Update cost & cardinality. Note that extend does not change factorized cardinality.
     auto transaction = Transaction::Get(*clientContext);
-    const auto extensionRate = cardinalityEstimator.getExtensionRate(*rel, *boundNode, transaction);
+    const auto extensionRate = cardinalityEstimator.getExtensionRate(*rel, *boundNode, direction,
+        *plan.getLastOperator(), transaction);
     extend->setCardinality(plan.getLastOperator()->getCardinality());
     plan.setCost(CostModel::computeExtendCost(plan));
     auto group = extend->getSchema()->getGroup(nbrNode->getInternalID());
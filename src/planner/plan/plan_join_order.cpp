@@ -7,9 +7,12 @@
 #include "common/enums/rel_direction.h"
 #include "common/enums/table_type.h"
 #include "common/utils.h"
+#include "main/client_context.h"
+#include "planner/join_order/cardinality_feedback.h"
 #include "planner/join_order/cost_model.h"
 #include "planner/join_order/join_plan_solver.h"
 #include "planner/join_order/join_tree_constructor.h"
+#include "planner/operator/logical_hash_join.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
 #include "planner/planner.h"
 
@@ -134,10 +137,27 @@ LogicalPlan Planner::planQueryGraph(const QueryGraph& queryGraph,
         auto plan = JoinPlanSolver(this).solve(joinTree);
         return plan.copy();
     }
-    planBaseTableScans(info);
-    context.currentLevel++;
-    while (context.currentLevel < context.maxLevel) {
-        planLevel(context.currentLevel++);
+    auto numVariables = queryGraph.getNumQueryNodes() + queryGraph.getNumQueryRels();
+    auto planned = false;
+    if (numVariables > clientContext->getClientConfig()->joinOrderDPThreshold) {
+        planBaseTableScans(info);
+        context.currentLevel++;
+        while (context.currentLevel < context.maxLevel) {
+            planLevelGreedily(context.currentLevel++);
+        }
+        // Greedy extension gets stuck if a subgraph can only be planned as a whole, e.g. the
+        // correlated nodes of a subquery. Fall back to dynamic programming in that case.
+        planned = context.containPlans(context.getFullyMatchedSubqueryGraph());
+        if (!planned) {
+            context.init(&queryGraph, info.predicates);
+        }
+    }
+    if (!planned) {
+        planBaseTableScans(info);
+        context.currentLevel++;
+        while (context.currentLevel < context.maxLevel) {
+            planLevel(context.currentLevel++);
+        }
     }
 
     auto& plans = context.getPlans(context.getFullyMatchedSubqueryGraph());
@@ -174,10 +194,38 @@ void Planner::planLevelExactly(uint32_t level) {
     }
 }
 
+void Planner::addSubgraphPlan(const SubqueryGraph& subgraph, LogicalPlan plan) {
+    const auto feedback = CardinalityFeedback::Get(*clientContext);
+    if (feedback->isEmpty()) {
+        context.addPlan(subgraph, std::move(plan));
+        return;
+    }
+    const auto observed =
+        feedback->getObservedCardinality(CardinalityFeedback::getSubgraphKey(subgraph));
+    if (observed.has_value()) {
+        plan.getLastOperator()->setCardinality(*observed);
+        if (subgraph.getTotalNumVariables() == 1 && subgraph.getNumQueryRels() == 0) {
+            for (auto i = 0u; i < context.queryGraph->getNumQueryNodes(); ++i) {
+                if (subgraph.queryNodesSelector[i]) {
+                    cardinalityEstimator.rectifyCardinality(
+                        *context.queryGraph->getQueryNode(i)->getInternalID(), *observed);
+                }
+            }
+        }
+    }
+    context.addPlan(subgraph, std::move(plan));
+}
+
 void Planner::planLevelApproximately(uint32_t level) {
     planInnerJoin(1, level - 1);
 }
 
+void Planner::planLevelGreedily(uint32_t level) {
+    KU_ASSERT(level > 1);
+    planInnerJoin(1, level - 1);
+    context.subPlansTable->retainCheapestSubgraph(level);
+}
+
 void Planner::planBaseTableScans(const QueryGraphPlanningInfo& info) {
     auto queryGraph = context.getQueryGraph();
     switch (info.subqueryType) {
@@ -240,7 +288,7 @@ void Planner::planCorrelatedExpressionsScan(const QueryGraphPlanningInfo& info)
         context.getWhereExpressions());
     appendFilters(predicates, plan);
     appendDistinct(corrExprs, plan);
-    context.addPlan(newSubgraph, std::move(plan));
+    addSubgraphPlan(newSubgraph, std::move(plan));
 }
 
 void Planner::planNodeScan(uint32_t nodePos) {
@@ -265,7 +313,7 @@ void Planner::planNodeScan(uint32_t nodePos) {
     auto predicates = getNewlyMatchedExprs(context.getEmptySubqueryGraph(), newSubgraph,
         context.getWhereExpressions());
     appendFilters(predicates, plan);
-    context.addPlan(newSubgraph, std::move(plan));
+    addSubgraphPlan(newSubgraph, std::move(plan));
 }
 
 void Planner::planNodeIDScan(uint32_t nodePos) {
@@ -274,7 +322,7 @@ void Planner::planNodeIDScan(uint32_t nodePos) {
     newSubgraph.addQueryNode(nodePos);
     auto plan = LogicalPlan();
     appendScanNodeTable(node->getInternalID(), node->getTableIDs(), {}, plan);
-    context.addPlan(newSubgraph, std::move(plan));
+    addSubgraphPlan(newSubgraph, std::move(plan));
 }
 
 static std::pair<std::shared_ptr<NodeExpression>, std::shared_ptr<NodeExpression>>
@@ -311,7 +359,7 @@ void Planner::planRelScan(uint32_t relPos) {
         appendScanNodeTable(boundNode->getInternalID(), boundNode->getTableIDs(), {}, plan);
         appendExtend(boundNode, nbrNode, rel, extendDirection, getProperties(*rel), plan);
         appendFilters(predicates, plan);
-        context.addPlan(newSubgraph, std::move(plan));
+        addSubgraphPlan(newSubgraph, std::move(plan));
     }
 }
 
@@ -478,7 +526,7 @@ void Planner::planWCOJoin(const SubqueryGraph& subgraph,
         for (auto& predicate : predicates) {
             appendFilter(predicate, leftPlanCopy);
         }
-        context.subPlansTable->addPlan(newSubgraph, std::move(leftPlanCopy));
+        addSubgraphPlan(newSubgraph, std::move(leftPlanCopy));
     }
 }
 
@@ -562,7 +610,7 @@ bool Planner::tryPlanINLJoin(const SubqueryGraph& subgraph, const SubqueryGraph&
             auto plan = prevPlan.copy();
             appendExtend(boundNode, nbrNode, rel, extendDirection, getProperties(*rel), plan);
             appendFilters(predicates, plan);
-            context.addPlan(newSubgraph, std::move(plan));
+            addSubgraphPlan(newSubgraph, std::move(plan));
             hasAppliedINLJoin = true;
         }
     }
@@ -587,8 +635,11 @@ void Planner::planInnerHashJoin(const SubqueryGraph& subgraph, const SubqueryGra
                 auto rightPlanBuildCopy = rightPlan.copy();
                 appendHashJoin(joinNodeIDs, JoinType::INNER, leftPlanProbeCopy, rightPlanBuildCopy,
                     leftPlanProbeCopy);
+                leftPlanProbeCopy.getLastOperator()->cast<LogicalHashJoin>().setBuildSubgraph(
+                    CardinalityFeedback::getSubgraphKey(otherSubgraph),
+                    rightPlan.getCardinality());
                 appendFilters(predicates, leftPlanProbeCopy);
-                context.addPlan(newSubgraph, std::move(leftPlanProbeCopy));
+                addSubgraphPlan(newSubgraph, std::move(leftPlanProbeCopy));
             }
             // flip build and probe side to get another HashJoin plan
             if (flipPlan &&
@@ -597,8 +648,10 @@ void Planner::planInnerHashJoin(const SubqueryGraph& subgraph, const SubqueryGra
                 auto rightPlanProbeCopy = rightPlan.copy();
                 appendHashJoin(joinNodeIDs, JoinType::INNER, rightPlanProbeCopy, leftPlanBuildCopy,
                     rightPlanProbeCopy);
+                rightPlanProbeCopy.getLastOperator()->cast<LogicalHashJoin>().setBuildSubgraph(
+                    CardinalityFeedback::getSubgraphKey(subgraph), leftPlan.getCardinality());
                 appendFilters(predicates, rightPlanProbeCopy);
-                context.addPlan(newSubgraph, std::move(rightPlanProbeCopy));
+                addSubgraphPlan(newSubgraph, std::move(rightPlanProbeCopy));
             }
         }
     }
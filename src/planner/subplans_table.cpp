@@ -69,6 +69,28 @@ void DPLevel::addPlan(const SubqueryGraph& subqueryGraph, LogicalPlan plan) {
     subgraph2Plans.at(subqueryGraph).addPlan(std::move(plan));
 }
 
+void DPLevel::retainCheapestSubgraph() {
+    if (subgraph2Plans.size() <= 1) {
+        return;
+    }
+    auto cheapestIt = subgraph2Plans.end();
+    auto cheapestCost = UINT64_MAX;
+    for (auto it = subgraph2Plans.begin(); it != subgraph2Plans.end(); ++it) {
+        for (auto& plan : it->second.getPlans()) {
+            if (cheapestIt == subgraph2Plans.end() || plan.getCost() < cheapestCost) {
+                cheapestIt = it;
+                cheapestCost = plan.getCost();
+            }
+        }
+    }
+    if (cheapestIt == subgraph2Plans.end()) {
+        return;
+    }
+    auto cheapest = subgraph2Plans.extract(cheapestIt);
+    subgraph2Plans.clear();
+    subgraph2Plans.insert(std::move(cheapest));
+}
+
 void SubPlansTable::resize(uint32_t newSize) {
     auto prevSize = dpLevels.size();
     dpLevels.resize(newSize);
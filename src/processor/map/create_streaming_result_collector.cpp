@@ -0,0 +1,32 @@
+#include "processor/operator/streaming_result_collector.h"
+#include "processor/plan_mapper.h"
+#include "processor/result/factorized_table_util.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+using namespace lbug::common;
+using namespace lbug::planner;
+using namespace lbug::binder;
+
+namespace lbug {
+namespace processor {
+
+std::unique_ptr<PhysicalOperator> PlanMapper::createStreamingResultCollector(
+    std::shared_ptr<StreamingResultSharedState> sharedState, const expression_vector& expressions,
+    Schema* schema, std::unique_ptr<PhysicalOperator> prevOperator) {
+    std::vector<DataPos> payloadsPos;
+    for (auto& expr : expressions) {
+        payloadsPos.push_back(getDataPos(*expr, *schema));
+    }
+    auto tableSchema = FactorizedTableUtils::createFTableSchema(expressions, *schema);
+    auto opInfo = StreamingResultCollectorInfo(std::move(tableSchema), std::move(payloadsPos));
+    auto printInfo =
+        std::make_unique<ResultCollectorPrintInfo>(expressions, AccumulateType::REGULAR);
+    auto op = std::make_unique<StreamingResultCollector>(std::move(opInfo), std::move(sharedState),
+        storage::MemoryManager::Get(*clientContext), std::move(prevOperator), getOperatorID(),
+        std::move(printInfo));
+    op->setDescriptor(std::make_unique<ResultSetDescriptor>(schema));
+    return op;
+}
+
+} // namespace processor
+} // namespace lbug
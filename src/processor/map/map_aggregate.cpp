@@ -113,8 +113,9 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapAggregate(const LogicalOperator
     auto inSchema = child->getSchema();
     auto prevOperator = mapOperator(child);
     if (agg.hasKeys()) {
+        auto& keyRange = agg.getKeyRange();
         return createHashAggregate(agg.getKeys(), agg.getDependentKeys(), aggregates, inSchema,
-            outSchema, std::move(prevOperator));
+            outSchema, std::move(prevOperator), keyRange.has_value() ? &*keyRange : nullptr);
     }
     auto aggFunctions = getAggFunctions(aggregates);
     auto aggOutputPos = getDataPos(aggregates, *outSchema);
@@ -174,7 +175,8 @@ std::unique_ptr<PhysicalOperator> PlanMapper::createDistinctHashAggregate(
 // need to hash or compare payloads.
 std::unique_ptr<PhysicalOperator> PlanMapper::createHashAggregate(const expression_vector& keys,
     const expression_vector& payloads, const expression_vector& aggregates, Schema* inSchema,
-    Schema* outSchema, std::unique_ptr<PhysicalOperator> prevOperator) {
+    Schema* outSchema, std::unique_ptr<PhysicalOperator> prevOperator,
+    const AggregateKeyRange* keyRange) {
     // Create hash aggregate
     auto aggFunctions = getAggFunctions(aggregates);
     expression_vector allKeys;
@@ -196,11 +198,17 @@ std::unique_ptr<PhysicalOperator> PlanMapper::createHashAggregate(const expressi
     auto tableSchema = getFactorizedTableSchema(flatKeys, unFlatKeys, payloads, aggFunctions);
     HashAggregateInfo aggregateInfo{getDataPos(flatKeys, *inSchema),
         getDataPos(unFlatKeys, *inSchema), getDataPos(payloads, *inSchema), std::move(tableSchema)};
+    auto printInfo = std::make_unique<HashAggregatePrintInfo>(allKeys, aggregates);
+    if (keyRange != nullptr) {
+        aggregateInfo.denseMinKey = keyRange->minKey;
+        aggregateInfo.numDenseKeys = keyRange->numKeys;
+        printInfo->denseMinKey = keyRange->minKey;
+        printInfo->numDenseKeys = keyRange->numKeys;
+    }
 
     auto sharedState =
         std::make_shared<HashAggregateSharedState>(clientContext, std::move(aggregateInfo),
             aggFunctions, aggregateInputInfos, std::move(keyTypes), std::move(payloadTypes));
-    auto printInfo = std::make_unique<HashAggregatePrintInfo>(allKeys, aggregates);
     auto aggregate = make_unique<HashAggregate>(sharedState, std::move(aggFunctions),
         std::move(aggregateInputInfos), std::move(prevOperator), getOperatorID(),
         printInfo->copy());
@@ -1,9 +1,12 @@
 #include "binder/expression/expression_util.h"
+#include "planner/join_order/cardinality_feedback.h"
 #include "planner/operator/logical_hash_join.h"
 #include "processor/operator/hash_join/hash_join_build.h"
 #include "processor/operator/hash_join/hash_join_probe.h"
+#include "processor/operator/scan/scan_node_table.h"
 #include "processor/plan_mapper.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/predicate/bloom_filter_predicate.h"
 
 using namespace lbug::binder;
 using namespace lbug::planner;
@@ -59,6 +62,36 @@ HashJoinBuildInfo PlanMapper::createHashBuildInfo(const Schema& buildSideSchema,
         std::move(tableSchema));
 }
 
+// Passes the filter to the scan at the start of the probe pipeline. Rows dropped by the filter
+// would be dropped by this join anyway, so only operators that keep key values as they are may sit
+// in between.
+static std::shared_ptr<common::BloomFilter> tryPassKeyFilterToScan(PhysicalOperator* op,
+    const Expression& probeKey, const DataPos& probeKeyPos) {
+    while (true) {
+        switch (op->getOperatorType()) {
+        case PhysicalOperatorType::FILTER:
+        case PhysicalOperatorType::FLATTEN:
+        case PhysicalOperatorType::PROJECTION:
+        case PhysicalOperatorType::HASH_JOIN_PROBE:
+        case PhysicalOperatorType::SCAN_REL_TABLE: {
+            op = op->getChild(0);
+        } break;
+        case PhysicalOperatorType::SCAN_NODE_TABLE: {
+            auto filter = std::make_shared<common::BloomFilter>();
+            auto predicate =
+                std::make_shared<storage::ColumnBloomFilterPredicate>(probeKey.toString(), filter);
+            if (!op->ptrCast<ScanNodeTable>()->addRuntimePredicate(probeKeyPos,
+                    std::move(predicate))) {
+                return nullptr;
+            }
+            return filter;
+        }
+        default:
+            return nullptr;
+        }
+    }
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(const LogicalOperator* logicalOperator) {
     auto hashJoin = logicalOperator->constPtrCast<LogicalHashJoin>();
     auto outSchema = hashJoin->getSchema();
@@ -84,6 +117,10 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(const LogicalOperator*
         ExpressionUtil::excludeExpressions(hashJoin->getExpressionsToMaterialize(), probeKeys);
     // Create build
     auto buildInfo = createHashBuildInfo(*buildSchema, buildKeys, payloads);
+    if (CardinalityFeedback::Get(*clientContext)->canReoptimize()) {
+        buildInfo.subgraphKey = hashJoin->getBuildSubgraphKey();
+        buildInfo.estimatedCardinality = hashJoin->getEstimatedBuildCardinality();
+    }
     auto globalHashTable =
         std::make_unique<JoinHashTable>(*storage::MemoryManager::Get(*clientContext),
             LogicalType::copy(buildKeyTypes), buildInfo.tableSchema.copy());
@@ -110,6 +147,11 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(const LogicalOperator*
     } else {
         probeDataInfo.markDataPos = DataPos::getInvalidPos();
     }
+    if (hashJoin->shouldPassKeyFilter()) {
+        KU_ASSERT(probeKeys.size() == 1);
+        sharedState->setKeyFilter(tryPassKeyFilterToScan(probeSidePrevOperator.get(),
+            *probeKeys[0], probeKeysDataPos[0]));
+    }
     auto probePrintInfo = std::make_unique<HashJoinProbePrintInfo>(probeKeys);
     auto hashJoinProbe = make_unique<HashJoinProbe>(sharedState, hashJoin->getJoinType(),
         hashJoin->requireFlatProbeKeys(), probeDataInfo, std::move(probeSidePrevOperator),
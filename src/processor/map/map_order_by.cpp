@@ -7,6 +7,7 @@
 #include "processor/operator/order_by/order_by_scan.h"
 #include "processor/operator/order_by/top_k.h"
 #include "processor/operator/order_by/top_k_scanner.h"
+#include "processor/operator/scan/scan_node_table.h"
 #include "processor/plan_mapper.h"
 
 using namespace lbug::binder;
@@ -16,6 +17,29 @@ using namespace lbug::planner;
 namespace lbug {
 namespace processor {
 
+// Lets the scan feeding the TOP-K skip rows whose first key cannot enter the top k. Only operators
+// that neither change the key values nor depend on the rows they drop may sit in between.
+static std::shared_ptr<storage::TopKBoundary> tryPushBoundaryToScan(PhysicalOperator* op,
+    const Expression& key, const DataPos& keyPos, bool isAscOrder) {
+    if (!storage::TopKBoundary::isSupportedType(key.getDataType().getPhysicalType())) {
+        return nullptr;
+    }
+    while (op->getOperatorType() == PhysicalOperatorType::FILTER ||
+           op->getOperatorType() == PhysicalOperatorType::PROJECTION ||
+           op->getOperatorType() == PhysicalOperatorType::FLATTEN) {
+        op = op->getChild(0);
+    }
+    if (op->getOperatorType() != PhysicalOperatorType::SCAN_NODE_TABLE) {
+        return nullptr;
+    }
+    auto boundary = std::make_shared<storage::TopKBoundary>(isAscOrder);
+    auto predicate = std::make_shared<storage::ColumnTopKPredicate>(key.toString(), boundary);
+    if (!op->ptrCast<ScanNodeTable>()->addRuntimePredicate(keyPos, std::move(predicate))) {
+        return nullptr;
+    }
+    return boundary;
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapOrderBy(const LogicalOperator* logicalOperator) {
     auto& logicalOrderBy = logicalOperator->constCast<LogicalOrderBy>();
     auto outSchema = logicalOrderBy.getSchema();
@@ -78,6 +102,8 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapOrderBy(const LogicalOperator*
             skipNum = ExpressionUtil::evaluateAsSkipLimit(*skipExpr);
         }
         auto topKSharedState = std::make_shared<TopKSharedState>();
+        topKSharedState->keyBoundary = tryPushBoundaryToScan(prevOperator.get(),
+            *keyExpressions[0], keysPos[0], logicalOrderBy.getIsAscOrders()[0]);
         auto printInfo =
             std::make_unique<TopKPrintInfo>(keyExpressions, payloadExpressions, skipNum, limitNum);
         auto topK = make_unique<TopK>(std::move(orderByDataInfo), topKSharedState, skipNum,
@@ -26,7 +26,8 @@ std::unique_ptr<NodeOffsetMaskMap> createNodeOffsetMaskMap(const Expression& exp
 std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(
     const LogicalOperator* logicalOperator) {
     auto& extend = logicalOperator->constCast<LogicalRecursiveExtend>();
-    auto& bindData = extend.getBindData();
+    auto bindData = extend.getBindData();
+    bindData.bidirectional = extend.canSearchBidirectionally();
     auto columns = extend.getResultColumns();
     auto tableSchema = createFlatFTableSchema(columns, *extend.getSchema());
     auto table = std::make_shared<FactorizedTable>(storage::MemoryManager::Get(*clientContext),
@@ -23,12 +23,16 @@ PlanMapper::PlanMapper(ExecutionContext* executionContext)
 
 std::unique_ptr<PhysicalPlan> PlanMapper::getPhysicalPlan(const LogicalPlan* logicalPlan,
     const expression_vector& expressions, main::QueryResultType resultType,
-    ArrowResultConfig arrowConfig) {
+    ArrowResultConfig arrowConfig, std::shared_ptr<StreamingResultSharedState> streamingState) {
     auto root = mapOperator(logicalPlan->getLastOperator().get());
     if (!root->isSink()) {
         if (resultType == main::QueryResultType::ARROW) {
             root = createArrowResultCollector(arrowConfig, expressions, logicalPlan->getSchema(),
                 std::move(root));
+        } else if (resultType == main::QueryResultType::STREAM) {
+            KU_ASSERT(streamingState != nullptr);
+            root = createStreamingResultCollector(std::move(streamingState), expressions,
+                logicalPlan->getSchema(), std::move(root));
         } else {
             root = createResultCollector(AccumulateType::REGULAR, expressions,
                 logicalPlan->getSchema(), std::move(root));
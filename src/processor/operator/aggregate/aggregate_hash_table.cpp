@@ -12,6 +12,7 @@
 #include "common/types/types.h"
 #include "common/utils.h"
 #include "common/vector/value_vector.h"
+#include "function/hash/hash_functions.h"
 #include "processor/operator/aggregate/aggregate_input.h"
 #include "processor/result/factorized_table.h"
 #include "processor/result/factorized_table_schema.h"
@@ -194,6 +195,7 @@ void AggregateHashTable::initializeFT(const std::vector<AggregateFunction>& aggF
     for (auto i = 0u; i < aggFuncs.size(); i++) {
         auto& aggFunc = aggFuncs[i];
         aggregateFunctions.push_back(aggFunc.copy());
+        hasUpdateBatchFuncs |= !aggFunc.isDistinct && aggFunc.hasUpdateBatchFunc();
     }
     hashColIdxInFT = tableSchema.getNumColumns() - 1;
     hashColOffsetInFT = tableSchema.getColOffset(hashColIdxInFT);
@@ -213,6 +215,7 @@ void AggregateHashTable::initializeHashTable(uint64_t numEntriesToAllocate) {
 
 void AggregateHashTable::initializeTmpVectors() {
     hashSlotsToUpdateAggState = std::make_unique<HashSlot*[]>(DEFAULT_VECTOR_CAPACITY);
+    entriesToUpdateAggState = std::make_unique<uint8_t*[]>(DEFAULT_VECTOR_CAPACITY);
     tmpValueIdxes = std::make_unique<uint64_t[]>(DEFAULT_VECTOR_CAPACITY);
     entryIdxesToInitialize = std::make_unique<uint64_t[]>(DEFAULT_VECTOR_CAPACITY);
     mayMatchIdxes = std::make_unique<uint64_t[]>(DEFAULT_VECTOR_CAPACITY);
@@ -500,8 +503,57 @@ void AggregateHashTable::increaseHashSlotIdxes(uint64_t numNoMatches) {
     }
 }
 
+template<typename T>
+void AggregateHashTable::findHashSlotsWithSingleKey(const ValueVector& keyVector) {
+    KU_ASSERT(keyTypes.size() == 1 && getTableSchema()->getColOffset(0) == 0);
+    const auto keys = reinterpret_cast<const T*>(keyVector.getData());
+    const auto nullMapOffset = getTableSchema()->getNullMapOffset();
+    keyVector.state->getSelVector().forEach([&](auto pos) {
+        const auto hash = hashVector->getValue<hash_t>(pos);
+        const auto& key = keys[pos];
+        auto slotIdx = getSlotIdxForHash(hash);
+        HashSlot* slot = nullptr;
+        while (true) {
+            slot = getHashSlot(slotIdx);
+            auto entry = slot->getEntry();
+            if (entry == nullptr) {
+                entry = factorizedTable->appendEmptyTuple();
+                *slot = HashSlot(hash, entry);
+                memcpy(entry, &key, sizeof(T));
+                fillEntryWithInitialNullAggregateState(*factorizedTable, entry);
+                factorizedTable->updateFlatCellNoNull(entry, hashColIdxInFT, (void*)&hash);
+                break;
+            }
+            if (slot->checkFingerprint(hash) &&
+                !factorizedTable->isNonOverflowColNull(entry + nullMapOffset, 0 /* colIdx */) &&
+                *reinterpret_cast<const T*>(entry) == key) {
+                break;
+            }
+            increaseSlotIdx(slotIdx);
+        }
+        hashSlotsToUpdateAggState[pos] = slot;
+    });
+}
+
 void AggregateHashTable::findHashSlots(const std::vector<ValueVector*>& keyVectors,
     const std::vector<ValueVector*>& dependentKeyVectors, const DataChunkState* leadingState) {
+    if (keyVectors.size() == 1 && dependentKeyVectors.empty() &&
+        !keyVectors[0]->state->isFlat() && keyVectors[0]->hasNoNullsGuarantee()) {
+        auto& keyVector = *keyVectors[0];
+        auto isSpecialized = false;
+        TypeUtils::visit(
+            keyVector.dataType.getPhysicalType(),
+            [&]<typename T>(T)
+                requires(IntegerTypes<T> || std::is_same_v<T, internalID_t>)
+            {
+                findHashSlotsWithSingleKey<T>(keyVector);
+                isSpecialized = true;
+            },
+            [](auto) {});
+        if (isSpecialized) {
+            return;
+        }
+    }
     initTmpHashSlotsAndIdxes();
     auto numEntriesToFindHashSlots = leadingState->getSelSize();
     KU_ASSERT(getNumEntries() + numEntriesToFindHashSlots < maxNumHashSlots);
@@ -579,7 +631,14 @@ void AggregateHashTable::updateAggState(const std::vector<ValueVector*>& keyVect
     uint32_t aggStateOffset, const DataChunkState* leadingState) {
     //  There may be a mix of flat and unflat states, but any unflat states will be the same
     bool allFlat = leadingState->isFlat();
-    if (!aggVector) {
+    // Groups and input values are in the same data chunk, so the states of all groups can be
+    // updated with a single call to the specialized update function of the aggregate.
+    if (!allFlat && aggregateFunction.hasUpdateBatchFunc() &&
+        (!aggVector || aggVector->state.get() == leadingState)) {
+        aggregateFunction.updateBatchState(entriesToUpdateAggState.get(), aggStateOffset,
+            aggVector, leadingState->getSelVector(), multiplicity,
+            factorizedTable->getInMemOverflowBuffer());
+    } else if (!aggVector) {
         updateNullAggVectorState(*leadingState, aggregateFunction, multiplicity, aggStateOffset);
     } else if (aggVector->state->isFlat() && allFlat) {
         updateBothFlatAggVectorState(aggregateFunction, aggVector, multiplicity, aggStateOffset);
@@ -601,6 +660,11 @@ void AggregateHashTable::updateAggState(const std::vector<ValueVector*>& keyVect
 void AggregateHashTable::updateAggStates(const std::vector<ValueVector*>& keyVectors,
     const std::vector<AggregateInput>& aggregateInputs, uint64_t resultSetMultiplicity,
     const DataChunkState* leadingState) {
+    if (!leadingState->isFlat() && hasUpdateBatchFuncs) {
+        leadingState->getSelVector().forEach([&](auto pos) {
+            entriesToUpdateAggState[pos] = hashSlotsToUpdateAggState[pos]->getEntry();
+        });
+    }
     auto aggregateStateOffset = aggStateColOffsetInFT;
     for (auto i = 0u; i < aggregateFunctions.size(); i++) {
         if (!aggregateFunctions[i].isDistinct) {
@@ -774,6 +838,10 @@ uint64_t PartitioningAggregateHashTable::append(const std::vector<ValueVector*>&
     const common::DataChunkState* leadingState, const std::vector<AggregateInput>& aggregateInputs,
     uint64_t resultSetMultiplicity) {
     const auto numFlatTuples = leadingState->getSelVector().getSelSize();
+    if (!denseSlots.empty() && findDenseSlots(keyVectors, dependentKeyVectors)) {
+        updateAggStates(keyVectors, aggregateInputs, resultSetMultiplicity, leadingState);
+        return numFlatTuples;
+    }
 
     mergeIfFull(numFlatTuples);
 
@@ -869,6 +937,70 @@ void PartitioningAggregateHashTable::mergeIfFull(uint64_t tuplesToAdd, bool merg
     }
 }
 
+void PartitioningAggregateHashTable::setDenseKeyRange(int64_t minKey, uint64_t numKeys) {
+    KU_ASSERT(keyTypes.size() == 1 && getTableSchema()->getColOffset(0) == 0);
+    denseMinKey = minKey;
+    denseSlots.resize(numKeys, HashSlot(0 /* hash */, nullptr /* entry */));
+    denseTable = std::make_unique<FactorizedTable>(memoryManager, tableSchema.copy());
+}
+
+bool PartitioningAggregateHashTable::findDenseSlots(const std::vector<ValueVector*>& keyVectors,
+    const std::vector<ValueVector*>& dependentKeyVectors) {
+    if (keyVectors.size() != 1 || !dependentKeyVectors.empty() ||
+        keyVectors[0]->state->isFlat() || !keyVectors[0]->hasNoNullsGuarantee()) {
+        return false;
+    }
+    auto& keyVector = *keyVectors[0];
+    auto found = false;
+    TypeUtils::visit(
+        keyVector.dataType.getPhysicalType(),
+        [&]<typename T>(T)
+            requires(std::integral<T> && !std::is_same_v<T, bool>)
+        { found = findDenseSlots<T>(keyVector); },
+        [](auto) {});
+    return found;
+}
+
+template<typename T>
+bool PartitioningAggregateHashTable::findDenseSlots(const ValueVector& keyVector) {
+    const auto keys = reinterpret_cast<const T*>(keyVector.getData());
+    auto& selVector = keyVector.state->getSelVector();
+    // Computed modulo 2^64, so that keys smaller than the minimum wrap around to large offsets.
+    const auto getOffset = [&](T key) {
+        return static_cast<uint64_t>(key) - static_cast<uint64_t>(denseMinKey);
+    };
+    auto allInRange = true;
+    selVector.forEach([&](auto pos) { allInRange &= getOffset(keys[pos]) < denseSlots.size(); });
+    if (!allInRange) {
+        return false;
+    }
+    selVector.forEach([&](auto pos) {
+        auto& slot = denseSlots[getOffset(keys[pos])];
+        if (slot.getEntry() == nullptr) {
+            auto entry = denseTable->appendEmptyTuple();
+            memcpy(entry, &keys[pos], sizeof(T));
+            fillEntryWithInitialNullAggregateState(*denseTable, entry);
+            hash_t hash = 0;
+            Hash::operation(keys[pos], hash);
+            denseTable->updateFlatCellNoNull(entry, hashColIdxInFT, (void*)&hash);
+            slot = HashSlot(hash, entry);
+        }
+        hashSlotsToUpdateAggState[pos] = &slot;
+    });
+    return true;
+}
+
+void PartitioningAggregateHashTable::mergeDenseEntries() {
+    if (denseTable == nullptr || denseTable->getNumTuples() == 0) {
+        return;
+    }
+    partitioningData->appendTuples(*denseTable,
+        tableSchema.getColOffset(tableSchema.getNumColumns() - 1));
+    partitioningData->appendOverflow(std::move(*denseTable->getInMemOverflowBuffer()));
+    denseTable->clear();
+    std::fill(denseSlots.begin(), denseSlots.end(), HashSlot(0 /* hash */, nullptr /* entry */));
+}
+
 void AggregateHashTable::clear() {
     factorizedTable->clear();
     // Clear hash table
@@ -31,6 +31,10 @@ std::string HashAggregatePrintInfo::toString() const {
     if (limitNum != UINT64_MAX) {
         result += ", Distinct Limit: " + std::to_string(limitNum);
     }
+    if (numDenseKeys > 0) {
+        result += ", Key Range: [" + std::to_string(denseMinKey) + ", " +
+                  std::to_string(denseMinKey + static_cast<int64_t>(numDenseKeys) - 1) + "]";
+    }
     return result;
 }
 
@@ -42,7 +46,8 @@ HashAggregateInfo::HashAggregateInfo(std::vector<DataPos> flatKeysPos,
 
 HashAggregateInfo::HashAggregateInfo(const HashAggregateInfo& other)
     : flatKeysPos{other.flatKeysPos}, unFlatKeysPos{other.unFlatKeysPos},
-      dependentKeysPos{other.dependentKeysPos}, tableSchema{other.tableSchema.copy()} {}
+      dependentKeysPos{other.dependentKeysPos}, tableSchema{other.tableSchema.copy()},
+      denseMinKey{other.denseMinKey}, numDenseKeys{other.numDenseKeys} {}
 
 HashAggregateSharedState::HashAggregateSharedState(main::ClientContext* context,
     HashAggregateInfo hashAggInfo,
@@ -230,6 +235,9 @@ void HashAggregateLocalState::init(HashAggregateSharedState* sharedState, Result
     aggregateHashTable = std::make_unique<PartitioningAggregateHashTable>(sharedState,
         *MemoryManager::Get(*context), std::move(keyDataTypes), std::move(payloadDataTypes),
         aggregateFunctions, std::move(distinctKeyTypes), info.tableSchema.copy());
+    if (info.numDenseKeys > 0) {
+        aggregateHashTable->setDenseKeyRange(info.denseMinKey, info.numDenseKeys);
+    }
 }
 
 uint64_t HashAggregateLocalState::append(const std::vector<AggregateInput>& aggregateInputs,
@@ -259,6 +267,7 @@ void HashAggregate::executeInternal(ExecutionContext* context) {
         }
     }
     localState.aggregateHashTable->mergeIfFull(0 /*tuplesToAdd*/, true /*mergeAll*/);
+    localState.aggregateHashTable->mergeDenseEntries();
 }
 
 } // namespace processor
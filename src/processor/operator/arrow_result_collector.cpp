@@ -35,6 +35,20 @@ void ArrowResultCollectorLocalState::resetCursor() {
     }
 }
 
+bool ArrowResultCollectorLocalState::getUnflatChunk(DataChunk*& unflatChunk) const {
+    unflatChunk = nullptr;
+    for (auto chunk : chunks) {
+        if (chunk->state->isFlat()) {
+            continue;
+        }
+        if (unflatChunk != nullptr) {
+            return false;
+        }
+        unflatChunk = chunk;
+    }
+    return true;
+}
+
 void ArrowResultCollectorSharedState::merge(const std::vector<ArrowArray>& localArrays) {
     std::unique_lock lck{mutex};
     for (auto i = 0u; i < localArrays.size(); ++i) {
@@ -43,17 +57,22 @@ void ArrowResultCollectorSharedState::merge(const std::vector<ArrowArray>& local
 }
 
 void ArrowResultCollector::executeInternal(ExecutionContext* context) {
-    auto rowBatch = std::make_unique<ArrowRowBatch>(info.columnTypes, info.chunkSize,
-        false /* fallbackExtensionTypes */);
+    auto rowBatch = createRowBatch();
     while (children[0]->getNextTuple(context)) {
+        // If at most one chunk is unflat, the tuples are appended to the arrow batch straight from
+        // the vectors. Otherwise, the cartesian product of chunks is appended tuple by tuple.
+        DataChunk* unflatChunk = nullptr;
+        if (localState.getUnflatChunk(unflatChunk)) {
+            appendVectors(unflatChunk, rowBatch);
+            continue;
+        }
         localState.resetCursor();
         while (true) {
             if (!fillRowBatch(*rowBatch)) {
                 break;
             }
             localState.arrays.push_back(rowBatch->toArray(info.columnTypes));
-            rowBatch = std::make_unique<ArrowRowBatch>(info.columnTypes, info.chunkSize,
-                false /* fallbackExtensionTypes */);
+            rowBatch = createRowBatch();
         }
     }
     // Handle the last rowBatch whose size can be smaller than chunk size.
@@ -63,6 +82,27 @@ void ArrowResultCollector::executeInternal(ExecutionContext* context) {
     sharedState->merge(localState.arrays);
 }
 
+void ArrowResultCollector::appendVectors(DataChunk* unflatChunk,
+    std::unique_ptr<ArrowRowBatch>& rowBatch) {
+    auto numTuples = unflatChunk == nullptr ? 1 : unflatChunk->state->getSelSize();
+    sel_t numAppended = 0;
+    while (numAppended < numTuples) {
+        auto numToAppend = std::min<int64_t>(numTuples - numAppended,
+            info.chunkSize - rowBatch->size());
+        rowBatch->append(localState.vectors, numAppended, numToAppend);
+        numAppended += numToAppend;
+        if (rowBatch->size() == info.chunkSize) {
+            localState.arrays.push_back(rowBatch->toArray(info.columnTypes));
+            rowBatch = createRowBatch();
+        }
+    }
+}
+
+std::unique_ptr<ArrowRowBatch> ArrowResultCollector::createRowBatch() const {
+    return std::make_unique<ArrowRowBatch>(info.columnTypes, info.chunkSize,
+        false /* fallbackExtensionTypes */);
+}
+
 bool ArrowResultCollector::fillRowBatch(ArrowRowBatch& rowBatch) {
     while (rowBatch.size() < info.chunkSize) {
         localState.fillTuple();
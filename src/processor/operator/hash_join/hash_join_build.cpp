@@ -1,7 +1,11 @@
 #include "processor/operator/hash_join/hash_join_build.h"
 
 #include "binder/expression/expression_util.h"
+#include "common/exception/reoptimization.h"
+#include "main/client_context.h"
+#include "planner/join_order/cardinality_feedback.h"
 #include "processor/execution_context.h"
+#include "processor/operator/scan/scan_node_table.h"
 #include "storage/buffer_manager/memory_manager.h"
 
 using namespace lbug::common;
@@ -25,6 +29,18 @@ void HashJoinSharedState::mergeLocalHashTable(JoinHashTable& localHashTable) {
     hashTable->merge(localHashTable);
 }
 
+void HashJoinSharedState::buildKeyFilter() {
+    if (keyFilter == nullptr) {
+        return;
+    }
+    const auto numEntries = hashTable->getNumEntries();
+    if (numEntries > MAX_NUM_KEY_FILTER_ENTRIES) {
+        return;
+    }
+    keyFilter->init(numEntries);
+    hashTable->insertHashes(*keyFilter);
+}
+
 void HashJoinBuild::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     std::vector<LogicalType> keyTypes;
     for (auto i = 0u; i < info.keysPos.size(); ++i) {
@@ -41,6 +57,12 @@ void HashJoinBuild::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
     for (auto& pos : info.payloadsPos) {
         payloadVectors.push_back(resultSet->getValueVector(pos).get());
     }
+    for (auto& pos : info.keysPos) {
+        dataChunksPosInScope.insert(pos.dataChunkPos);
+    }
+    for (auto& pos : info.payloadsPos) {
+        dataChunksPosInScope.insert(pos.dataChunkPos);
+    }
     hashTable = std::make_unique<JoinHashTable>(*MemoryManager::Get(*context->clientContext),
         std::move(keyTypes), info.tableSchema.copy());
 }
@@ -53,21 +75,69 @@ void HashJoinBuild::setKeyState(common::DataChunkState* state) {
     }
 }
 
-void HashJoinBuild::finalizeInternal(ExecutionContext* /*context*/) {
+// Operators whose output may be restricted by a semi mask. The number of tuples they produce says
+// little about the size of the subgraph they match.
+static bool mayBeSemiMasked(const PhysicalOperator& op) {
+    switch (op.getOperatorType()) {
+    case PhysicalOperatorType::SCAN_NODE_TABLE: {
+        for (auto& [_, mask] : ku_dynamic_cast<const ScanNodeTable*>(&op)->getSemiMasks()) {
+            if (mask != nullptr && mask->isEnabled()) {
+                return true;
+            }
+        }
+    } break;
+    case PhysicalOperatorType::TABLE_FUNCTION_CALL:
+    case PhysicalOperatorType::RECURSIVE_EXTEND:
+        return true;
+    default:
+        break;
+    }
+    for (auto i = 0u; i < op.getNumChildren(); ++i) {
+        if (mayBeSemiMasked(*op.getChild(i))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void HashJoinBuild::checkCardinalityEstimate(ExecutionContext* context) const {
+    const auto feedback = planner::CardinalityFeedback::Get(*context->clientContext);
+    if (info.subgraphKey.empty() || !feedback->canReoptimize()) {
+        return;
+    }
+    const auto numTuples = sharedState->getNumBuildTuples();
+    const auto threshold = context->clientContext->getClientConfig()->reoptimizationThreshold;
+    if (!planner::CardinalityFeedback::isMisestimated(info.estimatedCardinality, numTuples,
+            threshold) ||
+        mayBeSemiMasked(*children[0])) {
+        return;
+    }
+    feedback->addObservedCardinality(info.subgraphKey, numTuples);
+    throw ReoptimizationException();
+}
+
+void HashJoinBuild::finalizeInternal(ExecutionContext* context) {
+    checkCardinalityEstimate(context);
     auto numTuples = sharedState->getHashTable()->getNumEntries();
     sharedState->getHashTable()->allocateHashSlots(numTuples);
     sharedState->getHashTable()->buildHashSlots();
+    sharedState->buildKeyFilter();
 }
 
 void HashJoinBuild::executeInternal(ExecutionContext* context) {
     // Append thread-local tuples
+    uint64_t numBuildTuples = 0;
     while (children[0]->getNextTuple(context)) {
         uint64_t numAppended = 0u;
         for (auto i = 0u; i < resultSet->multiplicity; ++i) {
             numAppended += appendVectors();
         }
         metrics->numOutputTuple.increase(numAppended);
+        if (!info.subgraphKey.empty()) {
+            numBuildTuples += resultSet->getNumTuples(dataChunksPosInScope);
+        }
     }
+    sharedState->addNumBuildTuples(numBuildTuples);
     // Merge with global hash table once local tuples are all appended.
     sharedState->mergeLocalHashTable(*hashTable);
 }
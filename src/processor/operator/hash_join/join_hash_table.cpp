@@ -126,6 +126,17 @@ void JoinHashTable::buildHashSlots() {
     }
 }
 
+void JoinHashTable::insertHashes(BloomFilter& filter) {
+    const auto hashColOffset = getHashValueColOffset();
+    for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
+        const uint8_t* tuple = tupleBlock->getData();
+        for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+            filter.insert(*reinterpret_cast<const hash_t*>(tuple + hashColOffset));
+            tuple += getTableSchema()->getNumBytesPerTuple();
+        }
+    }
+}
+
 void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVector& hashVector,
     SelectionVector& hashSelVec, ValueVector* tmpHashResultVector, uint8_t** probedTuples) {
     KU_ASSERT(keyVectors.size() == keyTypes.size());
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 
+#include "common/sorted_set_intersection.h"
 #include "function/hash/hash_functions.h"
 #include "processor/result/factorized_table.h"
 
@@ -67,6 +68,26 @@ void Intersect::twoWayIntersect(nodeID_t* leftNodeIDs, SelectionVector& lSelVect
     KU_ASSERT(lSelVector.getSelSize() <= rSelVector.getSelSize());
     auto leftPositionBuffer = lSelVector.getMutableBuffer();
     auto rightPositionBuffer = rSelVector.getMutableBuffer();
+    const auto leftSize = lSelVector.getSelSize();
+    const auto rightSize = rSelVector.getSelSize();
+    // Lists are sorted by (tableID, offset), so a list is single-table if its first and last node
+    // IDs are. Such lists are intersected on their offsets with the SIMD/galloping kernel.
+    if (leftSize > 0 && rightSize > 0 &&
+        leftNodeIDs[0].tableID == leftNodeIDs[leftSize - 1].tableID &&
+        rightNodeIDs[0].tableID == rightNodeIDs[rightSize - 1].tableID) {
+        uint64_t numMatches = 0;
+        if (leftNodeIDs[0].tableID == rightNodeIDs[0].tableID) {
+            numMatches = SortedSetIntersection::intersect(leftNodeIDs, leftSize, rightNodeIDs,
+                rightSize, leftPositionBuffer.data(), rightPositionBuffer.data());
+            // Positions are ascending, so compacting in place never overwrites an unread value.
+            for (auto i = 0u; i < numMatches; i++) {
+                leftNodeIDs[i] = leftNodeIDs[leftPositionBuffer[i]];
+            }
+        }
+        lSelVector.setToFiltered(numMatches);
+        rSelVector.setToFiltered(numMatches);
+        return;
+    }
     sel_t leftPosition = 0, rightPosition = 0;
     uint64_t outputValuePosition = 0;
     while (leftPosition < lSelVector.getSelSize() && rightPosition < rSelVector.getSelSize()) {
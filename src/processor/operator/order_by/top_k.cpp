@@ -190,6 +190,11 @@ void TopKBuffer::setBoundaryValue() {
         boundaryVec->copyFromVectorData(dstData, srcVector, srcData);
         hasBoundaryValue = true;
     }
+    auto& boundaryVec = *boundaryVecs[0];
+    auto pos = boundaryVec.state->getSelVector()[0];
+    if (keyBoundary != nullptr && !boundaryVec.isNull(pos)) {
+        keyBoundary->update(*boundaryVec.getAsValue(pos));
+    }
 }
 
 bool TopKBuffer::compareBoundaryValue(const std::vector<common::ValueVector*>& keyVectors) {
@@ -262,6 +267,7 @@ void TopK::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* contex
     localState = TopKLocalState();
     localState.init(info, storage::MemoryManager::Get(*context->clientContext), *resultSet,
         skipNumber, limitNumber);
+    localState.buffer->keyBoundary = sharedState->keyBoundary.get();
     for (auto& dataPos : info.payloadsPos) {
         payloadVectors.push_back(resultSet->getValueVector(dataPos).get());
     }
@@ -185,6 +185,11 @@ void RelBatchInsert::appendNodeGroup(const RelGroupCatalogEntry& relGroupEntry,
     KU_ASSERT(localState.chunkedGroup->getNumRows() == maxSize);
 
     auto* relTable = sharedState->table->ptrCast<RelTable>();
+    DegreeStats degreeStats;
+    for (auto i = 0u; i < numNodes; i++) {
+        degreeStats.addNode(csrHeader.getCSRLength(i));
+    }
+    relTable->mergeDegreeStats(relInfo.direction, degreeStats);
 
     InMemChunkedCSRNodeGroup sliceToWriteToDisk{
         ku_dynamic_cast<InMemChunkedCSRNodeGroup&>(*localState.chunkedGroup),
@@ -1,8 +1,11 @@
 #include "processor/operator/profile.h"
 
+#include "main/client_context.h"
 #include "main/plan_printer.h"
 #include "processor/execution_context.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/buffer_manager/query_memory_tracker.h"
+#include <format>
 
 using namespace lbug::common;
 
@@ -10,8 +13,12 @@ namespace lbug {
 namespace processor {
 
 void Profile::executeInternal(ExecutionContext* context) {
-    const auto planInString =
+    auto planInString =
         main::PlanPrinter::printPlanToOstream(info.physicalPlan, context->profiler).str();
+    if (const auto& memoryTracker = context->clientContext->getQueryMemoryTracker()) {
+        planInString +=
+            std::format("Peak Memory Usage: {} bytes\n", memoryTracker->getPeakMemory());
+    }
     appendMessage(planInString, storage::MemoryManager::Get(*context->clientContext));
 }
 
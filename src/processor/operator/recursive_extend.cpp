@@ -1,11 +1,18 @@
 #include "processor/operator/recursive_extend.h"
 
+#include <bit>
+
 #include "binder/expression/node_expression.h"
 #include "binder/expression/property_expression.h"
 #include "common/task_system/progress_bar.h"
+#include "function/gds/bidirectional_bfs.h"
 #include "function/gds/compute.h"
 #include "function/gds/gds_function_collection.h"
 #include "function/gds/gds_utils.h"
+#include "function/gds/multi_source_bfs.h"
+#include "graph/graph_entry_set.h"
+#include "graph/landmark_index.h"
+#include "main/client_context.h"
 #include "processor/execution_context.h"
 #include "transaction/transaction.h"
 
@@ -83,6 +90,227 @@ static bool requireRelID(const RJAlgorithm& function) {
     return false;
 }
 
+void RecursiveExtend::writeOutput(ExecutionContext* context, GDSComputeState& computeState,
+    nodeID_t sourceNodeID) {
+    auto writer = function->getOutputWriter(context, bindData, computeState, sourceNodeID,
+        sharedState.get());
+    auto vertexCompute = std::make_unique<RJVertexCompute>(
+        storage::MemoryManager::Get(*context->clientContext), sharedState.get(), writer->copy(),
+        bindData.nodeOutput->constCast<NodeExpression>().getTableIDsSet());
+    GDSUtils::runVertexCompute(context, computeState.frontierPair->getState(),
+        sharedState->graph.get(), *vertexCompute);
+}
+
+// Returns the node if the mask map restricts nodes to exactly one node.
+static std::optional<nodeID_t> getSingleMaskedNode(const NodeOffsetMaskMap* maskMap) {
+    if (maskMap == nullptr || maskMap->getNumMaskedNode() != 1) {
+        return std::nullopt;
+    }
+    std::optional<nodeID_t> result;
+    for (auto& [tableID, mask] : maskMap->getMasks()) {
+        if (!mask->isEnabled()) {
+            // All nodes of the table are in scope.
+            return std::nullopt;
+        }
+        if (mask->getNumMaskedNodes() == 1) {
+            result = nodeID_t{mask->collectMaskedNodes(1)[0], tableID};
+        }
+    }
+    return result;
+}
+
+// Returns the landmark index of the graph in the given direction, built on first use, or nullptr
+// if the index is disabled or does not apply. Like projected graph copies, the index is only
+// shared by read-only transactions, which see exactly the snapshot it was built from.
+static std::shared_ptr<graph::LandmarkIndex> getLandmarkIndex(ExecutionContext* context,
+    graph::Graph* graph, ExtendDirection direction) {
+    auto clientContext = context->clientContext;
+    auto numLandmarks = clientContext->getClientConfig()->shortestPathLandmarks;
+    auto transaction = transaction::Transaction::Get(*clientContext);
+    if (numLandmarks == 0 || !transaction->isReadOnly()) {
+        return nullptr;
+    }
+    auto key = graph::LandmarkIndex::getKey(graph, direction);
+    if (key.empty()) {
+        return nullptr;
+    }
+    key += " l" + std::to_string(numLandmarks);
+    auto index = graph::GraphEntrySet::Get(*clientContext)
+                     ->getLandmarkIndex(key, direction, transaction->getStartTS());
+    if (!index->isBuilt()) {
+        index->build(context, graph, numLandmarks);
+    }
+    return index;
+}
+
+bool RecursiveExtend::tryExecuteBidirectional(ExecutionContext* context,
+    const std::vector<std::string>& propertyNames) {
+    auto sourceNodeID = getSingleMaskedNode(sharedState->getInputNodeMaskMap());
+    auto dstNodeID = getSingleMaskedNode(sharedState->getOutputNodeMaskMap());
+    if (!sourceNodeID.has_value() || !dstNodeID.has_value() || *sourceNodeID == *dstNodeID ||
+        !bindData.nodeInput->constCast<NodeExpression>().getTableIDsSet().contains(
+            sourceNodeID->tableID)) {
+        return false;
+    }
+    auto computeState = function->getComputeState(context, bindData, sharedState.get());
+    computeState->initSource(*sourceNodeID);
+    auto landmarkIndex =
+        getLandmarkIndex(context, sharedState->graph.get(), bindData.extendDirection);
+    if (landmarkIndex != nullptr &&
+        function->getFunctionName() == SingleSPDestinationsFunction::name) {
+        // The length is known without searching if the bounds of the index meet.
+        auto bounds = landmarkIndex->getBounds(*sourceNodeID, *dstNodeID);
+        if (bounds.lower > bindData.upperBound) {
+            return true;
+        }
+        if (bounds.lower == bounds.upper && bounds.upper != graph::LandmarkIndex::UNREACHED) {
+            auto frontier = computeState->frontierPair->ptrCast<SPFrontierPair>()->getFrontier();
+            frontier->pinTableID(dstNodeID->tableID);
+            frontier->addNode(*dstNodeID, bounds.lower);
+            writeOutput(context, *computeState, *sourceNodeID);
+            return true;
+        }
+    }
+    auto bfs = BidirectionalBFS(sharedState->graph.get(), propertyNames, landmarkIndex.get());
+    auto path = bfs.search(context, *sourceNodeID, *dstNodeID, bindData.extendDirection,
+        bindData.upperBound);
+    if (path.has_value()) {
+        BidirectionalBFS::populateComputeState(*path, *computeState,
+            function->getFunctionName() == SingleSPPathsFunction::name);
+        writeOutput(context, *computeState, *sourceNodeID);
+    }
+    return true;
+}
+
+// Writes the shortest path length from each source of a batch to the destinations reached in a
+// level of a multi-source BFS. Same output as SSPDestinationsOutputWriter.
+class MultiSourceSPOutputWriter : public MultiSourceBFSOutputWriter {
+public:
+    MultiSourceSPOutputWriter(storage::MemoryManager* mm, RecursiveExtendSharedState* sharedState,
+        const std::vector<nodeID_t>& sourceNodeIDs, table_id_set_t nbrTableIDSet)
+        : mm{mm}, sharedState{sharedState}, sourceNodeIDs{sourceNodeIDs},
+          nbrTableIDSet{std::move(nbrTableIDSet)} {
+        localFT = sharedState->factorizedTablePool.claimLocalTable(mm);
+        srcNodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        dstNodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        lengthVector = createVector(LogicalType::UINT16());
+    }
+    ~MultiSourceSPOutputWriter() override {
+        sharedState->factorizedTablePool.returnLocalTable(localFT);
+    }
+
+    void write(nodeID_t dstNodeID, uint64_t sourceMask, uint16_t length) override {
+        if (!nbrTableIDSet.contains(dstNodeID.tableID) || !inOutputNodeMask(dstNodeID)) {
+            return;
+        }
+        dstNodeIDVector->setValue<nodeID_t>(0, dstNodeID);
+        lengthVector->setValue<uint16_t>(0, length);
+        while (sourceMask != 0 && !sharedState->exceedLimit()) {
+            auto sourceIdx = std::countr_zero(sourceMask);
+            sourceMask &= sourceMask - 1;
+            srcNodeIDVector->setValue<nodeID_t>(0, sourceNodeIDs[sourceIdx]);
+            localFT->append(vectors);
+            if (sharedState->counter != nullptr) {
+                sharedState->counter->increase(1);
+            }
+        }
+    }
+
+    std::unique_ptr<MultiSourceBFSOutputWriter> copy() override {
+        return std::make_unique<MultiSourceSPOutputWriter>(mm, sharedState, sourceNodeIDs,
+            nbrTableIDSet);
+    }
+
+private:
+    std::unique_ptr<ValueVector> createVector(LogicalType type) {
+        auto vector = std::make_unique<ValueVector>(std::move(type), mm);
+        vector->state = DataChunkState::getSingleValueDataChunkState();
+        vectors.push_back(vector.get());
+        return vector;
+    }
+
+    bool inOutputNodeMask(nodeID_t nodeID) const {
+        auto outputNodeMask = sharedState->getOutputNodeMaskMap();
+        if (outputNodeMask == nullptr || !outputNodeMask->containsTableID(nodeID.tableID)) {
+            return true;
+        }
+        auto mask = outputNodeMask->getOffsetMask(nodeID.tableID);
+        return !mask->isEnabled() || mask->isMasked(nodeID.offset);
+    }
+
+private:
+    storage::MemoryManager* mm;
+    RecursiveExtendSharedState* sharedState;
+    const std::vector<nodeID_t>& sourceNodeIDs;
+    table_id_set_t nbrTableIDSet;
+    FactorizedTable* localFT;
+    std::vector<ValueVector*> vectors;
+    std::unique_ptr<ValueVector> srcNodeIDVector;
+    std::unique_ptr<ValueVector> dstNodeIDVector;
+    std::unique_ptr<ValueVector> lengthVector;
+};
+
+// Below this number of sources, running a BFS per source is cheap enough.
+static constexpr offset_t MIN_NUM_MULTI_SOURCE_BFS_SOURCES = 8;
+
+bool RecursiveExtend::tryExecuteMultiSource(ExecutionContext* context, offset_t totalNumNodes) {
+    if (function->getFunctionName() != SingleSPDestinationsFunction::name ||
+        totalNumNodes < MIN_NUM_MULTI_SOURCE_BFS_SOURCES) {
+        return false;
+    }
+    auto transaction = transaction::Transaction::Get(*context->clientContext);
+    auto progressBar = ProgressBar::Get(*context->clientContext);
+    auto graph = sharedState->graph.get();
+    auto inputNodeMaskMap = sharedState->getInputNodeMaskMap();
+    auto bfs = MultiSourceBFS(context, graph);
+    std::vector<nodeID_t> sourceNodeIDs;
+    sourceNodeIDs.reserve(MultiSourceBFS::MAX_NUM_SOURCES);
+    auto writer = MultiSourceSPOutputWriter(storage::MemoryManager::Get(*context->clientContext),
+        sharedState.get(), sourceNodeIDs,
+        bindData.nodeOutput->constCast<NodeExpression>().getTableIDsSet());
+    offset_t completedNumNodes = 0;
+    auto runBatch = [&]() {
+        bfs.run(context, sourceNodeIDs, bindData.extendDirection, bindData.upperBound, writer);
+        completedNumNodes += sourceNodeIDs.size();
+        progressBar->updateProgress(context->queryID,
+            getRJProgress(totalNumNodes, completedNumNodes));
+        sourceNodeIDs.clear();
+    };
+    auto addSource = [&](nodeID_t sourceNodeID) {
+        sourceNodeIDs.push_back(sourceNodeID);
+        if (sourceNodeIDs.size() == MultiSourceBFS::MAX_NUM_SOURCES) {
+            runBatch();
+        }
+    };
+    auto inputNodeTableIDSet = bindData.nodeInput->constCast<NodeExpression>().getTableIDsSet();
+    for (auto& tableID : graph->getNodeTableIDs()) {
+        if (!inputNodeTableIDSet.contains(tableID)) {
+            continue;
+        }
+        auto maxOffset = graph->getMaxOffset(transaction, tableID);
+        if (inputNodeMaskMap && inputNodeMaskMap->getOffsetMask(tableID)->isEnabled()) {
+            for (const auto& offset :
+                inputNodeMaskMap->getOffsetMask(tableID)->range(0, maxOffset)) {
+                if (sharedState->exceedLimit()) {
+                    return true;
+                }
+                addSource({offset, tableID});
+            }
+        } else {
+            for (auto offset = 0u; offset < maxOffset; ++offset) {
+                if (sharedState->exceedLimit()) {
+                    return true;
+                }
+                addSource({offset, tableID});
+            }
+        }
+    }
+    if (!sourceNodeIDs.empty() && !sharedState->exceedLimit()) {
+        runBatch();
+    }
+    return true;
+}
+
 void RecursiveExtend::executeInternal(ExecutionContext* context) {
     auto clientContext = context->clientContext;
     auto transaction = transaction::Transaction::Get(*clientContext);
@@ -105,6 +333,14 @@ void RecursiveExtend::executeInternal(ExecutionContext* context) {
         propertyNames.push_back(
             bindData.weightPropertyExpr->ptrCast<PropertyExpression>()->getPropertyName());
     }
+    if (bindData.bidirectional && tryExecuteBidirectional(context, propertyNames)) {
+        sharedState->factorizedTablePool.mergeLocalTables();
+        return;
+    }
+    if (tryExecuteMultiSource(context, totalNumNodes)) {
+        sharedState->factorizedTablePool.mergeLocalTables();
+        return;
+    }
     offset_t completedNumNodes = 0;
     auto inputNodeTableIDSet = bindData.nodeInput->constCast<NodeExpression>().getTableIDsSet();
     for (auto& tableID : graph->getNodeTableIDs()) {
@@ -116,20 +352,13 @@ void RecursiveExtend::executeInternal(ExecutionContext* context) {
             continue;
         }
         auto calcFunc = [tableID, propertyNames, graph, context, this](offset_t offset) {
-            auto clientContext = context->clientContext;
             auto computeState = function->getComputeState(context, bindData, sharedState.get());
             auto sourceNodeID = nodeID_t{offset, tableID};
             computeState->initSource(sourceNodeID);
             GDSUtils::runRecursiveJoinEdgeCompute(context, *computeState, graph,
                 bindData.extendDirection, bindData.upperBound, sharedState->getOutputNodeMaskMap(),
                 propertyNames);
-            auto writer = function->getOutputWriter(context, bindData, *computeState, sourceNodeID,
-                sharedState.get());
-            auto vertexCompute = std::make_unique<RJVertexCompute>(
-                storage::MemoryManager::Get(*clientContext), sharedState.get(), writer->copy(),
-                bindData.nodeOutput->constCast<NodeExpression>().getTableIDsSet());
-            GDSUtils::runVertexCompute(context, computeState->frontierPair->getState(), graph,
-                *vertexCompute);
+            writeOutput(context, *computeState, sourceNodeID);
         };
         auto maxOffset = graph->getMaxOffset(transaction, tableID);
         if (inputNodeMaskMap && inputNodeMaskMap->getOffsetMask(tableID)->isEnabled()) {
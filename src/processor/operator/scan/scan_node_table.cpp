@@ -103,6 +103,20 @@ void ScanNodeTableInfo::initScanState(TableScanState& scanState,
     initScanStateVectors(scanState, outVectors, MemoryManager::Get(*context));
 }
 
+bool ScanNodeTable::addRuntimePredicate(const DataPos& pos,
+    std::shared_ptr<RuntimeColumnPredicate> predicate) {
+    auto it = std::find(opInfo.outVectorsPos.begin(), opInfo.outVectorsPos.end(), pos);
+    if (it == opInfo.outVectorsPos.end()) {
+        return false;
+    }
+    const auto vectorIdx = static_cast<idx_t>(it - opInfo.outVectorsPos.begin());
+    for (auto& tableInfo : tableInfos) {
+        tableInfo.addColumnPredicate(vectorIdx, predicate->copy());
+    }
+    runtimePredicates.emplace_back(vectorIdx, std::move(predicate));
+    return true;
+}
+
 void ScanNodeTable::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     ScanTable::initLocalStateInternal(resultSet, context);
     auto nodeIDVector = resultSet->getValueVector(opInfo.nodeIDPos).get();
@@ -153,9 +167,15 @@ bool ScanNodeTable::getNextTuplesInternal(ExecutionContext* context) {
     while (currentTableIdx < tableInfos.size()) {
         auto& info = tableInfos[currentTableIdx];
         while (info.table->scan(transaction, *scanState)) {
+            if (scanState->outState->getSelVector().getSelSize() > 0) {
+                info.castColumns();
+                for (auto& [vectorIdx, predicate] : runtimePredicates) {
+                    predicate->select(*outVectors[vectorIdx],
+                        scanState->outState->getSelVectorUnsafe());
+                }
+            }
             const auto outputSize = scanState->outState->getSelVector().getSelSize();
             if (outputSize > 0) {
-                info.castColumns();
                 scanState->outState->setToUnflat();
                 metrics->numOutputTuple.increase(outputSize);
                 return true;
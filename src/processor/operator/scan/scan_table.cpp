@@ -38,6 +38,18 @@ void ScanTableInfo::addColumnInfo(column_id_t columnID, ColumnCaster caster) {
     columnCasters.push_back(std::move(caster));
 }
 
+bool ScanTableInfo::addColumnPredicate(idx_t idx, std::unique_ptr<ColumnPredicate> predicate) {
+    KU_ASSERT(idx < columnIDs.size());
+    const auto columnID = columnIDs[idx];
+    if (columnID == INVALID_COLUMN_ID || columnID == ROW_IDX_COLUMN_ID ||
+        columnCasters[idx].hasCast()) {
+        return false;
+    }
+    columnPredicates.resize(columnIDs.size());
+    columnPredicates[idx].addPredicate(std::move(predicate));
+    return true;
+}
+
 void ScanTableInfo::initScanStateVectors(TableScanState& scanState,
     const std::vector<ValueVector*>& outVectors, MemoryManager* memoryManager) {
     if (!hasColumnCaster) {
@@ -0,0 +1,138 @@
+#include "processor/operator/streaming_result_collector.h"
+
+#include "common/exception/interrupt.h"
+#include "main/client_context.h"
+#include "main/query_result/materialized_query_result.h"
+#include "processor/execution_context.h"
+
+using namespace lbug::common;
+using namespace lbug::storage;
+
+namespace lbug {
+namespace processor {
+
+void StreamingResultSharedState::setHeader(std::vector<std::string> columnNames,
+    std::vector<LogicalType> columnTypes) {
+    std::unique_lock lck{mtx};
+    this->columnNames = std::move(columnNames);
+    this->columnTypes = std::move(columnTypes);
+    headerSet = true;
+    notEmpty.notify_all();
+}
+
+void StreamingResultSharedState::push(std::shared_ptr<FactorizedTable> batch,
+    const main::ClientContext& context) {
+    std::unique_lock lck{mtx};
+    while (batches.size() >= maxNumBufferedBatches && !cancelled) {
+        // Wake up periodically so that interrupts and timeouts are noticed while the consumer is
+        // not reading.
+        notFull.wait_for(lck, std::chrono::milliseconds(10));
+        if (context.interrupted()) {
+            throw InterruptException{};
+        }
+    }
+    if (cancelled) {
+        throw InterruptException{};
+    }
+    batches.push_back(std::move(batch));
+    notEmpty.notify_one();
+}
+
+void StreamingResultSharedState::finish(std::unique_ptr<main::QueryResult> result) {
+    std::unique_lock lck{mtx};
+    // Statements whose root operator is not a result collector (e.g. PROFILE or DDL) return a
+    // materialized result. Forward its tuples as the last batch.
+    if (result != nullptr && result->isSuccess() &&
+        result->getType() == main::QueryResultType::FTABLE && !cancelled) {
+        auto& materializedResult = result->cast<main::MaterializedQueryResult>();
+        auto table = materializedResult.getFactorizedTableUnsafe();
+        if (table != nullptr && !table->isEmpty()) {
+            batches.push_back(std::move(table));
+        }
+        if (!headerSet) {
+            columnNames = result->getColumnNames();
+            columnTypes = result->getColumnDataTypes();
+        }
+    }
+    finalResult = std::move(result);
+    finished = true;
+    notEmpty.notify_all();
+}
+
+bool StreamingResultSharedState::waitForHeader() {
+    std::unique_lock lck{mtx};
+    notEmpty.wait(lck, [&] { return headerSet || finished; });
+    if (headerSet) {
+        return true;
+    }
+    return finalResult != nullptr && finalResult->isSuccess();
+}
+
+std::shared_ptr<FactorizedTable> StreamingResultSharedState::pop() {
+    std::unique_lock lck{mtx};
+    notEmpty.wait(lck, [&] { return !batches.empty() || finished; });
+    if (batches.empty()) {
+        return nullptr;
+    }
+    auto batch = std::move(batches.front());
+    batches.pop_front();
+    notFull.notify_one();
+    return batch;
+}
+
+void StreamingResultSharedState::cancel() {
+    std::unique_lock lck{mtx};
+    cancelled = true;
+    batches.clear();
+    notFull.notify_all();
+}
+
+bool StreamingResultSharedState::isFinished() {
+    std::unique_lock lck{mtx};
+    return finished;
+}
+
+std::unique_ptr<main::QueryResult> StreamingResultSharedState::moveFinalResult() {
+    std::unique_lock lck{mtx};
+    return std::move(finalResult);
+}
+
+void StreamingResultCollector::initLocalStateInternal(ResultSet* resultSet, ExecutionContext*) {
+    payloadVectors.reserve(info.payloadPositions.size());
+    for (auto& pos : info.payloadPositions) {
+        payloadVectors.push_back(resultSet->getValueVector(pos).get());
+    }
+    localBatch = createBatch();
+}
+
+void StreamingResultCollector::executeInternal(ExecutionContext* context) {
+    while (children[0]->getNextTuple(context)) {
+        if (payloadVectors.empty()) {
+            continue;
+        }
+        for (auto i = 0u; i < resultSet->multiplicity; i++) {
+            localBatch->append(payloadVectors);
+        }
+        if (localBatch->getNumTuples() >= StreamingResultSharedState::MAX_NUM_TUPLES_PER_BATCH) {
+            metrics->numOutputTuple.increase(localBatch->getTotalNumFlatTuples());
+            sharedState->push(std::move(localBatch), *context->clientContext);
+            localBatch = createBatch();
+        }
+    }
+    if (!localBatch->isEmpty()) {
+        metrics->numOutputTuple.increase(localBatch->getTotalNumFlatTuples());
+        sharedState->push(std::move(localBatch), *context->clientContext);
+        localBatch = nullptr;
+    }
+}
+
+std::unique_ptr<main::QueryResult> StreamingResultCollector::getQueryResult() const {
+    return std::make_unique<main::MaterializedQueryResult>(createBatch());
+}
+
+std::shared_ptr<FactorizedTable> StreamingResultCollector::createBatch() const {
+    return std::make_shared<FactorizedTable>(memoryManager, info.tableSchema.copy());
+}
+
+} // namespace processor
+} // namespace lbug
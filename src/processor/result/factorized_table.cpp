@@ -15,7 +15,7 @@ namespace lbug {
 namespace processor {
 
 DataBlock::DataBlock(storage::MemoryManager* mm, uint64_t size) : numTuples{0}, freeSize{size} {
-    block = mm->allocateBuffer(true /* initializeToZero */, size);
+    block = mm->allocateIntermediateBuffer(true /* initializeToZero */, size);
 }
 
 DataBlock::~DataBlock() = default;
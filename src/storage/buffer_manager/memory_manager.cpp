@@ -8,7 +8,9 @@
 #include "main/client_context.h"
 #include "main/database.h"
 #include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/query_memory_tracker.h"
 #include "storage/file_handle.h"
+#include <format>
 
 using namespace lbug::common;
 
@@ -22,6 +24,9 @@ MemoryBuffer::~MemoryBuffer() {
     if (buffer.data() != nullptr && !evicted) {
         mm->freeBlock(pageIdx, buffer);
         mm->updateUsedMemoryForFreedBlock(pageIdx, buffer);
+        if (memoryTracker) {
+            memoryTracker->release(buffer.size());
+        }
         buffer = std::span<uint8_t>();
     }
 }
@@ -89,6 +94,28 @@ std::unique_ptr<MemoryBuffer> MemoryManager::allocateBuffer(bool initializeToZer
     return memoryBuffer;
 }
 
+std::unique_ptr<MemoryBuffer> MemoryManager::allocateIntermediateBuffer(bool initializeToZero,
+    uint64_t size) {
+    auto memoryTracker = QueryMemoryTracker::getActive();
+    if (memoryTracker == nullptr) {
+        return allocateBuffer(initializeToZero, size);
+    }
+    if (!memoryTracker->reserve(size)) {
+        throw BufferManagerException(
+            std::format("Unable to allocate memory! The query memory limit of {} bytes is reached!",
+                memoryTracker->getMemoryLimit()));
+    }
+    std::unique_ptr<MemoryBuffer> memoryBuffer;
+    try {
+        memoryBuffer = allocateBuffer(initializeToZero, size);
+    } catch (...) {
+        memoryTracker->release(size);
+        throw;
+    }
+    memoryBuffer->memoryTracker = std::move(memoryTracker);
+    return memoryBuffer;
+}
+
 void MemoryManager::freeBlock(page_idx_t pageIdx, std::span<uint8_t> buffer) {
     if (pageIdx == INVALID_PAGE_IDX) {
         std::free(buffer.data());
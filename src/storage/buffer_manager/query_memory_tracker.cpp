@@ -0,0 +1,41 @@
+#include "storage/buffer_manager/query_memory_tracker.h"
+
+namespace lbug {
+namespace storage {
+
+static thread_local std::shared_ptr<QueryMemoryTracker> activeTracker = nullptr;
+
+bool QueryMemoryTracker::reserve(uint64_t size) {
+    auto currentUsedMemory = usedMemory.load();
+    uint64_t newUsedMemory = 0;
+    do {
+        newUsedMemory = currentUsedMemory + size;
+        if (memoryLimit != 0 && newUsedMemory > memoryLimit) {
+            return false;
+        }
+    } while (!usedMemory.compare_exchange_weak(currentUsedMemory, newUsedMemory));
+    updatePeakMemory(newUsedMemory);
+    return true;
+}
+
+void QueryMemoryTracker::updatePeakMemory(uint64_t newUsedMemory) {
+    auto currentPeakMemory = peakMemory.load();
+    while (newUsedMemory > currentPeakMemory &&
+           !peakMemory.compare_exchange_weak(currentPeakMemory, newUsedMemory)) {}
+}
+
+std::shared_ptr<QueryMemoryTracker> QueryMemoryTracker::getActive() {
+    return activeTracker;
+}
+
+QueryMemoryTrackerScope::QueryMemoryTrackerScope(std::shared_ptr<QueryMemoryTracker> tracker)
+    : prevTracker{std::move(activeTracker)} {
+    activeTracker = std::move(tracker);
+}
+
+QueryMemoryTrackerScope::~QueryMemoryTrackerScope() {
+    activeTracker = std::move(prevTracker);
+}
+
+} // namespace storage
+} // namespace lbug
@@ -0,0 +1,53 @@
+#include "storage/predicate/bloom_filter_predicate.h"
+
+#include "common/type_utils.h"
+#include "common/vector/value_vector.h"
+#include "function/hash/hash_functions.h"
+#include <format>
+
+using namespace lbug::common;
+
+namespace lbug {
+namespace storage {
+
+bool ColumnBloomFilterPredicate::isSupportedType(PhysicalTypeID physicalType) {
+    return TypeUtils::visit(
+        physicalType, []<HashableNonNestedTypes T>(T) { return true; },
+        [](auto) { return false; });
+}
+
+template<HashableNonNestedTypes T>
+static void selectSwitch(const ValueVector& vector, SelectionVector& selVector,
+    const BloomFilter& filter) {
+    auto buffer = selVector.getMutableBuffer();
+    sel_t numSelected = 0;
+    selVector.forEach([&](auto pos) {
+        if (vector.isNull(pos)) {
+            return;
+        }
+        hash_t hash = 0;
+        function::Hash::operation(vector.getValue<T>(pos), hash);
+        if (filter.mayContain(hash)) {
+            buffer[numSelected++] = pos;
+        }
+    });
+    selVector.setToFiltered(numSelected);
+}
+
+void ColumnBloomFilterPredicate::select(const ValueVector& vector,
+    SelectionVector& selVector) const {
+    if (!filter->isInitialized()) {
+        return;
+    }
+    TypeUtils::visit(
+        vector.dataType.getPhysicalType(),
+        [&]<HashableNonNestedTypes T>(T) { selectSwitch<T>(vector, selVector, *filter); },
+        [](auto) {});
+}
+
+std::string ColumnBloomFilterPredicate::toString() {
+    return std::format("{} IN BLOOM FILTER", columnName);
+}
+
+} // namespace storage
+} // namespace lbug
@@ -0,0 +1,117 @@
+#include "storage/predicate/top_k_predicate.h"
+
+#include "common/type_utils.h"
+#include "common/vector/value_vector.h"
+#include "storage/compression/compression.h"
+#include "storage/table/column_chunk_stats.h"
+#include <format>
+
+using namespace lbug::common;
+
+namespace lbug {
+namespace storage {
+
+// Floating point keys are left out because of NaNs, which do not compare like they sort.
+template<typename T>
+concept TopKKeyType = StorageValueType<T> && !std::floating_point<T> && !std::same_as<T, bool>;
+
+bool TopKBoundary::isSupportedType(PhysicalTypeID physicalType) {
+    return TypeUtils::visit(
+        physicalType, []<TopKKeyType T>(T) { return true; }, [](auto) { return false; });
+}
+
+void TopKBoundary::update(const Value& newValue) {
+    KU_ASSERT(!newValue.isNull());
+    std::unique_lock lck{mtx};
+    if (!value.has_value()) {
+        value = newValue;
+        return;
+    }
+    TypeUtils::visit(
+        newValue.getDataType().getPhysicalType(),
+        [&]<TopKKeyType T>(T) {
+            auto current = value->getValue<T>();
+            auto candidate = newValue.getValue<T>();
+            if (isAscOrder ? candidate < current : candidate > current) {
+                value = newValue;
+            }
+        },
+        [](auto) { KU_UNREACHABLE; });
+}
+
+std::optional<Value> TopKBoundary::getValue() const {
+    std::unique_lock lck{mtx};
+    return value;
+}
+
+template<TopKKeyType T>
+static ZoneMapCheckResult checkZoneMapSwitch(const MergedColumnChunkStats& mergedStats,
+    bool isAscOrder, T boundary) {
+    if (!mergedStats.stats.min.has_value() || !mergedStats.stats.max.has_value()) {
+        return ZoneMapCheckResult::ALWAYS_SCAN;
+    }
+    if (isAscOrder) {
+        // Nulls sort last in ascending order, so they cannot enter the top k either.
+        if (mergedStats.stats.min->get<T>() > boundary) {
+            return ZoneMapCheckResult::SKIP_SCAN;
+        }
+    } else if (mergedStats.guaranteedNoNulls && mergedStats.stats.max->get<T>() < boundary) {
+        return ZoneMapCheckResult::SKIP_SCAN;
+    }
+    return ZoneMapCheckResult::ALWAYS_SCAN;
+}
+
+ZoneMapCheckResult ColumnTopKPredicate::checkZoneMap(const MergedColumnChunkStats& stats) const {
+    auto value = boundary->getValue();
+    if (!value.has_value()) {
+        return ZoneMapCheckResult::ALWAYS_SCAN;
+    }
+    return TypeUtils::visit(
+        value->getDataType().getPhysicalType(),
+        [&]<TopKKeyType T>(T) {
+            return checkZoneMapSwitch<T>(stats, boundary->isAsc(), value->getValue<T>());
+        },
+        [](auto) { return ZoneMapCheckResult::ALWAYS_SCAN; });
+}
+
+template<TopKKeyType T>
+static void selectSwitch(const ValueVector& vector, SelectionVector& selVector, bool isAscOrder,
+    T boundary) {
+    auto buffer = selVector.getMutableBuffer();
+    sel_t numSelected = 0;
+    if (isAscOrder) {
+        selVector.forEach([&](auto pos) {
+            if (!vector.isNull(pos) && vector.getValue<T>(pos) <= boundary) {
+                buffer[numSelected++] = pos;
+            }
+        });
+    } else {
+        selVector.forEach([&](auto pos) {
+            if (vector.isNull(pos) || vector.getValue<T>(pos) >= boundary) {
+                buffer[numSelected++] = pos;
+            }
+        });
+    }
+    selVector.setToFiltered(numSelected);
+}
+
+void ColumnTopKPredicate::select(const ValueVector& vector, SelectionVector& selVector) const {
+    auto value = boundary->getValue();
+    if (!value.has_value()) {
+        return;
+    }
+    TypeUtils::visit(
+        value->getDataType().getPhysicalType(),
+        [&]<TopKKeyType T>(
+            T) { selectSwitch<T>(vector, selVector, boundary->isAsc(), value->getValue<T>()); },
+        [](auto) {});
+}
+
+std::string ColumnTopKPredicate::toString() {
+    auto value = boundary->getValue();
+    return std::format("{} {}", ColumnPredicate::toString(),
+        value.has_value() ? value->toString() : "TOP K");
+}
+
+} // namespace storage
+} // namespace lbug
@@ -1,5 +1,8 @@
 #include "storage/stats/column_stats.h"
 
+#include <cmath>
+
+#include "common/type_utils.h"
 #include "function/hash/vector_hash_functions.h"
 
 namespace lbug {
@@ -11,6 +14,24 @@ ColumnStats::ColumnStats(const common::LogicalType& dataType) : hashes{nullptr}
     }
 }
 
+std::optional<ValueHistogram> ColumnStats::getHistogram() const {
+    if (sample.isEmpty()) {
+        return std::nullopt;
+    }
+    return ValueHistogram(sample);
+}
+
+// Returns the value at pos as a double, or NaN if the column is not numeric.
+static double getNumericValue(const common::ValueVector& vector, common::sel_t pos) {
+    double result = std::nan("");
+    common::TypeUtils::visit(vector.dataType.getPhysicalType(), [&]<typename T>(T) {
+        if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+            result = static_cast<double>(vector.getValue<T>(pos));
+        }
+    });
+    return result;
+}
+
 void ColumnStats::update(const common::ValueVector* vector) {
     if (hll) {
         if (!hashes) {
@@ -23,6 +44,12 @@ void ColumnStats::update(const common::ValueVector* vector) {
         for (auto i = 0u; i < hashes->state->getSelVector().getSelSize(); i++) {
             hll->insertElement(hashes->getValue<common::hash_t>(i));
         }
+        vector->state->getSelVector().forEach([&](auto pos) {
+            if (!vector->isNull(pos)) {
+                sample.insert(hashes->getValue<common::hash_t>(pos),
+                    getNumericValue(*vector, pos));
+            }
+        });
         hashes->state = nullptr;
         hashes->setAllNonNull();
     }
@@ -0,0 +1,78 @@
+#include "storage/stats/degree_stats.h"
+
+#include <bit>
+
+namespace lbug {
+namespace storage {
+
+void DegreeStats::addNode(common::length_t degree) {
+    if (degree == 0) {
+        return;
+    }
+    auto& bucket = buckets[std::bit_width(degree) - 1];
+    bucket.numNodes++;
+    bucket.numRels += degree;
+    bucket.sumSquaredDegrees += static_cast<double>(degree) * static_cast<double>(degree);
+    maxDegree = std::max(maxDegree, degree);
+}
+
+void DegreeStats::merge(const DegreeStats& other) {
+    for (auto i = 0u; i < NUM_BUCKETS; i++) {
+        buckets[i].numNodes += other.buckets[i].numNodes;
+        buckets[i].numRels += other.buckets[i].numRels;
+        buckets[i].sumSquaredDegrees += other.buckets[i].sumSquaredDegrees;
+    }
+    maxDegree = std::max(maxDegree, other.maxDegree);
+}
+
+common::cardinality_t DegreeStats::getNumNodesWithRels() const {
+    common::cardinality_t result = 0;
+    for (auto& bucket : buckets) {
+        result += bucket.numNodes;
+    }
+    return result;
+}
+
+common::cardinality_t DegreeStats::getNumRels() const {
+    common::cardinality_t result = 0;
+    for (auto& bucket : buckets) {
+        result += bucket.numRels;
+    }
+    return result;
+}
+
+double DegreeStats::getSumSquaredDegrees() const {
+    double result = 0;
+    for (auto& bucket : buckets) {
+        result += bucket.sumSquaredDegrees;
+    }
+    return result;
+}
+
+double DegreeStats::getSizeBiasedDegree() const {
+    const auto numRels = getNumRels();
+    if (numRels == 0) {
+        return 0;
+    }
+    return getSumSquaredDegrees() / static_cast<double>(numRels);
+}
+
+void DegreeStats::serialize(common::Serializer& serializer) const {
+    serializer.writeDebuggingInfo("degree_buckets");
+    serializer.serializeArray<Bucket, NUM_BUCKETS>(buckets);
+    serializer.writeDebuggingInfo("max_degree");
+    serializer.write<common::length_t>(maxDegree);
+}
+
+DegreeStats DegreeStats::deserialize(common::Deserializer& deserializer) {
+    DegreeStats result;
+    std::string info;
+    deserializer.validateDebuggingInfo(info, "degree_buckets");
+    deserializer.deserializeArray<Bucket, NUM_BUCKETS>(result.buckets);
+    deserializer.validateDebuggingInfo(info, "max_degree");
+    deserializer.deserializeValue<common::length_t>(result.maxDegree);
+    return result;
+}
+
+} // namespace storage
+} // namespace lbug
@@ -0,0 +1,200 @@
+#include "storage/stats/value_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace lbug {
+namespace storage {
+
+// SplitMix64 finalizer. Used as a deterministic source of randomness for sampling.
+static uint64_t mix(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+void ValueSample::insert(common::hash_t hash, double value) {
+    numValuesSeen++;
+    if (entries.size() < CAPACITY) {
+        entries.push_back({hash, value});
+        return;
+    }
+    const auto slot = mix(numValuesSeen ^ hash) % numValuesSeen;
+    if (slot < CAPACITY) {
+        entries[slot] = {hash, value};
+    }
+}
+
+// Picks numEntries entries of the given ones pseudo-randomly.
+static std::vector<ValueSample::Entry> subsample(std::span<const ValueSample::Entry> entries,
+    uint64_t numEntries) {
+    std::vector<std::pair<uint64_t, uint64_t>> keys;
+    keys.reserve(entries.size());
+    for (auto i = 0u; i < entries.size(); i++) {
+        keys.emplace_back(mix(entries[i].hash ^ i), i);
+    }
+    numEntries = std::min<uint64_t>(numEntries, entries.size());
+    std::partial_sort(keys.begin(), keys.begin() + numEntries, keys.end());
+    std::vector<ValueSample::Entry> result;
+    result.reserve(numEntries);
+    for (auto i = 0u; i < numEntries; i++) {
+        result.push_back(entries[keys[i].second]);
+    }
+    return result;
+}
+
+void ValueSample::merge(const ValueSample& other) {
+    if (other.numValuesSeen == 0) {
+        return;
+    }
+    const auto totalSeen = numValuesSeen + other.numValuesSeen;
+    if (entries.size() + other.entries.size() <= CAPACITY) {
+        entries.insert(entries.end(), other.entries.begin(), other.entries.end());
+        numValuesSeen = totalSeen;
+        return;
+    }
+    // Each side contributes to the merged sample in proportion to the number of values it has seen.
+    const auto share = static_cast<double>(numValuesSeen) / static_cast<double>(totalSeen);
+    auto numEntriesFromThis = static_cast<uint64_t>(std::llround(share * CAPACITY));
+    numEntriesFromThis = std::clamp<uint64_t>(numEntriesFromThis,
+        CAPACITY - std::min<uint64_t>(CAPACITY, other.entries.size()),
+        std::min<uint64_t>(CAPACITY, entries.size()));
+    auto merged = subsample(entries, numEntriesFromThis);
+    auto fromOther = subsample(other.entries, CAPACITY - numEntriesFromThis);
+    merged.insert(merged.end(), fromOther.begin(), fromOther.end());
+    entries = std::move(merged);
+    numValuesSeen = totalSeen;
+}
+
+void ValueSample::serialize(common::Serializer& serializer) const {
+    serializer.writeDebuggingInfo("num_values_seen");
+    serializer.write<uint64_t>(numValuesSeen);
+    serializer.writeDebuggingInfo("sample_entries");
+    serializer.serializeVector(entries);
+}
+
+ValueSample ValueSample::deserialize(common::Deserializer& deserializer) {
+    ValueSample result;
+    std::string info;
+    deserializer.validateDebuggingInfo(info, "num_values_seen");
+    deserializer.deserializeValue<uint64_t>(result.numValuesSeen);
+    deserializer.validateDebuggingInfo(info, "sample_entries");
+    deserializer.deserializeVector(result.entries);
+    return result;
+}
+
+// A value needs to occur at least this many times in the sample to be considered one of the most
+// common values. With a small sample, values occurring twice are frequently just coincidence.
+static constexpr uint64_t MIN_MOST_COMMON_VALUE_COUNT = 3;
+
+ValueHistogram::ValueHistogram(const ValueSample& sample) {
+    auto entries = std::vector<ValueSample::Entry>(sample.getEntries().begin(),
+        sample.getEntries().end());
+    if (entries.empty()) {
+        return;
+    }
+    const auto sampleSize = static_cast<double>(entries.size());
+    isNumeric = std::none_of(entries.begin(), entries.end(),
+        [](const ValueSample::Entry& entry) { return std::isnan(entry.value); });
+    std::sort(entries.begin(), entries.end(),
+        [](const auto& a, const auto& b) { return a.hash < b.hash; });
+    std::vector<std::pair<uint64_t, uint64_t>> groups; // (count, first entry idx)
+    for (auto i = 0u; i < entries.size();) {
+        auto j = i;
+        while (j < entries.size() && entries[j].hash == entries[i].hash) {
+            j++;
+        }
+        groups.emplace_back(j - i, i);
+        i = j;
+    }
+    std::sort(groups.begin(), groups.end(), [](const auto& a, const auto& b) {
+        return a.first != b.first ? a.first > b.first : a.second < b.second;
+    });
+    for (auto& [count, idx] : groups) {
+        if (count < MIN_MOST_COMMON_VALUE_COUNT ||
+            mostCommonValues.size() == MAX_NUM_MOST_COMMON_VALUES) {
+            break;
+        }
+        const auto frequency = static_cast<double>(count) / sampleSize;
+        mostCommonValues.push_back({entries[idx].hash, entries[idx].value, frequency});
+        mostCommonValuesFrequency += frequency;
+    }
+    if (!isNumeric) {
+        return;
+    }
+    std::vector<double> remainingValues;
+    for (auto& entry : entries) {
+        if (std::none_of(mostCommonValues.begin(), mostCommonValues.end(),
+                [&](const MostCommonValue& mcv) { return mcv.hash == entry.hash; })) {
+            remainingValues.push_back(entry.value);
+        }
+    }
+    if (remainingValues.empty()) {
+        return;
+    }
+    std::sort(remainingValues.begin(), remainingValues.end());
+    const auto lastIdx = remainingValues.size() - 1;
+    for (auto i = 0u; i <= NUM_BUCKETS; i++) {
+        bucketBoundaries.push_back(remainingValues[i * lastIdx / NUM_BUCKETS]);
+    }
+    bucketFrequency = (1.0 - mostCommonValuesFrequency) / NUM_BUCKETS;
+}
+
+double ValueHistogram::getEqualitySelectivity(common::hash_t hash,
+    common::cardinality_t numDistinctValues) const {
+    for (auto& mcv : mostCommonValues) {
+        if (mcv.hash == hash) {
+            return mcv.frequency;
+        }
+    }
+    const auto numRemainingValues =
+        std::max<double>(1.0, static_cast<double>(numDistinctValues) -
+                                  static_cast<double>(mostCommonValues.size()));
+    return std::max(0.0, 1.0 - mostCommonValuesFrequency) / numRemainingValues;
+}
+
+static bool isInRange(double value, std::optional<double> lower, bool includeLower,
+    std::optional<double> upper, bool includeUpper) {
+    if (lower && (includeLower ? value < *lower : value <= *lower)) {
+        return false;
+    }
+    if (upper && (includeUpper ? value > *upper : value >= *upper)) {
+        return false;
+    }
+    return true;
+}
+
+std::optional<double> ValueHistogram::getRangeSelectivity(std::optional<double> lower,
+    bool includeLower, std::optional<double> upper, bool includeUpper) const {
+    if (!isNumeric) {
+        return std::nullopt;
+    }
+    double selectivity = 0;
+    for (auto& mcv : mostCommonValues) {
+        if (isInRange(mcv.value, lower, includeLower, upper, includeUpper)) {
+            selectivity += mcv.frequency;
+        }
+    }
+    for (auto i = 0u; i + 1 < bucketBoundaries.size(); i++) {
+        const auto bucketLower = bucketBoundaries[i];
+        const auto bucketUpper = bucketBoundaries[i + 1];
+        if (bucketLower == bucketUpper) {
+            if (isInRange(bucketLower, lower, includeLower, upper, includeUpper)) {
+                selectivity += bucketFrequency;
+            }
+            continue;
+        }
+        // Values are assumed to be spread uniformly within a bucket.
+        const auto overlapLower = lower ? std::max(*lower, bucketLower) : bucketLower;
+        const auto overlapUpper = upper ? std::min(*upper, bucketUpper) : bucketUpper;
+        if (overlapUpper > overlapLower) {
+            selectivity +=
+                bucketFrequency * (overlapUpper - overlapLower) / (bucketUpper - bucketLower);
+        }
+    }
+    return std::clamp(selectivity, 0.0, 1.0);
+}
+
+} // namespace storage
+} // namespace lbug
@@ -2,6 +2,7 @@
 
 #include "common/constants.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/stats/degree_stats.h"
 #include "storage/storage_utils.h"
 #include "storage/table/column_chunk_data.h"
 #include "storage/table/csr_chunked_node_group.h"
@@ -466,12 +467,20 @@ void CSRNodeGroup::serialize(Serializer& serializer) {
 
 void CSRNodeGroup::checkpoint(MemoryManager&, NodeGroupCheckpointState& state) {
     const auto lock = chunkedGroups.lock();
+    auto& csrState = state.cast<CSRNodeGroupCheckpointState>();
+    // The checkpoint state is shared by all node groups of the table.
+    csrState.newHeader = nullptr;
     if (!persistentChunkGroup) {
         checkpointInMemOnly(lock, state);
     } else {
         checkpointInMemAndOnDisk(lock, state);
     }
     checkpointDataTypesNoLock(state);
+    if (csrState.degreeStats != nullptr && csrState.newHeader != nullptr) {
+        for (auto i = 0u; i < csrState.newHeader->length->getNumValues(); i++) {
+            csrState.degreeStats->addNode(csrState.newHeader->getCSRLength(i));
+        }
+    }
 }
 
 void CSRNodeGroup::reclaimStorage(PageAllocator& pageAllocator, const UniqLock& lock) const {
@@ -714,6 +714,22 @@ TableStats NodeTable::getStats(const Transaction* transaction) const {
     return stats;
 }
 
+MergedColumnChunkStats NodeTable::getMergedColumnChunkStats(column_id_t columnID) const {
+    auto result = MergedColumnChunkStats{ColumnChunkStats{}, true, true};
+    const auto physicalType = columns[columnID]->getDataType().getPhysicalType();
+    for (auto nodeGroupIdx = 0u; nodeGroupIdx < getNumNodeGroups(); nodeGroupIdx++) {
+        const auto nodeGroup = getNodeGroup(nodeGroupIdx);
+        for (auto groupIdx = 0u; groupIdx < nodeGroup->getNumChunkedGroups(); groupIdx++) {
+            auto& chunk = nodeGroup->getChunkedNodeGroup(groupIdx)->getColumnChunk(columnID);
+            if (chunk.hasUpdates()) {
+                return MergedColumnChunkStats{ColumnChunkStats{}, false, false};
+            }
+            result.merge(chunk.getMergedColumnChunkStats(), physicalType);
+        }
+    }
+    return result;
+}
+
 bool NodeTable::isVisible(const Transaction* transaction, offset_t offset) const {
     auto [nodeGroupIdx, offsetInGroup] = StorageUtils::getNodeGroupIdxAndOffsetInChunk(offset);
     const auto* nodeGroup = getNodeGroup(nodeGroupIdx);
@@ -415,6 +415,14 @@ RelTableData* RelTable::getDirectedTableData(RelDataDirection direction) const {
     return directedRelData[directionIdx].get();
 }
 
+DegreeStats RelTable::getDegreeStats(RelDataDirection direction) const {
+    const auto directionIdx = RelDirectionUtils::relDirectionToKeyIdx(direction);
+    if (directionIdx >= directedRelData.size()) {
+        return DegreeStats{};
+    }
+    return directedRelData[directionIdx]->getDegreeStats();
+}
+
 NodeGroup* RelTable::getOrCreateNodeGroup(const Transaction* transaction,
     node_group_idx_t nodeGroupIdx, RelDataDirection direction) const {
     return getDirectedTableData(direction)->getOrCreateNodeGroup(transaction, nodeGroupIdx);
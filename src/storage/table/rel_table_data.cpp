@@ -258,15 +258,24 @@ void RelTableData::checkpoint(const std::vector<column_id_t>& columnIDs,
 
     CSRNodeGroupCheckpointState state{columnIDs, std::move(checkpointColumnPtrs), pageAllocator, mm,
         csrHeaderColumns.offset.get(), csrHeaderColumns.length.get()};
+    DegreeStats newDegreeStats;
+    state.degreeStats = &newDegreeStats;
     nodeGroups->checkpoint(*mm, state);
+    std::unique_lock lck{degreeStatsMtx};
+    degreeStats = std::move(newDegreeStats);
 }
 
 void RelTableData::serialize(Serializer& serializer) const {
     nodeGroups->serialize(serializer);
+    serializer.writeDebuggingInfo("degree_stats");
+    degreeStats.serialize(serializer);
 }
 
 void RelTableData::deserialize(Deserializer& deSerializer, MemoryManager& memoryManager) {
     nodeGroups->deserialize(deSerializer, memoryManager);
+    std::string key;
+    deSerializer.validateDebuggingInfo(key, "degree_stats");
+    degreeStats = DegreeStats::deserialize(deSerializer);
 }
 
 const VersionRecordHandler* RelTableData::getVersionRecordHandler(
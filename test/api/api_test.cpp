@@ -65,6 +65,33 @@ TEST_F(ApiTest, ParallelConnect) {
     }
 }
 
+TEST_F(ApiTest, QueryMemoryLimitPerConnection) {
+    auto limitedConn = std::make_unique<Connection>(database.get());
+    auto unlimitedConn = std::make_unique<Connection>(database.get());
+    ASSERT_TRUE(limitedConn->query("CALL query_memory_limit=1048576")->isSuccess());
+    ASSERT_TRUE(unlimitedConn->query("CALL query_memory_limit=0")->isSuccess());
+    static constexpr auto query = "UNWIND RANGE(1, 1000000) AS x RETURN COUNT(DISTINCT x)";
+    std::thread limitedThread([&]() {
+        for (auto i = 0u; i < 5; ++i) {
+            auto result = limitedConn->query(query);
+            ASSERT_FALSE(result->isSuccess());
+            ASSERT_EQ(result->getErrorMessage(), "Buffer manager exception: Unable to allocate "
+                                                 "memory! The query memory limit of 1048576 bytes "
+                                                 "is reached!");
+        }
+    });
+    std::thread unlimitedThread([&]() {
+        for (auto i = 0u; i < 5; ++i) {
+            auto result = unlimitedConn->query(query);
+            ASSERT_TRUE(result->isSuccess());
+            ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1000000);
+            ASSERT_GT(result->getQuerySummary()->getPeakMemoryUsage(), 1048576);
+        }
+    });
+    limitedThread.join();
+    unlimitedThread.join();
+}
+
 static void executeLongRunningQuery(Connection* conn) {
     auto result = conn->query(
         "UNWIND RANGE(1,100000) AS x UNWIND RANGE(1, 100000) AS y RETURN COUNT(x + y);");
@@ -120,6 +147,104 @@ TEST_F(ApiTest, Profile) {
     ASSERT_TRUE(result->isSuccess());
 }
 
+TEST_F(ApiTest, ProfilePeakMemoryUsage) {
+    auto result = conn->query("PROFILE MATCH (a:person) RETURN a.fName ORDER BY a.fName");
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_TRUE(result->hasNext());
+    auto plan = result->getNext()->getValue(0)->toString();
+    ASSERT_NE(plan.find("Peak Memory Usage: "), std::string::npos);
+}
+
+TEST_F(ApiTest, QuerySummaryPeakMemoryUsage) {
+    auto result = conn->query("UNWIND RANGE(1, 100000) AS x RETURN COUNT(DISTINCT x)");
+    ASSERT_TRUE(result->isSuccess());
+    auto largePeakMemoryUsage = result->getQuerySummary()->getPeakMemoryUsage();
+    result = conn->query("RETURN 1");
+    ASSERT_TRUE(result->isSuccess());
+    auto smallPeakMemoryUsage = result->getQuerySummary()->getPeakMemoryUsage();
+    ASSERT_GT(smallPeakMemoryUsage, 0);
+    ASSERT_GT(largePeakMemoryUsage, smallPeakMemoryUsage);
+}
+
+TEST_F(ApiTest, QueryAsStream) {
+    auto result = conn->queryAsStream("MATCH (a:person) RETURN a.ID, a.fName ORDER BY a.ID");
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_EQ(result->getType(), QueryResultType::STREAM);
+    ASSERT_EQ(result->getColumnNames(), std::vector<std::string>({"a.ID", "a.fName"}));
+    std::vector<std::string> tuples;
+    while (result->hasNext()) {
+        tuples.push_back(result->getNext()->toString());
+    }
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_EQ(result->getNumTuples(), 8);
+    ASSERT_NE(result->getQuerySummary(), nullptr);
+    auto expected = conn->query("MATCH (a:person) RETURN a.ID, a.fName ORDER BY a.ID");
+    ASSERT_TRUE(expected->isSuccess());
+    std::vector<std::string> expectedTuples;
+    while (expected->hasNext()) {
+        expectedTuples.push_back(expected->getNext()->toString());
+    }
+    ASSERT_EQ(tuples, expectedTuples);
+}
+
+#ifndef __SINGLE_THREADED__
+// Without background threads, a streaming query runs to completion before it returns.
+TEST_F(ApiTest, QueryAsStreamBoundsMemory) {
+    static constexpr auto query = "UNWIND RANGE(1, 3000000) AS x RETURN x";
+    auto materialized = conn->query(query);
+    ASSERT_TRUE(materialized->isSuccess());
+    auto materializedPeakMemoryUsage = materialized->getQuerySummary()->getPeakMemoryUsage();
+    materialized.reset();
+    auto result = conn->queryAsStream(query);
+    ASSERT_TRUE(result->isSuccess());
+    auto sum = 0ll;
+    while (result->hasNext()) {
+        sum += result->getNext()->getValue(0)->getValue<int64_t>();
+    }
+    ASSERT_EQ(sum, 3000000ll * 3000001ll / 2);
+    ASSERT_EQ(result->getNumTuples(), 3000000);
+    ASSERT_LT(result->getQuerySummary()->getPeakMemoryUsage(), materializedPeakMemoryUsage / 2);
+}
+
+TEST_F(ApiTest, QueryAsStreamCloseEarly) {
+    auto result = conn->queryAsStream("UNWIND RANGE(1, 100000000) AS x RETURN x");
+    ASSERT_TRUE(result->isSuccess());
+    for (auto i = 1; i <= 10; ++i) {
+        ASSERT_TRUE(result->hasNext());
+        result->getNext();
+    }
+    // The connection is busy until the stream is drained or closed.
+    auto busyResult = conn->query("RETURN 1");
+    ASSERT_FALSE(busyResult->isSuccess());
+    ASSERT_EQ(busyResult->getErrorMessage(),
+        "Connection exception: Cannot execute a query while a streaming query result of this "
+        "connection is still open. Read all of its tuples or close it first.");
+    // Closing the result aborts the query instead of producing the remaining tuples.
+    result.reset();
+    result = conn->query("RETURN 1");
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1);
+}
+#endif
+
+TEST_F(ApiTest, QueryAsStreamErrors) {
+    auto result = conn->queryAsStream("RETURN 1; RETURN 2;");
+    ASSERT_FALSE(result->isSuccess());
+    ASSERT_EQ(result->getErrorMessage(),
+        "Connection exception: Streaming query results do not support multiple statements.");
+    result = conn->queryAsStream("MATCH (a:personx) RETURN a");
+    ASSERT_FALSE(result->isSuccess());
+    // Errors raised during execution are reported once the consumer reaches them.
+    ASSERT_TRUE(conn->query("CALL query_memory_limit=1048576")->isSuccess());
+    result = conn->queryAsStream("UNWIND RANGE(1, 1000000) AS x RETURN COUNT(DISTINCT x)");
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_THROW(result->hasNext(), Exception);
+    ASSERT_FALSE(result->isSuccess());
+    ASSERT_EQ(result->getErrorMessage(), "Buffer manager exception: Unable to allocate memory! The "
+                                         "query memory limit of 1048576 bytes is reached!");
+    ASSERT_TRUE(conn->query("CALL query_memory_limit=0")->isSuccess());
+}
+
 TEST_F(ApiTest, TimeOut) {
     conn->setQueryTimeOut(1000 /* timeoutInMS */);
     auto result = conn->query(
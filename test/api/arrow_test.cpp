@@ -78,3 +78,56 @@ TEST_F(ArrowTest, getArrowSchema) {
     ASSERT_EQ(std::string(schema->children[0]->name), "NAME");
     schema->release(schema.get());
 }
+
+TEST_F(ArrowTest, queryAsArrowStream) {
+    auto query = "UNWIND RANGE(1, 5000) AS i RETURN i, CASE WHEN i % 7 = 0 THEN NULL ELSE i * 2 "
+                 "END, i % 2 = 0, CAST(i AS DOUBLE) / 2";
+    auto result = conn->queryAsArrow(query, 1000);
+    ASSERT_TRUE(result->isSuccess());
+    auto stream = result->getArrowArrayStream(1000);
+    ArrowSchema schema;
+    ASSERT_EQ(stream->get_schema(stream.get(), &schema), 0);
+    ASSERT_EQ(schema.n_children, 4);
+    ASSERT_STREQ(schema.children[0]->format, "l");
+    schema.release(&schema);
+    auto numTuples = 0;
+    ArrowArray array;
+    while (true) {
+        ASSERT_EQ(stream->get_next(stream.get(), &array), 0);
+        if (array.release == nullptr) {
+            break;
+        }
+        ASSERT_EQ(array.n_children, 4);
+        ASSERT_LE(array.length, 1000);
+        auto values = (const int64_t*)array.children[0]->buffers[1];
+        auto doubled = (const int64_t*)array.children[1]->buffers[1];
+        auto doubledValidity = (const uint8_t*)array.children[1]->buffers[0];
+        auto isEven = (const uint8_t*)array.children[2]->buffers[1];
+        auto halves = (const double*)array.children[3]->buffers[1];
+        for (auto i = 0; i < array.length; i++) {
+            auto value = values[i];
+            auto isValid = (doubledValidity[i / 8] >> (i % 8)) & 1;
+            ASSERT_EQ(isValid, value % 7 != 0);
+            if (isValid) {
+                ASSERT_EQ(doubled[i], value * 2);
+            }
+            ASSERT_EQ((isEven[i / 8] >> (i % 8)) & 1, value % 2 == 0);
+            ASSERT_EQ(halves[i], (double)value / 2);
+        }
+        numTuples += array.length;
+        array.release(&array);
+    }
+    ASSERT_EQ(numTuples, 5000);
+    ASSERT_EQ(stream->get_last_error(stream.get()), nullptr);
+    stream->release(stream.get());
+}
+
+TEST_F(ArrowTest, arrowStreamError) {
+    auto result = conn->queryAsArrow("MATCH (a:person) RETURN a.fName", 1);
+    auto stream = result->getArrowArrayStream(2);
+    ArrowArray array;
+    ASSERT_NE(stream->get_next(stream.get(), &array), 0);
+    ASSERT_STREQ(stream->get_last_error(stream.get()),
+        "Runtime exception: Chunk size does not match expected value 1.");
+    stream->release(stream.get());
+}
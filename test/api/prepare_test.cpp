@@ -258,3 +258,49 @@ TEST_F(ApiTest, ParameterWith) {
     auto groupTruth = std::vector<std::string>{"abc"};
     ASSERT_EQ(groupTruth, TestHelper::convertResultToString(*result));
 }
+
+static std::pair<uint64_t, uint64_t> getPlanCacheHitsAndMisses(lbug::main::Connection& conn) {
+    auto result = conn.query("CALL plan_cache_info() RETURN num_hits, num_misses");
+    auto tuple = result->getNext();
+    return {tuple->getValue(0)->getValue<uint64_t>(), tuple->getValue(1)->getValue<uint64_t>()};
+}
+
+static void checkQuery(lbug::main::Connection& conn, const std::string& query,
+    const std::vector<std::string>& groundTruth) {
+    auto result = conn.query(query);
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(groundTruth, TestHelper::convertResultToString(*result));
+}
+
+TEST_F(ApiTest, PlanCacheReusesStatementOfSameShape) {
+    auto [numHits, numMisses] = getPlanCacheHitsAndMisses(*conn);
+    checkQuery(*conn, "MATCH (a:person) WHERE a.age > 30 RETURN COUNT(*)", {"4"});
+    checkQuery(*conn, "MATCH (a:person) WHERE a.age > 40 RETURN COUNT(*)", {"2"});
+    checkQuery(*conn, "MATCH (a:person) WHERE a.fName IN ['Alice', 'Bob'] RETURN COUNT(*)",
+        {"2"});
+    checkQuery(*conn, "MATCH (a:person) WHERE a.fName IN ['Carol', 'Dan', 'Eve'] RETURN COUNT(*)",
+        {"2"});
+    checkQuery(*conn, "MATCH (a:person) WHERE a.fName IN ['Carol', 'Zoe'] RETURN COUNT(*)", {"1"});
+    checkQuery(*conn, "MATCH (a:person {ID: 0}) RETURN a.fName", {"Alice"});
+    checkQuery(*conn, "MATCH (a:person {ID: 2}) RETURN a.fName", {"Bob"});
+    auto [newNumHits, newNumMisses] = getPlanCacheHitsAndMisses(*conn);
+    ASSERT_EQ(newNumHits - numHits, 3);
+    ASSERT_EQ(newNumMisses - numMisses, 4);
+}
+
+TEST_F(ApiTest, PlanCacheSkipsLiteralsInResultColumns) {
+    auto [numHits, numMisses] = getPlanCacheHitsAndMisses(*conn);
+    for (auto i = 0u; i < 2; i++) {
+        auto result = conn->query("MATCH (a:person) WHERE a.ID = 0 RETURN a.age > 30");
+        ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        ASSERT_EQ(result->getColumnNames(), std::vector<std::string>{"a.age > 30"});
+        ASSERT_EQ(TestHelper::convertResultToString(*result), std::vector<std::string>{"True"});
+    }
+    checkQuery(*conn, "MATCH (a:person) WHERE a.fName = 'Al\\'ice' RETURN COUNT(*)", {"0"});
+    ASSERT_TRUE(conn->query("CALL enable_plan_cache=false")->isSuccess());
+    checkQuery(*conn, "MATCH (a:person) WHERE a.age > 30 RETURN COUNT(*)", {"4"});
+    ASSERT_TRUE(conn->query("CALL enable_plan_cache=true")->isSuccess());
+    auto [newNumHits, newNumMisses] = getPlanCacheHitsAndMisses(*conn);
+    ASSERT_EQ(newNumHits, numHits);
+    ASSERT_EQ(newNumMisses, numMisses);
+}
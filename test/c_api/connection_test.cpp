@@ -51,6 +51,36 @@ TEST_F(CApiConnectionTest, Query) {
     lbug_query_result_destroy(&result);
 }
 
+TEST_F(CApiConnectionTest, QueryAsStream) {
+    lbug_query_result result;
+    lbug_flat_tuple row;
+    lbug_state state;
+    auto connection = getConnection();
+    state = lbug_connection_query_as_stream(connection,
+        "MATCH (a:person) RETURN a.fName ORDER BY a.fName", &result);
+    ASSERT_EQ(state, LbugSuccess);
+    ASSERT_TRUE(lbug_query_result_is_success(&result));
+    ASSERT_EQ(lbug_query_result_get_num_columns(&result), 1);
+    ASSERT_TRUE(lbug_query_result_has_next(&result));
+    state = lbug_query_result_get_next(&result, &row);
+    ASSERT_EQ(state, LbugSuccess);
+    auto flatTupleCpp = (lbug::processor::FlatTuple*)(row._flat_tuple);
+    ASSERT_EQ(flatTupleCpp->getValue(0)->getValue<std::string>(), "Alice");
+    auto numTuples = 1u;
+    while (lbug_query_result_has_next(&result)) {
+        lbug_query_result_get_next(&result, &row);
+        numTuples++;
+    }
+    lbug_flat_tuple_destroy(&row);
+    ASSERT_EQ(numTuples, 8);
+    ASSERT_TRUE(lbug_query_result_is_success(&result));
+    lbug_query_result_destroy(&result);
+
+    state = lbug_connection_query_as_stream(connection, "RETURN 1; RETURN 2;", &result);
+    ASSERT_EQ(state, LbugError);
+    lbug_query_result_destroy(&result);
+}
+
 TEST_F(CApiConnectionTest, SetGetMaxNumThreadForExec) {
     uint64_t maxNumThreadForExec;
     lbug_state state;
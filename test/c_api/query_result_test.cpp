@@ -171,8 +171,13 @@ TEST_F(CApiQueryResultTest, GetQuerySummary) {
     ASSERT_EQ(state, LbugSuccess);
     auto compilingTime = lbug_query_summary_get_compiling_time(&summary);
     ASSERT_GT(compilingTime, 0);
+    auto planningTime = lbug_query_summary_get_planning_time(&summary);
+    ASSERT_GT(planningTime, 0);
+    ASSERT_LE(planningTime, compilingTime);
     auto executionTime = lbug_query_summary_get_execution_time(&summary);
     ASSERT_GT(executionTime, 0);
+    auto peakMemoryUsage = lbug_query_summary_get_peak_memory_usage(&summary);
+    ASSERT_GT(peakMemoryUsage, 0);
     lbug_query_summary_destroy(&summary);
     lbug_query_result_destroy(&result);
 }
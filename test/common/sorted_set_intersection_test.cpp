@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "common/sorted_set_intersection.h"
+#include "gtest/gtest.h"
+
+using namespace lbug::common;
+
+static std::vector<uint64_t> generateSortedSet(std::mt19937_64& rng, uint64_t size,
+    uint64_t range) {
+    std::set<uint64_t> values;
+    while (values.size() < size) {
+        values.insert(rng() % range);
+    }
+    return std::vector<uint64_t>(values.begin(), values.end());
+}
+
+static void checkIntersection(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b) {
+    std::vector<uint64_t> expected;
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+    std::vector<sel_t> aPositions(std::min(a.size(), b.size()));
+    std::vector<sel_t> bPositions(std::min(a.size(), b.size()));
+    auto numValues = SortedSetIntersection::intersect(a.data(), a.size(), b.data(), b.size(),
+        aPositions.data(), bPositions.data());
+    ASSERT_EQ(numValues, expected.size());
+    ASSERT_EQ(SortedSetIntersection::count(a.data(), a.size(), b.data(), b.size()),
+        expected.size());
+    for (auto i = 0u; i < numValues; ++i) {
+        ASSERT_EQ(a[aPositions[i]], expected[i]);
+        ASSERT_EQ(b[bPositions[i]], expected[i]);
+    }
+    std::vector<nodeID_t> aNodeIDs, bNodeIDs;
+    for (auto value : a) {
+        aNodeIDs.emplace_back(value, 1 /* tableID */);
+    }
+    for (auto value : b) {
+        bNodeIDs.emplace_back(value, 1 /* tableID */);
+    }
+    numValues = SortedSetIntersection::intersect(aNodeIDs.data(), aNodeIDs.size(),
+        bNodeIDs.data(), bNodeIDs.size(), aPositions.data(), bPositions.data());
+    ASSERT_EQ(numValues, expected.size());
+    for (auto i = 0u; i < numValues; ++i) {
+        ASSERT_EQ(aNodeIDs[aPositions[i]].offset, expected[i]);
+        ASSERT_EQ(bNodeIDs[bPositions[i]].offset, expected[i]);
+    }
+}
+
+TEST(SortedSetIntersectionTests, EmptyLists) {
+    checkIntersection({}, {});
+    checkIntersection({}, {1, 2, 3});
+    checkIntersection({1, 2, 3}, {});
+}
+
+TEST(SortedSetIntersectionTests, SimilarSizes) {
+    checkIntersection({1, 2, 3, 4, 5, 6, 7, 8, 9}, {2, 4, 6, 8, 10});
+    checkIntersection({0, 1, 2, 3}, {0, 1, 2, 3});
+    checkIntersection({0, 1, 2, 3}, {4, 5, 6, 7});
+    std::mt19937_64 rng(0);
+    for (auto i = 0u; i < 1000; ++i) {
+        auto range = 1 + rng() % 1000;
+        auto a = generateSortedSet(rng, rng() % std::min<uint64_t>(range, 200), range);
+        auto b = generateSortedSet(rng, rng() % std::min<uint64_t>(range, 200), range);
+        checkIntersection(a, b);
+    }
+}
+
+TEST(SortedSetIntersectionTests, SkewedSizes) {
+    std::mt19937_64 rng(0);
+    for (auto i = 0u; i < 200; ++i) {
+        auto small = generateSortedSet(rng, 1 + rng() % 10, 10000);
+        auto large = generateSortedSet(rng, 5000, 10000);
+        checkIntersection(small, large);
+        checkIntersection(large, small);
+    }
+}
@@ -0,0 +1,84 @@
+#include "common/task_system/task_scheduler.h"
+#include "gtest/gtest.h"
+
+using namespace lbug::common;
+
+namespace lbug {
+namespace testing {
+
+class NoOpTask final : public Task {
+public:
+    NoOpTask(uint64_t maxNumThreads, TaskPriority priority) : Task{maxNumThreads} {
+        setPriority(priority);
+    }
+
+    void run() override {}
+};
+
+class TaskSchedulerTest : public ::testing::Test {
+protected:
+    // The scheduler has no worker threads, so the tests can decide which task a worker would pick
+    // next by calling getTaskAndRegister directly.
+#if defined(__APPLE__)
+    TaskSchedulerTest() : scheduler{0 /* numWorkerThreads */, 0 /* threadQos */} {}
+#else
+    TaskSchedulerTest() : scheduler{0 /* numWorkerThreads */} {}
+#endif
+
+    std::shared_ptr<Task> push(uint64_t maxNumThreads, TaskPriority priority) {
+        auto task = std::make_shared<NoOpTask>(maxNumThreads, priority);
+        scheduler.pushTaskIntoQueue(task, nullptr /* memoryTracker */);
+        return task;
+    }
+
+    Task* pick() {
+        auto scheduledTask = scheduler.getTaskAndRegister();
+        return scheduledTask == nullptr ? nullptr : scheduledTask->task.get();
+    }
+
+protected:
+    TaskScheduler scheduler;
+};
+
+TEST_F(TaskSchedulerTest, HigherPriorityIsPickedFirst) {
+    auto lowTask = push(1, TaskPriority::LOW);
+    auto normalTask = push(1, TaskPriority::NORMAL);
+    auto highTask = push(1, TaskPriority::HIGH);
+    ASSERT_EQ(pick(), highTask.get());
+    ASSERT_EQ(pick(), normalTask.get());
+    ASSERT_EQ(pick(), lowTask.get());
+    ASSERT_EQ(pick(), nullptr);
+}
+
+TEST_F(TaskSchedulerTest, FewestRegisteredWorkersIsPickedFirst) {
+    auto firstTask = push(3, TaskPriority::NORMAL);
+    auto secondTask = push(3, TaskPriority::NORMAL);
+    // Ties are broken in FIFO order.
+    ASSERT_EQ(pick(), firstTask.get());
+    ASSERT_EQ(pick(), secondTask.get());
+    ASSERT_EQ(pick(), firstTask.get());
+    // A newly scheduled task gets the next worker even though older tasks still accept workers.
+    auto thirdTask = push(3, TaskPriority::NORMAL);
+    ASSERT_EQ(pick(), thirdTask.get());
+    ASSERT_EQ(pick(), secondTask.get());
+    ASSERT_EQ(pick(), thirdTask.get());
+    ASSERT_EQ(pick(), firstTask.get());
+    ASSERT_EQ(pick(), secondTask.get());
+    ASSERT_EQ(pick(), thirdTask.get());
+    ASSERT_EQ(pick(), nullptr);
+}
+
+TEST_F(TaskSchedulerTest, LowPriorityTaskIsNotStarved) {
+    auto highTask = push(UINT64_MAX, TaskPriority::HIGH);
+    auto lowTask = push(1, TaskPriority::LOW);
+    // The LOW task is promoted to NORMAL, and then to HIGH, where it is picked because it has fewer
+    // registered workers than the HIGH task.
+    for (auto i = 0u; i < 2 * ScheduledTask::NUM_SKIPS_BEFORE_PROMOTION; ++i) {
+        ASSERT_EQ(pick(), highTask.get());
+    }
+    ASSERT_EQ(pick(), lowTask.get());
+    ASSERT_EQ(pick(), highTask.get());
+}
+
+} // namespace testing
+} // namespace lbug
@@ -151,5 +151,98 @@ TEST_F(CardinalityTest, TestPopulatedAfterOptimizations) {
     checkFunc(plan->getLastOperator().get());
 }
 
+TEST_F(CardinalityTest, TestSkewedDegrees) {
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE account(id INT64, PRIMARY KEY(id))")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE REL TABLE follows(FROM account TO account) WITH "
+                            "(storage_direction = 'both')")
+                    ->isSuccess());
+    ASSERT_TRUE(conn->query("UNWIND range(0, 99) AS i CREATE (:account {id: i})")->isSuccess());
+    // Every account follows account 0.
+    ASSERT_TRUE(conn->query("MATCH (a:account), (b:account) WHERE a.id <> 0 AND b.id = 0 "
+                            "CREATE (a)-[:follows]->(b)")
+                    ->isSuccess());
+    ASSERT_TRUE(conn->query("CHECKPOINT")->isSuccess());
+    // All 99 * 99 pairs of followers meet at account 0. Average degrees estimate fewer than 100.
+    auto query = "EXPLAIN LOGICAL MATCH (a:account)-[:follows]->(b:account)<-[:follows]-"
+                 "(c:account) RETURN a.id, c.id";
+    EXPECT_GT(getRoot(query)->getCardinality(), 5000);
+    if (!inMemMode) {
+        // Degree stats are persisted.
+        createDBAndConn();
+        EXPECT_GT(getRoot(query)->getCardinality(), 5000);
+    }
+}
+
+TEST_F(CardinalityTest, TestValueHistograms) {
+    ASSERT_TRUE(
+        conn->query("CREATE NODE TABLE item(id INT64, v INT64, PRIMARY KEY(id))")->isSuccess());
+    // Half of the values are 0, the others are unique.
+    ASSERT_TRUE(conn->query("UNWIND range(0, 9999) AS i CREATE (:item {id: i, v: CASE WHEN "
+                            "i % 2 = 0 THEN 0 ELSE i END})")
+                    ->isSuccess());
+    auto getFilterCardinality = [&](const std::string& predicate) {
+        auto plan = getRoot(
+            std::format("EXPLAIN LOGICAL MATCH (p:item) WHERE {} RETURN p.id", predicate));
+        auto* filterOp =
+            getOpWithType(plan->getLastOperator().get(), planner::LogicalOperatorType::FILTER);
+        EXPECT_NE(nullptr, filterOp);
+        return filterOp == nullptr ? 0 : filterOp->getCardinality();
+    };
+    // The number of distinct values alone estimates 2 rows.
+    EXPECT_GT(getFilterCardinality("p.v = 0"), 2500);
+    EXPECT_GT(getFilterCardinality("0 = p.v"), 2500);
+    EXPECT_LT(getFilterCardinality("p.v = 5"), 10);
+    // The default selectivity estimates 1000 rows for both.
+    EXPECT_GT(getFilterCardinality("p.v < 100"), 2500);
+    EXPECT_LT(getFilterCardinality("p.v > 9500"), 700);
+    EXPECT_LT(getFilterCardinality("9500 < p.v"), 700);
+
+    // Updates do not maintain the statistics. Analyzing the table rebuilds them.
+    ASSERT_TRUE(conn->query("MATCH (p:item) WHERE p.id < 9000 SET p.v = 1")->isSuccess());
+    EXPECT_LT(getFilterCardinality("p.v = 1"), 10);
+    ASSERT_TRUE(conn->query("CALL analyze('item')")->isSuccess());
+    EXPECT_GT(getFilterCardinality("p.v = 1"), 7000);
+    EXPECT_LT(getFilterCardinality("p.v = 0"), 2500);
+    if (!inMemMode) {
+        // The rebuilt statistics are persisted.
+        ASSERT_TRUE(conn->query("CHECKPOINT")->isSuccess());
+        createDBAndConn();
+        EXPECT_GT(getFilterCardinality("p.v = 1"), 7000);
+    }
+}
+
+TEST_F(CardinalityTest, TestReoptimization) {
+    ASSERT_TRUE(
+        conn->query("CREATE NODE TABLE item(id INT64, v INT64, PRIMARY KEY(id))")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE REL TABLE linked(FROM item TO item)")->isSuccess());
+    ASSERT_TRUE(
+        conn->query("UNWIND range(0, 1999) AS i CREATE (:item {id: i, v: i % 3})")->isSuccess());
+    ASSERT_TRUE(conn->query("MATCH (a:item), (b:item) WHERE b.id = (a.id + 1) % 2000 OR "
+                            "b.id = (a.id * 7) % 2000 CREATE (a)-[:linked]->(b)")
+                    ->isSuccess());
+    auto query = "MATCH (a:item)-[:linked]->(b:item)-[:linked]->(c:item) WHERE a.v = c.v "
+                 "RETURN COUNT(*)";
+    auto checkCount = [&]() {
+        auto result = conn->query(query);
+        ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        EXPECT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1839);
+    };
+    checkCount();
+    // Any deviation from the estimates triggers re-planning, so the query is restarted the
+    // maximum number of times.
+    ASSERT_TRUE(conn->query("CALL reoptimization_threshold=1")->isSuccess());
+    checkCount();
+    auto preparedStatement =
+        conn->prepare("MATCH (a:item)-[:linked]->(b:item)-[:linked]->(c:item) WHERE a.v = c.v "
+                      "AND a.id < $n RETURN COUNT(*)");
+    auto result = conn->execute(preparedStatement.get(), std::make_pair(std::string("n"), 2000));
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    EXPECT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1839);
+    // Queries in manual transactions are not restarted.
+    ASSERT_TRUE(conn->query("BEGIN TRANSACTION READ ONLY")->isSuccess());
+    checkCount();
+    ASSERT_TRUE(conn->query("COMMIT")->isSuccess());
+}
+
 } // namespace testing
 } // namespace lbug
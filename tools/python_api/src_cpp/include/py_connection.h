@@ -28,6 +28,8 @@ public:
 
     std::unique_ptr<PyQueryResult> query(const std::string& statement);
 
+    std::unique_ptr<PyQueryResult> queryAsStream(const std::string& statement);
+
     void setMaxNumThreadForExec(uint64_t numThreads);
 
     PyPreparedStatement prepare(const std::string& query, const py::dict& parameters);
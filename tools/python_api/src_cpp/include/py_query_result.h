@@ -50,6 +50,10 @@ public:
 
     double getCompilingTime();
 
+    double getPlanningTime();
+
+    uint64_t getPeakMemoryUsage();
+
     size_t getNumTuples();
 
 private:
@@ -36,7 +36,9 @@ void PyQueryResult::initialize(py::handle& m) {
         .def("isSuccess", &PyQueryResult::isSuccess)
         .def("getErrorMessage", &PyQueryResult::getErrorMessage)
         .def("getCompilingTime", &PyQueryResult::getCompilingTime)
+        .def("getPlanningTime", &PyQueryResult::getPlanningTime)
         .def("getExecutionTime", &PyQueryResult::getExecutionTime)
+        .def("getPeakMemoryUsage", &PyQueryResult::getPeakMemoryUsage)
         .def("getNumTuples", &PyQueryResult::getNumTuples);
     // PyDateTime_IMPORT is a macro that must be invoked before calling any other cpython datetime
     // macros. One could also invoke this in a separate function like constructor. See
@@ -49,11 +51,17 @@ PyQueryResult::~PyQueryResult() {
 }
 
 bool PyQueryResult::hasNext() {
+    // A streaming result blocks until the query produces its next batch.
+    py::gil_scoped_release release;
     return queryResult->hasNext();
 }
 
 py::list PyQueryResult::getNext() {
-    auto tuple = queryResult->getNext();
+    std::shared_ptr<lbug::processor::FlatTuple> tuple;
+    {
+        py::gil_scoped_release release;
+        tuple = queryResult->getNext();
+    }
     py::tuple result(tuple->len());
     for (auto i = 0u; i < tuple->len(); ++i) {
         result[i] = convertValueToPyObject(*tuple->getValue(i));
@@ -80,7 +88,13 @@ void PyQueryResult::close() {
     // expose close() interface so that users can explicitly call close() and ensure that
     // QueryResult is destroyed before Database.
     if (isOwned) {
-        delete queryResult;
+        if (queryResult != nullptr && queryResult->getType() == QueryResultType::STREAM) {
+            // Closing a streaming result waits for the query running in the background to stop.
+            py::gil_scoped_release release;
+            delete queryResult;
+        } else {
+            delete queryResult;
+        }
         queryResult = nullptr;
     }
 }
@@ -370,10 +384,18 @@ double PyQueryResult::getExecutionTime() {
     return queryResult->getQuerySummary()->getExecutionTime();
 }
 
+uint64_t PyQueryResult::getPeakMemoryUsage() {
+    return queryResult->getQuerySummary()->getPeakMemoryUsage();
+}
+
 double PyQueryResult::getCompilingTime() {
     return queryResult->getQuerySummary()->getCompilingTime();
 }
 
+double PyQueryResult::getPlanningTime() {
+    return queryResult->getQuerySummary()->getPlanningTime();
+}
+
 size_t PyQueryResult::getNumTuples() {
     return queryResult->getNumTuples();
 }
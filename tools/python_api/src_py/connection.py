@@ -99,6 +99,8 @@ class Connection:
         self,
         query: str | PreparedStatement,
         parameters: dict[str, Any] | None = None,
+        *,
+        stream: bool = False,
     ) -> QueryResult | list[QueryResult]:
         """
         Execute a query.
@@ -113,6 +115,13 @@ class Connection:
         parameters : dict[str, Any]
             Parameters for the query.
 
+        stream : bool
+            If True, the query runs in the background and rows are returned
+            while it is still executing. Execution pauses while rows are not
+            read. Only a single statement without parameters is supported, and
+            the connection cannot execute other queries until all rows are read
+            or the result is closed.
+
         Returns
         -------
         QueryResult
@@ -127,7 +136,12 @@ class Connection:
             msg = f"Parameters must be a dict; found {type(parameters)}."
             raise RuntimeError(msg)  # noqa: TRY004
 
-        if len(parameters) == 0 and isinstance(query, str):
+        if stream:
+            if len(parameters) != 0 or not isinstance(query, str):
+                msg = "Streaming query results do not support parameters or prepared statements."
+                raise RuntimeError(msg)
+            query_result_internal = self._connection.query_as_stream(query)
+        elif len(parameters) == 0 and isinstance(query, str):
             query_result_internal = self._connection.query(query)
         else:
             prepared_statement = self._prepare(query, parameters) if isinstance(query, str) else query
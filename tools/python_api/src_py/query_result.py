@@ -468,6 +468,33 @@ class QueryResult:
         self.check_for_query_result_close()
         return self._query_result.getCompilingTime()
 
+    def get_planning_time(self) -> int:
+        """
+        Get the time in ms which was spent planning and optimizing the query. It is part of the
+        compiling time.
+
+        Returns
+        -------
+        double
+            Query planning time as double in ms.
+
+        """
+        self.check_for_query_result_close()
+        return self._query_result.getPlanningTime()
+
+    def get_peak_memory_usage(self) -> int:
+        """
+        Get the highest amount of intermediate memory in bytes allocated by the query.
+
+        Returns
+        -------
+        int
+            Peak intermediate memory usage of the query in bytes.
+
+        """
+        self.check_for_query_result_close()
+        return self._query_result.getPeakMemoryUsage()
+
     def get_num_tuples(self) -> int:
         """
         Get the number of tuples which the query returned.
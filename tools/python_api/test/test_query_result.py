@@ -17,6 +17,20 @@ def test_get_compiling_time(conn_db_readonly: ConnDB) -> None:
     result.close()
 
 
+def test_get_planning_time(conn_db_readonly: ConnDB) -> None:
+    conn, _ = conn_db_readonly
+    result = conn.execute("MATCH (a:person) WHERE a.ID = 0 RETURN a")
+    assert 0 < result.get_planning_time() <= result.get_compiling_time()
+    result.close()
+
+
+def test_get_peak_memory_usage(conn_db_readonly: ConnDB) -> None:
+    conn, _ = conn_db_readonly
+    result = conn.execute("MATCH (a:person) RETURN a.fName ORDER BY a.fName")
+    assert result.get_peak_memory_usage() > 0
+    result.close()
+
+
 def test_get_num_tuples(conn_db_readonly: ConnDB) -> None:
     conn, _ = conn_db_readonly
     result = conn.execute("MATCH (a:person) WHERE a.ID = 0 RETURN a")
@@ -52,3 +66,20 @@ def test_multiple_query_results(conn_db_readonly: ConnDB) -> None:
         assert result.has_next()
         assert result.get_next() == [i]
         i += 1
+
+
+def test_stream(conn_db_readonly: ConnDB) -> None:
+    conn, _ = conn_db_readonly
+    expected = conn.execute("MATCH (a:person) RETURN a.fName ORDER BY a.fName").get_all()
+    with conn.execute("MATCH (a:person) RETURN a.fName ORDER BY a.fName", stream=True) as result:
+        assert result.get_column_names() == ["a.fName"]
+        assert result.get_all() == expected
+        assert result.get_execution_time() > 0
+
+
+def test_stream_close_early(conn_db_readonly: ConnDB) -> None:
+    conn, _ = conn_db_readonly
+    result = conn.execute("UNWIND range(1, 100000000) AS x RETURN x", stream=True)
+    assert result.get_n(3) == [[1], [2], [3]]
+    result.close()
+    assert conn.execute("RETURN 1").get_next() == [1]